@@ -16,6 +16,16 @@
 /** @brief Converts given port and pin enumerations to bit position in all-covering registers. */
 #define GIO_PORT_PIN_TO_BIT_OFFSET(port, pin) (((port) << 3) + (pin))
 
+#if GIO_TRACE_HOOK
+/** @brief Calls the trace hook, if one is installed. */
+#define GIO_TRACE(enter) do { if (s_gio_trace_hook != NULL) { s_gio_trace_hook(enter); } } while (0)
+
+/** @brief Hook called around gio_get_pending_irq(). */
+static tGIO_trace_hook s_gio_trace_hook = NULL;
+#else
+#define GIO_TRACE(enter) ((void)0)
+#endif
+
 bool gio_set_mode(tGIO_mode mode) {
 	if (!IS_ENUM_IN_RANGE(mode, NUM_OF_GIO_MODE)) {
 		return (false);
@@ -161,12 +171,15 @@ bool gio_get_pending_irq(tGIO_int_level level, tGIO_port* port, tGIO_pin* pin) {
 		return (false);
 	}
 
+	GIO_TRACE(true);
+
 	/* Select the offset register based in IRQ level. */
 	tms570_reg* giooffn_reg = TMS570_GIO_BASE_ADDR + ((level == GIO_INT_LEVEL_HIGH) ? TMS570_GIO_GIOOFF1_OFFSET : TMS570_GIO_GIOOFF2_OFFSET);
 	tms570_reg	pending_irq = GET_BITS(*giooffn_reg, TMS570_GIO_GIOOFFn_GIOOFFn_BIT_OFFSET, TMS570_GIO_GIOOFFn_GIOOFFn_BIT_LEN);
 
 	/* pending_irq equals zero means no interrupt has occurred.*/
 	if (pending_irq == 0) {
+		GIO_TRACE(false);
 		return (false);
 	}
 
@@ -174,5 +187,12 @@ bool gio_get_pending_irq(tGIO_int_level level, tGIO_port* port, tGIO_pin* pin) {
 	*port = pending_irq / NUM_OF_GIO_PIN; /* Calculate corresponding port*/
 	*pin = pending_irq & NUM_OF_GIO_PIN;  /* Calculate corresponding pin */
 
+	GIO_TRACE(false);
 	return (true);
 }
+
+#if GIO_TRACE_HOOK
+void gio_set_trace_hook(tGIO_trace_hook hook) {
+	s_gio_trace_hook = hook;
+}
+#endif
@@ -16,6 +16,16 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/**
+ * @brief Build switch for the gio_get_pending_irq() trace hook.
+ * 
+ * When non-zero, gio_set_trace_hook() is available and the dispatch calls the
+ * installed hook on entry and exit. When zero the hook calls compile to nothing.
+ */
+#ifndef GIO_TRACE_HOOK
+#define GIO_TRACE_HOOK (0)
+#endif
+
 /**
  * @enum tGIO_mode
  * @brief GIO operation modes.
@@ -94,6 +104,15 @@ typedef enum gio_int_level_e {
 	NUM_OF_GIO_INT_LEVEL   /**< Number of interrupt level options */
 } tGIO_int_level;
 
+#if GIO_TRACE_HOOK
+/**
+ * @brief Hook called on entry and exit of gio_get_pending_irq(), e.g. by a tracer.
+ * 
+ * @param[in] enter true on entry, false on exit.
+ */
+typedef void (*tGIO_trace_hook)(bool enter);
+#endif
+
 /**
  * @brief Set the global GIO mode.
  * 
@@ -177,4 +196,13 @@ bool gio_enable_interrupt(tGIO_port port, tGIO_pin pin, bool en);
  */
 bool gio_get_pending_irq(tGIO_int_level level, tGIO_port* port, tGIO_pin* pin);
 
+#if GIO_TRACE_HOOK
+/**
+ * @brief Install the hook called around gio_get_pending_irq().
+ * 
+ * @param[in] hook Hook to call, NULL to remove it. @see tGIO_trace_hook
+ */
+void gio_set_trace_hook(tGIO_trace_hook hook);
+#endif
+
 #endif
@@ -110,6 +110,32 @@
  */
 typedef volatile uint32_t tms570_reg;
 
+/**
+ * @brief Build switch for the MMIO access tracer.
+ * 
+ * When non-zero, every register write and read-back in tms570_update_register()
+ * and every write in tms570_write_register() is recorded by tms570_mmio_trace(),
+ * see tms570_mmio_trace.h. When zero the hooks compile to nothing.
+ */
+#ifndef TMS570_MMIO_TRACE
+#define TMS570_MMIO_TRACE				(0)
+#endif
+
+#if TMS570_MMIO_TRACE
+/**
+ * @brief Records one register access.
+ * 
+ * @param reg Address of the register
+ * @param value Value written or read
+ * @param write true for a write, false for a read
+ */
+void tms570_mmio_trace(const tms570_reg* reg, uint32_t value, bool write);
+
+#define TMS570_MMIO_TRACE_ACCESS(reg, value, write)	tms570_mmio_trace((reg), (value), (write))
+#else
+#define TMS570_MMIO_TRACE_ACCESS(reg, value, write)	((void)0)
+#endif
+
 /**
  * @brief Updates bits of a register specified by a mask.
  *
@@ -124,7 +150,26 @@ typedef volatile uint32_t tms570_reg;
 static inline bool tms570_update_register(tms570_reg* reg, tms570_reg value, tms570_reg mask) {
 	value &= mask;
 	*reg = value;
-	return ((*reg & mask) == value);
+	TMS570_MMIO_TRACE_ACCESS(reg, value, true);
+
+	tms570_reg readback = *reg;
+	TMS570_MMIO_TRACE_ACCESS(reg, readback, false);
+	return ((readback & mask) == value);
+}
+
+/**
+ * @brief Writes a whole word to a register without reading it back.
+ *
+ * For registers whose read-back does not reflect the write: write-1-to-set
+ * and write-1-to-clear registers (SET_INT, CLEAR_INT, FLR, ...) and data
+ * registers where the write itself is the action (TD).
+ * 
+ * @param reg Pointer to the register to write
+ * @param value Value to write
+ */
+static inline void tms570_write_register(tms570_reg* reg, tms570_reg value) {
+	*reg = value;
+	TMS570_MMIO_TRACE_ACCESS(reg, value, true);
 }
 
 /**
@@ -0,0 +1,59 @@
+/**
+ * @file tms570_mmio_trace.c
+ * @brief MMIO access tracer source file.
+ */
+
+#include "tms570_mmio_trace.h"
+
+#if TMS570_MMIO_TRACE
+
+/** @brief Capture buffer, exported under a fixed name for debugger dumps. */
+volatile tMMIO_trace g_mmioTrace;
+
+void tms570_mmio_trace_start(void) {
+	g_mmioTrace.running = 0U;
+	g_mmioTrace.count = 0U;
+	g_mmioTrace.dropped = 0U;
+	g_mmioTrace.size = TMS570_MMIO_TRACE_NUM_OF_RECORDS;
+	g_mmioTrace.magic = TMS570_MMIO_TRACE_MAGIC;
+	g_mmioTrace.running = 1U;
+}
+
+void tms570_mmio_trace_stop(void) {
+	g_mmioTrace.running = 0U;
+}
+
+const tMMIO_trace* tms570_mmio_trace_get(void) {
+	return ((const tMMIO_trace*)&g_mmioTrace);
+}
+
+void tms570_mmio_trace(const tms570_reg* reg, uint32_t value, bool write) {
+	if (g_mmioTrace.running == 0U) {
+		return;
+	}
+
+	uint32_t count = g_mmioTrace.count;
+	if (count >= TMS570_MMIO_TRACE_NUM_OF_RECORDS) {
+		g_mmioTrace.dropped++;
+		return;
+	}
+
+	g_mmioTrace.record[count].address = (uint32_t)(uintptr_t)reg | (write ? TMS570_MMIO_TRACE_WRITE : 0U);
+	g_mmioTrace.record[count].value = value;
+	g_mmioTrace.count = count + 1U;
+}
+
+#else
+
+/* Without TMS570_MMIO_TRACE the capture stays empty. */
+void tms570_mmio_trace_start(void) {
+}
+
+void tms570_mmio_trace_stop(void) {
+}
+
+const tMMIO_trace* tms570_mmio_trace_get(void) {
+	return (NULL);
+}
+
+#endif
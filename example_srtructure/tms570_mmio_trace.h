@@ -0,0 +1,76 @@
+/**
+ * @file tms570_mmio_trace.h
+ * @brief MMIO access tracer for the register layer.
+ * 
+ * Built with TMS570_MMIO_TRACE set, tms570_update_register() records every
+ * write and read-back and tms570_write_register() every write, as
+ * (address, value) pairs. Records are appended
+ * until the buffer is full, so a capture started before an init sequence
+ * holds the sequence from its first access. tools/mmio_replay.py replays a
+ * memory dump of the trace against a peripheral model.
+ * 
+ * @note The recorder does not lock; capture init sequences with the traced
+ * interrupts disabled.
+ */
+
+#ifndef INC_TMS570_MMIO_TRACE_H_
+#define INC_TMS570_MMIO_TRACE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "tms570_common.h"
+
+/** @brief Number of records in the capture buffer. */
+#ifndef TMS570_MMIO_TRACE_NUM_OF_RECORDS
+#define TMS570_MMIO_TRACE_NUM_OF_RECORDS	(2048U)
+#endif
+
+/** @brief First word of the capture, lets the replay tool find and check a memory dump. */
+#define TMS570_MMIO_TRACE_MAGIC				(0x4F494D4DU)
+
+/** @brief Set in tMMIO_record.address for writes; registers are word aligned. */
+#define TMS570_MMIO_TRACE_WRITE				(0x1U)
+
+/**
+ * @struct tMMIO_record
+ * @brief One register access, 8 bytes.
+ */
+typedef struct mmio_record_s {
+	uint32_t address; /**< Register address, TMS570_MMIO_TRACE_WRITE set for writes */
+	uint32_t value;	  /**< Value written or read */
+} tMMIO_record;
+
+/**
+ * @struct tMMIO_trace
+ * @brief Capture buffer, laid out for a raw memory dump.
+ */
+typedef struct mmio_trace_s {
+	uint32_t	 magic;										/**< TMS570_MMIO_TRACE_MAGIC once started */
+	uint32_t	 size;										/**< TMS570_MMIO_TRACE_NUM_OF_RECORDS */
+	uint32_t	 count;										/**< Records captured */
+	uint32_t	 dropped;									/**< Accesses lost after the buffer filled up */
+	uint32_t	 running;									/**< Non-zero while capturing */
+	tMMIO_record record[TMS570_MMIO_TRACE_NUM_OF_RECORDS]; /**< Records in access order */
+} tMMIO_trace;
+
+/**
+ * @brief Clears the capture buffer and starts capturing.
+ */
+void tms570_mmio_trace_start(void);
+
+/**
+ * @brief Stops capturing; the buffer is kept for dumping.
+ */
+void tms570_mmio_trace_stop(void);
+
+/**
+ * @brief Gets the capture buffer.
+ * 
+ * A debugger can dump it as well: dump binary memory mmio.bin &g_mmioTrace (&g_mmioTrace + 1)
+ * 
+ * @return Pointer to the capture buffer.
+ */
+const tMMIO_trace* tms570_mmio_trace_get(void);
+
+#endif
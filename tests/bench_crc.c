@@ -0,0 +1,120 @@
+/*
+ * Throughput of the CRC variant selected with SCI_CRC_TABLE, after checking
+ * it against a bitwise reference over random chunk splits.
+ *
+ * Timing uses sciCycleNow(), so the same file runs on target (PMU cycle
+ * counter) and on a host (CLOCK_MONOTONIC scaled to GCLK).
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "sci_crc.h"
+#include "sci_cycle.h"
+
+#define BENCH_BUFFER_LEN    (4096U)
+#define BENCH_BYTES         (64U * 1024U * 1024U)
+#define BENCH_SPLIT_RUNS    (2000U)
+
+static uint8_t s_buffer[BENCH_BUFFER_LEN];
+
+static uint16_t ref_crc16(uint16_t crc, const uint8_t* data, uint32_t length){
+    for (uint32_t i = 0U; i < length; i++){
+        crc ^= (uint16_t)(data[i] << 8);
+        for (uint32_t bit = 0U; bit < 8U; bit++){
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return (crc);
+}
+
+static uint16_t ref_modbus(uint16_t crc, const uint8_t* data, uint32_t length){
+    for (uint32_t i = 0U; i < length; i++){
+        crc ^= data[i];
+        for (uint32_t bit = 0U; bit < 8U; bit++){
+            crc = ((crc & 1U) != 0U) ? (uint16_t)((crc >> 1) ^ 0xA001U) : (uint16_t)(crc >> 1);
+        }
+    }
+    return (crc);
+}
+
+static uint32_t ref_crc32(uint32_t crc, const uint8_t* data, uint32_t length){
+    crc = ~crc;
+    for (uint32_t i = 0U; i < length; i++){
+        crc ^= data[i];
+        for (uint32_t bit = 0U; bit < 8U; bit++){
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+        }
+    }
+    return (~crc);
+}
+
+static void check_variant(void){
+    static const uint8_t s_check[] = "123456789";
+
+    CHECK(sciCrc16Update(SCI_CRC16_CCITT_INIT, s_check, 9U) == 0x29B1U);
+    CHECK(sciCrc16Update(SCI_CRC16_XMODEM_INIT, s_check, 9U) == 0x31C3U);
+    CHECK(sciCrc16ModbusUpdate(SCI_CRC16_MODBUS_INIT, s_check, 9U) == 0x4B37U);
+    CHECK(sciCrc32Update(SCI_CRC32_INIT, s_check, 9U) == 0xCBF43926U);
+
+    // Unaligned starts and odd chunk lengths exercise the slice loop and its byte tail
+    for (uint32_t run = 0U; run < BENCH_SPLIT_RUNS; run++){
+        uint32_t start = (uint32_t)rand() % 16U;
+        uint32_t length = (uint32_t)rand() % (BENCH_BUFFER_LEN - start);
+        const uint8_t* data = &s_buffer[start];
+        uint16_t crc16 = SCI_CRC16_CCITT_INIT;
+        uint16_t modbus = SCI_CRC16_MODBUS_INIT;
+        uint32_t crc32 = SCI_CRC32_INIT;
+
+        for (uint32_t pos = 0U; pos < length;){
+            uint32_t chunk = 1U + ((uint32_t)rand() % 64U);
+            chunk = (chunk < (length - pos)) ? chunk : (length - pos);
+            crc16 = sciCrc16Update(crc16, &data[pos], chunk);
+            modbus = sciCrc16ModbusUpdate(modbus, &data[pos], chunk);
+            crc32 = sciCrc32Update(crc32, &data[pos], chunk);
+            pos += chunk;
+        }
+        CHECK(crc16 == ref_crc16(SCI_CRC16_CCITT_INIT, data, length));
+        CHECK(modbus == ref_modbus(SCI_CRC16_MODBUS_INIT, data, length));
+        CHECK(crc32 == ref_crc32(SCI_CRC32_INIT, data, length));
+    }
+}
+
+static void report(const char* name, uint32_t cycles, uint32_t result){
+    double seconds = (double)cycles / (double)GCLK_FREQ;
+    printf("  %-14s %8.1f MB/s %6.2f cycles/byte (crc %08x)\n", name,
+           ((double)BENCH_BYTES / 1e6) / seconds, (double)cycles / (double)BENCH_BYTES, (unsigned)result);
+}
+
+int main(void){
+    uint32_t start;
+    uint32_t crc;
+
+    for (uint32_t i = 0U; i < BENCH_BUFFER_LEN; i++){
+        s_buffer[i] = (uint8_t)rand();
+    }
+    sciCycleInit();
+    check_variant();
+    printf("SCI_CRC_TABLE %d, %u MiB per CRC\n", SCI_CRC_TABLE, BENCH_BYTES >> 20);
+
+    crc = SCI_CRC16_CCITT_INIT;
+    start = sciCycleNow();
+    for (uint32_t done = 0U; done < BENCH_BYTES; done += BENCH_BUFFER_LEN){
+        crc = sciCrc16Update((uint16_t)crc, s_buffer, BENCH_BUFFER_LEN);
+    }
+    report("CRC-16", sciCycleNow() - start, crc);
+
+    crc = SCI_CRC16_MODBUS_INIT;
+    start = sciCycleNow();
+    for (uint32_t done = 0U; done < BENCH_BYTES; done += BENCH_BUFFER_LEN){
+        crc = sciCrc16ModbusUpdate((uint16_t)crc, s_buffer, BENCH_BUFFER_LEN);
+    }
+    report("CRC-16/MODBUS", sciCycleNow() - start, crc);
+
+    crc = SCI_CRC32_INIT;
+    start = sciCycleNow();
+    for (uint32_t done = 0U; done < BENCH_BYTES; done += BENCH_BUFFER_LEN){
+        crc = sciCrc32Update(crc, s_buffer, BENCH_BUFFER_LEN);
+    }
+    report("CRC-32", sciCycleNow() - start, crc);
+    return (0);
+}
@@ -0,0 +1,113 @@
+/* Host benchmark of sciRingVPrintf() against snprintf(), after checking both agree. */
+#define _POSIX_C_SOURCE 199309L
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "check.h"
+#include "sci_printf.h"
+#include "sci_ring.h"
+
+#define BENCH_ITERATIONS    (200000U)
+#define BENCH_RING_SIZE     (4096U)
+
+static uint8_t    s_storage[BENCH_RING_SIZE];
+static sci_ring_t s_ring;
+
+static uint32_t ring_printf(const char* fmt, ...){
+    va_list  args;
+    uint32_t written;
+
+    va_start(args, fmt);
+    written = sciRingVPrintf(&s_ring, fmt, args);
+    va_end(args);
+    return (written);
+}
+
+/* Moves everything formatted so far into text and empties the ring. */
+static uint32_t ring_take(char* text, uint32_t size){
+    uint32_t length = sciRingRead(&s_ring, (uint8_t*)text, size - 1U);
+    text[length] = '\0';
+    return (length);
+}
+
+static double now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void check_same(const char* expected, const char* fmt_name){
+    char text[256];
+    ring_take(text, sizeof(text));
+    if (strcmp(text, expected) != 0){
+        fprintf(stderr, "%s: sciRingVPrintf \"%s\", snprintf \"%s\"\n", fmt_name, text, expected);
+        exit(1);
+    }
+}
+
+static void check_formats(void){
+    static const int32_t  s_signed[] = { 0, 7, -7, 42, -2147483647 - 1, 2147483647, 99, 100, -100, 123456789 };
+    static const uint32_t s_unsigned[] = { 0U, 9U, 10U, 65535U, 4294967295U, 0xDEADBEEFU };
+    char expected[256];
+
+    for (uint32_t i = 0U; i < (sizeof(s_signed) / sizeof(s_signed[0])); i++){
+        int32_t v = s_signed[i];
+        snprintf(expected, sizeof(expected), "%d|%5d|%-5d|%05d|%i", v, v, v, v, v);
+        ring_printf("%d|%5d|%-5d|%05d|%i", v, v, v, v, v);
+        check_same(expected, "signed");
+
+        // A precision is a minimum digit count and overrides the '0' flag, so %08.3d pads like %8.3d
+        snprintf(expected, sizeof(expected), "%.3d|%8.4d|%-8.3d|%8.3d|%.0d|", v, v, v, v, v);
+        ring_printf("%.3d|%8.4d|%-8.3d|%08.3d|%.0d|", v, v, v, v, v);
+        check_same(expected, "signed precision");
+
+        // %.3k is v / 1000 with three places, snprintf needs the split done by hand
+        int64_t  wide = v;
+        uint64_t mag = (uint64_t)((wide < 0) ? -wide : wide);
+        snprintf(expected, sizeof(expected), "%s%llu.%03llu", (wide < 0) ? "-" : "",
+                 (unsigned long long)(mag / 1000U), (unsigned long long)(mag % 1000U));
+        ring_printf("%.3k", v);
+        check_same(expected, "fixed-point");
+    }
+    for (uint32_t i = 0U; i < (sizeof(s_unsigned) / sizeof(s_unsigned[0])); i++){
+        uint32_t v = s_unsigned[i];
+        snprintf(expected, sizeof(expected), "%u|%x|%X|%08x|%-10u|", v, v, v, v, v);
+        ring_printf("%u|%x|%X|%08x|%-10u|", v, v, v, v, v);
+        check_same(expected, "unsigned");
+
+        snprintf(expected, sizeof(expected), "%.3u|%.5x|%.0X|%6.2u|%.12x", v, v, v, v, v);
+        ring_printf("%.3u|%.5x|%.0X|%06.2u|%.12x", v, v, v, v, v);
+        check_same(expected, "unsigned precision");
+    }
+    snprintf(expected, sizeof(expected), "[%s][%8s][%-8s][%.3s][%c][%%]", "uart", "tx", "rx", "truncate", 'k');
+    ring_printf("[%s][%8s][%-8s][%.3s][%c][%%]", "uart", "tx", "rx", "truncate", 'k');
+    check_same(expected, "string");
+}
+
+int main(void){
+    char     text[256];
+    uint32_t sink = 0U;
+
+    CHECK(sciRingInit(&s_ring, s_storage, sizeof(s_storage)));
+    check_formats();
+
+    double start = now_ns();
+    for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++){
+        sink += (uint32_t)snprintf(text, sizeof(text), "id=%d len=%u crc=0x%08x port=%s t=%d.%03d\n",
+                                   (int)i - 1000, i, i * 2654435761U, "SCI1", (int)(i / 1000U), (int)(i % 1000U));
+    }
+    double libc_ns = (now_ns() - start) / BENCH_ITERATIONS;
+
+    start = now_ns();
+    for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++){
+        sink += ring_printf("id=%d len=%u crc=0x%08x port=%s t=%.3k\n", (int32_t)i - 1000, i, i * 2654435761U, "SCI1", (int32_t)i);
+        // Keeps the ring from filling up, as the TX interrupt would
+        sciRingConsume(&s_ring, sciRingUsed(&s_ring));
+    }
+    double ring_ns = (now_ns() - start) / BENCH_ITERATIONS;
+
+    printf("snprintf       %7.1f ns/line\n", libc_ns);
+    printf("sciRingVPrintf %7.1f ns/line (%.2fx)\n", ring_ns, libc_ns / ring_ns);
+    return (sink == 0U);
+}
@@ -0,0 +1,45 @@
+#ifndef FAKE_SCI_H
+#define FAKE_SCI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+/** @brief Register words per fake instance, covers the whole SCI/LIN frame. */
+#define FAKE_SCI_NUM_OF_REGS    (0x100U / sizeof(tms570_reg))
+
+/** @brief Register base of fake instance n, use wherever the driver takes sci_lin_reg. */
+#define FAKE_SCI(n)             (&g_fakeSci[(n)][0])
+
+/**
+ * Host stand-in for the parts of sci_lin_utilc.c the modules under test
+ * call: plain memory instead of the peripheral, so write-1 registers read
+ * back the last word stored.
+ */
+extern tms570_reg g_fakeSci[SCI_LIN_NUM_OF_INSTANCES][FAKE_SCI_NUM_OF_REGS];
+
+/**
+ * @brief Clear the registers, refill hooks and counters of every fake instance.
+ */
+void fakeSciReset(void);
+
+/**
+ * @brief Run the installed refill hook once, as the TX interrupt does at the end of a chunk.
+ *
+ * @param[in] index Instance index.
+ * @param[out] data Pointer to store the next chunk.
+ * @param[out] length Pointer to store its length.
+ * @return true if a chunk was supplied, false if TX would stop or no hook is installed.
+ */
+bool fakeSciRefill(uint32_t index, const uint8_t** data, uint32_t* length);
+
+/**
+ * @brief Get the number of sciKickTx() calls on an instance since fakeSciReset().
+ *
+ * @param[in] index Instance index.
+ * @return Number of kicks.
+ */
+uint32_t fakeSciKicks(uint32_t index);
+
+#endif // FAKE_SCI_H
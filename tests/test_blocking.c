@@ -0,0 +1,114 @@
+/*
+ * Blocking I/O on the pthread port: a writer task pushes more than the TX
+ * ring holds, a reader task waits for more than the RX ring holds, and an
+ * "interrupt" thread moves bytes from the TX refill hook back into the RX
+ * handler one at a time, so both tasks have to sleep and be woken.
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include "check.h"
+#include "fake_sci.h"
+#include "sci_blocking.h"
+#include "sci_isr.h"
+#include "sci_os.h"
+#include "sci_ring.h"
+
+#define LOOP_BYTES      (3000U)
+
+static sci_isr_handler_t s_rxHandler;
+static pthread_mutex_t   s_interrupts = PTHREAD_MUTEX_INITIALIZER;
+static atomic_bool       s_stop;
+static uint8_t           s_out[LOOP_BYTES];
+static uint8_t           s_in[LOOP_BYTES];
+static bool              s_readOk;
+static uint32_t          s_readCount;
+
+/* Replaces sci_isr.c: the loopback thread delivers the RX interrupt itself. */
+bool sciIsrRegisterHandler(volatile tms570_reg* sci_lin_reg, uint8_t vector, sci_isr_handler_t handler){
+    CHECK(sci_lin_reg == FAKE_SCI(0));
+    CHECK(vector == SCI_INT_VECTOR_RX);
+    s_rxHandler = handler;
+    return (true);
+}
+
+static void sleep_us(uint32_t us){
+    struct timespec delay = { 0, (long)us * 1000L };
+    nanosleep(&delay, NULL);
+}
+
+/* TX and RX interrupts of a wire looped back onto itself; holding the mutex stands for running in the ISR. */
+static void* loopback(void* arg){
+    (void)arg;
+    while (!atomic_load(&s_stop)){
+        const uint8_t* data;
+        uint32_t       length;
+        uint8_t        chunk[256];
+
+        pthread_mutex_lock(&s_interrupts);
+        bool more = fakeSciRefill(0U, &data, &length);
+        if (more){
+            length = (length < sizeof(chunk)) ? length : sizeof(chunk);
+            memcpy(chunk, data, length);
+        }
+        pthread_mutex_unlock(&s_interrupts);
+        if (!more){
+            sleep_us(100U);
+            continue;
+        }
+
+        for (uint32_t i = 0U; i < length; i++){
+            sleep_us(10U);
+            pthread_mutex_lock(&s_interrupts);
+            FAKE_SCI(0)[TMS570_SCI_RD] = chunk[i];
+            s_rxHandler(FAKE_SCI(0), SCI_INT_VECTOR_RX);
+            pthread_mutex_unlock(&s_interrupts);
+        }
+    }
+    return (NULL);
+}
+
+static void* reader(void* arg){
+    (void)arg;
+    s_readOk = sciBlockingRead(FAKE_SCI(0), s_in, sizeof(s_in), SCI_OS_WAIT_FOREVER, &s_readCount);
+    return (NULL);
+}
+
+int main(void){
+    static uint8_t tx_buffer[64];
+    static uint8_t rx_buffer[128];
+    pthread_t      loopback_thread;
+    pthread_t      reader_thread;
+    uint32_t       count;
+    uint8_t        byte;
+
+    for (uint32_t i = 0U; i < LOOP_BYTES; i++){
+        s_out[i] = (uint8_t)((i * 7U) + 3U);
+    }
+    fakeSciReset();
+    CHECK(sciOsInit());
+    CHECK(sciTxRingInit(FAKE_SCI(0), tx_buffer, sizeof(tx_buffer)));
+    CHECK(sciRxRingInit(FAKE_SCI(0), rx_buffer, sizeof(rx_buffer)));
+    CHECK(sciBlockingInit(FAKE_SCI(0)));
+
+    CHECK(pthread_create(&loopback_thread, NULL, loopback, NULL) == 0);
+    CHECK(pthread_create(&reader_thread, NULL, reader, NULL) == 0);
+
+    CHECK(sciBlockingWrite(FAKE_SCI(0), s_out, sizeof(s_out), 10000000U, &count));
+    CHECK(count == LOOP_BYTES);
+    CHECK(sciBlockingFlush(FAKE_SCI(0), 2000000U));
+    CHECK(pthread_join(reader_thread, NULL) == 0);
+    CHECK(s_readOk && (s_readCount == LOOP_BYTES));
+    CHECK(memcmp(s_in, s_out, sizeof(s_in)) == 0);
+
+    // Nothing more on the wire: a bounded read times out empty
+    CHECK(!sciBlockingRead(FAKE_SCI(0), &byte, 1U, 20000U, &count));
+    CHECK(count == 0U);
+
+    atomic_store(&s_stop, true);
+    CHECK(pthread_join(loopback_thread, NULL) == 0);
+    printf("%u bytes looped back through %u-byte TX and %u-byte RX rings\n", LOOP_BYTES, (unsigned)sizeof(tx_buffer), (unsigned)sizeof(rx_buffer));
+    return (0);
+}
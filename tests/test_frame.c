@@ -0,0 +1,158 @@
+/*
+ * COBS and SLIP round trip through sci_frame: edge-case payloads are encoded
+ * into a ring, checked against their known encoding, and the concatenated
+ * stream is decoded split at every offset and byte by byte.
+ */
+#include <string.h>
+#include "check.h"
+#include "sci_frame.h"
+#include "sci_isr.h"
+#include "sci_ring.h"
+
+#define NUM_OF_PAYLOADS     (6U)
+#define STREAM_SIZE         (4096U)
+
+typedef struct payload_s {
+    uint8_t  data[300];     /** Payload bytes */
+    uint32_t length;        /** Payload length */
+} payload_t;
+
+static payload_t s_payloads[NUM_OF_PAYLOADS];
+static uint32_t  s_received;
+static bool      s_mismatch;
+
+/* Replaces sci_isr.c: only free-standing rings are used here, no instance is attached. */
+bool sciIsrRegisterHandler(volatile tms570_reg* sci_lin_reg, uint8_t vector, sci_isr_handler_t handler){
+    (void)sci_lin_reg;
+    (void)vector;
+    (void)handler;
+    return (false);
+}
+
+static void received(void* context, const uint8_t* data, uint32_t length){
+    (void)context;
+    if ((s_received >= NUM_OF_PAYLOADS) || (length != s_payloads[s_received].length) ||
+        (memcmp(data, s_payloads[s_received].data, length) != 0)){
+        s_mismatch = true;
+    }
+    s_received++;
+}
+
+static void set_payload(uint32_t index, const uint8_t* data, uint32_t length){
+    memcpy(s_payloads[index].data, data, length);
+    s_payloads[index].length = length;
+}
+
+/* Encodes one payload and returns its encoding in out. */
+static uint32_t encode(sci_frame_type_t type, const uint8_t* data, uint32_t length, uint8_t* out){
+    static uint8_t buffer[1024];
+    sci_ring_t     ring;
+
+    CHECK(sciRingInit(&ring, buffer, sizeof(buffer)));
+    CHECK(sciFrameEncode(&ring, type, data, length));
+    uint32_t encoded = sciRingRead(&ring, out, sizeof(buffer));
+    CHECK(encoded <= sciFrameMaxEncodedLength(type, length));
+    return (encoded);
+}
+
+static void check_round_trip(sci_frame_type_t type){
+    static uint8_t stream[STREAM_SIZE];
+    uint8_t        buffer[300];
+    uint32_t       length = 0U;
+    sci_frame_decoder_t decoder;
+
+    for (uint32_t i = 0U; i < NUM_OF_PAYLOADS; i++){
+        length += encode(type, s_payloads[i].data, s_payloads[i].length, &stream[length]);
+        CHECK(length < (STREAM_SIZE - 1024U));
+    }
+
+    for (uint32_t split = 0U; split <= length; split++){
+        s_received = 0U;
+        s_mismatch = false;
+        CHECK(sciFrameDecoderInit(&decoder, type, buffer, sizeof(buffer), received, NULL));
+        uint32_t delivered = sciFrameDecode(&decoder, stream, split);
+        delivered += sciFrameDecode(&decoder, &stream[split], length - split);
+        CHECK((delivered == NUM_OF_PAYLOADS) && (s_received == NUM_OF_PAYLOADS) && !s_mismatch);
+        CHECK(decoder.dropped == 0U);
+    }
+
+    s_received = 0U;
+    s_mismatch = false;
+    CHECK(sciFrameDecoderInit(&decoder, type, buffer, sizeof(buffer), received, NULL));
+    for (uint32_t i = 0U; i < length; i++){
+        (void)sciFrameDecode(&decoder, &stream[i], 1U);
+    }
+    CHECK((s_received == NUM_OF_PAYLOADS) && !s_mismatch);
+}
+
+int main(void){
+    uint8_t  run[256];
+    uint8_t  encoded[1024];
+    uint8_t  ring_buffer[64];
+    uint32_t length;
+    sci_ring_t ring;
+
+    for (uint32_t i = 0U; i < sizeof(run); i++){
+        run[i] = (uint8_t)((i % 255U) + 1U);
+    }
+
+    // Trailing zero: the last block is empty
+    static const uint8_t trailing_zero[] = { 0x11, 0x22, 0x00 };
+    static const uint8_t trailing_zero_cobs[] = { 0x03, 0x11, 0x22, 0x01, 0x00 };
+    length = encode(SCI_FRAME_COBS, trailing_zero, sizeof(trailing_zero), encoded);
+    CHECK((length == sizeof(trailing_zero_cobs)) && (memcmp(encoded, trailing_zero_cobs, length) == 0));
+    set_payload(0U, trailing_zero, sizeof(trailing_zero));
+
+    // 254 non-zero bytes fill one block exactly, with no implied zero after it
+    length = encode(SCI_FRAME_COBS, run, 254U, encoded);
+    CHECK((length == 256U) && (encoded[0] == 0xFFU) && (memcmp(&encoded[1], run, 254U) == 0) && (encoded[255] == 0x00U));
+    set_payload(1U, run, 254U);
+
+    // A zero right after a full block starts an empty block
+    run[254] = 0x00U;
+    run[255] = 0x05U;
+    length = encode(SCI_FRAME_COBS, run, 256U, encoded);
+    CHECK((length == 259U) && (encoded[0] == 0xFFU));
+    CHECK((encoded[255] == 0x01U) && (encoded[256] == 0x02U) && (encoded[257] == 0x05U) && (encoded[258] == 0x00U));
+    set_payload(2U, run, 256U);
+
+    // A single zero
+    static const uint8_t zero[] = { 0x00 };
+    static const uint8_t zero_cobs[] = { 0x01, 0x01, 0x00 };
+    length = encode(SCI_FRAME_COBS, zero, sizeof(zero), encoded);
+    CHECK((length == sizeof(zero_cobs)) && (memcmp(encoded, zero_cobs, length) == 0));
+    set_payload(3U, zero, sizeof(zero));
+
+    // SLIP: both special bytes escaped, their escape codes passed through
+    static const uint8_t slip[] = { 0xC0, 0x01, 0xDB, 0xDC, 0xDD };
+    static const uint8_t slip_encoded[] = { 0xC0, 0xDB, 0xDC, 0x01, 0xDB, 0xDD, 0xDC, 0xDD, 0xC0 };
+    length = encode(SCI_FRAME_SLIP, slip, sizeof(slip), encoded);
+    CHECK((length == sizeof(slip_encoded)) && (memcmp(encoded, slip_encoded, length) == 0));
+    set_payload(4U, slip, sizeof(slip));
+
+    // A longer run with special bytes spread through it
+    for (uint32_t i = 0U; i < 200U; i++){
+        run[i] = (uint8_t)(i * 37U);
+    }
+    set_payload(5U, run, 200U);
+
+    check_round_trip(SCI_FRAME_COBS);
+    check_round_trip(SCI_FRAME_SLIP);
+
+    // An empty frame cannot be told apart from back-to-back delimiters, so it is refused
+    CHECK(sciRingInit(&ring, ring_buffer, sizeof(ring_buffer)));
+    CHECK(!sciFrameEncode(&ring, SCI_FRAME_COBS, trailing_zero, 0U));
+    CHECK(!sciFrameEncode(&ring, SCI_FRAME_SLIP, trailing_zero, 0U));
+    CHECK(sciRingUsed(&ring) == 0U);
+
+    // A frame cut short by a delimiter is dropped, the next one still arrives
+    static const uint8_t cut[] = { 0x04, 0x11, 0x00, 0x03, 0x11, 0x22, 0x01, 0x00 };
+    sci_frame_decoder_t decoder;
+    uint8_t             buffer[16];
+    s_received = 0U;
+    s_mismatch = false;
+    CHECK(sciFrameDecoderInit(&decoder, SCI_FRAME_COBS, buffer, sizeof(buffer), received, NULL));
+    CHECK(sciFrameDecode(&decoder, cut, sizeof(cut)) == 1U);
+    CHECK((decoder.dropped == 1U) && !s_mismatch);
+    return (0);
+}
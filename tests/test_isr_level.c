@@ -0,0 +1,42 @@
+/* Final SET_INT_LVL/CLEAR_INT_LVL words written by sciIsrApplyLevelPolicy(). */
+#include "check.h"
+#include "fake_sci.h"
+#include "sci_isr.h"
+
+#define UNTOUCHED   (0xA5A5A5A5U)
+
+int main(void){
+    sci_int_level_policy_t policy = {
+        .apply = { true, false, true },
+        .line0_sources = { SCI_INT_SOURCE_RX | SCI_INT_SOURCE_ID, SCI_INT_SOURCE_LATENCY_CRITICAL, SCI_INT_SOURCE_LATENCY_CRITICAL },
+    };
+
+    fakeSciReset();
+    for (uint32_t index = 0U; index < SCI_LIN_NUM_OF_INSTANCES; index++){
+        FAKE_SCI(index)[TMS570_SCI_SET_INT_LVL] = UNTOUCHED;
+        FAKE_SCI(index)[TMS570_SCI_CLEAR_INT_LVL] = UNTOUCHED;
+    }
+    CHECK(sciIsrApplyLevelPolicy(&policy));
+
+    // SCI1: RX (bit 9) and ID (bit 13) on INT0, every other implemented source on INT1
+    CHECK(FAKE_SCI(0)[TMS570_SCI_CLEAR_INT_LVL] == 0x00002200U);
+    CHECK(FAKE_SCI(0)[TMS570_SCI_SET_INT_LVL] == 0xFF0401D3U);
+
+    // SCI2 is not applied
+    CHECK(FAKE_SCI(1)[TMS570_SCI_CLEAR_INT_LVL] == UNTOUCHED);
+    CHECK(FAKE_SCI(1)[TMS570_SCI_SET_INT_LVL] == UNTOUCHED);
+
+    // SCI3: TX (bit 8) joins RX and ID
+    CHECK(FAKE_SCI(2)[TMS570_SCI_CLEAR_INT_LVL] == 0x00002300U);
+    CHECK(FAKE_SCI(2)[TMS570_SCI_SET_INT_LVL] == 0xFF0400D3U);
+
+    // Bits outside the implemented sources are never written
+    policy.apply[2] = false;
+    policy.line0_sources[0] = 0x00000004U | SCI_INT_SOURCE_PE;
+    CHECK(sciIsrApplyLevelPolicy(&policy));
+    CHECK(FAKE_SCI(0)[TMS570_SCI_CLEAR_INT_LVL] == 0x01000000U);
+    CHECK(FAKE_SCI(0)[TMS570_SCI_SET_INT_LVL] == 0xFE0423D3U);
+
+    CHECK(!sciIsrApplyLevelPolicy(NULL));
+    return (0);
+}
@@ -0,0 +1,92 @@
+/*
+ * Bandwidth shaping of sci_lane: frames are pulled through the TX refill
+ * hook like the TX interrupt does, with the control lane kept saturated.
+ */
+#include "check.h"
+#include "fake_sci.h"
+#include "sci_lane.h"
+
+#define FRAME_LEN       (8U)
+#define ROUNDS          (200U)
+
+static uint8_t s_frame[FRAME_LEN];
+static uint8_t s_normal[FRAME_LEN];
+
+/* Keeps control and bulk full and hands 8 frames to the transmitter per round. */
+static void run_saturated(uint32_t rounds){
+    const uint8_t* data;
+    uint32_t       length;
+
+    for (uint32_t round = 0U; round < rounds; round++){
+        while (sciSendPriority(FAKE_SCI(0), SCI_LANE_CONTROL, FRAME_LEN, s_frame)){
+        }
+        while (sciSendPriority(FAKE_SCI(0), SCI_LANE_BULK, FRAME_LEN, s_frame)){
+        }
+        for (uint32_t i = 0U; i < 8U; i++){
+            CHECK(fakeSciRefill(0U, &data, &length));
+            CHECK(length == FRAME_LEN);
+        }
+    }
+}
+
+static void drain(void){
+    const uint8_t* data;
+    uint32_t       length;
+
+    while (fakeSciRefill(0U, &data, &length)){
+    }
+    for (uint32_t lane = 0U; lane < NUM_OF_SCI_LANE; lane++){
+        CHECK(sciLaneIsIdle(FAKE_SCI(0), (sci_lane_t)lane));
+    }
+}
+
+int main(void){
+    const sci_lane_config_t bulk_quarter = { { 0U, 0U, 250U } };
+    const sci_lane_config_t normal_full = { { 0U, 1000U, 0U } };
+    sci_lane_stats_t        control;
+    sci_lane_stats_t        bulk;
+    const uint8_t*          data;
+    uint32_t                length;
+
+    fakeSciReset();
+
+    // 250 permille: bulk is owed a quarter of the control bytes, one frame in five
+    CHECK(sciLaneInit(FAKE_SCI(0), &bulk_quarter));
+    run_saturated(ROUNDS);
+    CHECK(sciLaneGetStats(FAKE_SCI(0), SCI_LANE_CONTROL, &control));
+    CHECK(sciLaneGetStats(FAKE_SCI(0), SCI_LANE_BULK, &bulk));
+    CHECK((control.frames + bulk.frames) == (8U * ROUNDS));
+    CHECK(bulk.frames == ((8U * ROUNDS) / 5U));
+    CHECK(bulk.shaped_frames == bulk.frames);
+    CHECK(control.shaped_frames == 0U);
+    CHECK(bulk.bytes == (bulk.frames * FRAME_LEN));
+
+    uint32_t histogram = 0U;
+    for (uint32_t bucket = 0U; bucket < SCI_STATS_HIST_BUCKETS; bucket++){
+        histogram += bulk.latency_cycles[bucket];
+    }
+    CHECK(histogram == bulk.frames);
+    drain();
+
+    // Strict priority: bulk starves while control has frames
+    CHECK(sciLaneInit(FAKE_SCI(0), NULL));
+    run_saturated(ROUNDS / 4U);
+    CHECK(sciLaneGetStats(FAKE_SCI(0), SCI_LANE_BULK, &bulk));
+    CHECK(bulk.frames == 0U);
+    drain();
+    CHECK(sciLaneGetStats(FAKE_SCI(0), SCI_LANE_BULK, &bulk));
+    CHECK(bulk.frames != 0U);
+
+    // A huge frame owes length * 1000 byte-permille, which must saturate rather than wrap:
+    // 4294968 * 1000 wraps to 704, less than the 8000 an 8-byte frame costs
+    CHECK(sciLaneInit(FAKE_SCI(0), &normal_full));
+    CHECK(sciSendPriority(FAKE_SCI(0), SCI_LANE_CONTROL, 4294968U, s_frame));
+    CHECK(sciSendPriority(FAKE_SCI(0), SCI_LANE_CONTROL, FRAME_LEN, s_frame));
+    CHECK(sciSendPriority(FAKE_SCI(0), SCI_LANE_NORMAL, FRAME_LEN, s_normal));
+    CHECK(fakeSciRefill(0U, &data, &length) && (length == 4294968U));
+    CHECK(fakeSciRefill(0U, &data, &length) && (data == s_normal));
+    drain();
+
+    printf("bulk %u of %u frames at 250 permille\n", (unsigned)((8U * ROUNDS) / 5U), 8U * ROUNDS);
+    return (0);
+}
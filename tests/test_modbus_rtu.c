@@ -0,0 +1,221 @@
+/*
+ * Modbus RTU slave against a master stand-in: requests are fed byte by byte
+ * through the RX handler the slave registers, responses are pulled through
+ * the TX refill hook and checked like a master would. Time only advances
+ * when the test says so, through a stand-in for the host cycle counter.
+ */
+#include <string.h>
+#include "check.h"
+#include "fake_sci.h"
+#include "modbus_rtu.h"
+#include "sci_crc.h"
+#include "sci_cycle.h"
+#include "sci_isr.h"
+#include "uart_config.h"
+
+#define SLAVE_ADDRESS   (0x11U)
+
+static sci_isr_handler_t s_rxHandler;
+static uint16_t          s_holding[8];
+static uint32_t          s_now;
+
+/* Replaces sci_isr.c: the test delivers the RX interrupt itself. */
+bool sciIsrRegisterHandler(volatile tms570_reg* sci_lin_reg, uint8_t vector, sci_isr_handler_t handler){
+    CHECK(sci_lin_reg == FAKE_SCI(0));
+    CHECK(vector == SCI_INT_VECTOR_RX);
+    s_rxHandler = handler;
+    return (true);
+}
+
+/* Replaces sci_cycle.c: the clock stands still until advance_us() moves it. */
+uint32_t sciCycleHostNow(void){
+    return (s_now);
+}
+
+static void advance_us(uint32_t us){
+    s_now += us * SCI_CYCLE_PER_US;
+}
+
+static bool holding_read(void* context, uint16_t offset, uint16_t count, uint8_t* data){
+    (void)context;
+    for (uint16_t i = 0U; i < count; i++){
+        data[2U * i] = (uint8_t)(s_holding[offset + i] >> 8);
+        data[(2U * i) + 1U] = (uint8_t)s_holding[offset + i];
+    }
+    return (true);
+}
+
+static bool holding_write(void* context, uint16_t offset, uint16_t count, const uint8_t* data){
+    (void)context;
+    for (uint16_t i = 0U; i < count; i++){
+        s_holding[offset + i] = (uint16_t)((data[2U * i] << 8) | data[(2U * i) + 1U]);
+    }
+    return (true);
+}
+
+static bool input_fail(void* context, uint16_t offset, uint16_t count, uint8_t* data){
+    (void)context;
+    (void)offset;
+    (void)count;
+    (void)data;
+    return (false);
+}
+
+static const modbus_rtu_range_t s_holdingRanges[] = {
+    { 0x0100U, 8U, holding_read, holding_write, NULL },
+};
+
+static const modbus_rtu_range_t s_inputRanges[] = {
+    { 0x0000U, 4U, input_fail, NULL, NULL },
+};
+
+static const modbus_rtu_map_t s_map = { s_holdingRanges, 1U, s_inputRanges, 1U };
+
+static void master_byte(uint8_t byte){
+    FAKE_SCI(0)[TMS570_SCI_RD] = byte;
+    s_rxHandler(FAKE_SCI(0), SCI_INT_VECTOR_RX);
+}
+
+/* Sends the frame with its CRC appended, corrupted if asked to. */
+static void master_send(const uint8_t* pdu, uint32_t length, bool bad_crc){
+    uint16_t crc = sciCrc16ModbusUpdate(SCI_CRC16_MODBUS_INIT, pdu, length);
+
+    if (bad_crc){
+        crc ^= 0x0100U;
+    }
+    for (uint32_t i = 0U; i < length; i++){
+        master_byte(pdu[i]);
+    }
+    master_byte((uint8_t)crc);
+    master_byte((uint8_t)(crc >> 8));
+}
+
+/* Lets t3.5 pass, runs the slave and collects its response; returns the length without CRC, 0 for none. */
+static uint32_t master_receive(uint8_t* response){
+    const uint8_t* data;
+    uint32_t       length;
+    uint32_t       total = 0U;
+
+    // t3.5 is 1750 us at the default baud rate
+    CHECK(!modbusRtuProcess(FAKE_SCI(0)));
+    advance_us(1749U);
+    CHECK(!modbusRtuProcess(FAKE_SCI(0)));
+    advance_us(1U);
+    CHECK(modbusRtuProcess(FAKE_SCI(0)));
+    while (fakeSciRefill(0U, &data, &length)){
+        memcpy(&response[total], data, length);
+        total += length;
+    }
+    if (total == 0U){
+        return (0U);
+    }
+    CHECK(total >= 4U);
+    CHECK(sciCrc16ModbusUpdate(SCI_CRC16_MODBUS_INIT, response, total) == 0U);
+    return (total - 2U);
+}
+
+int main(void){
+    uint8_t            response[MODBUS_RTU_MAX_FRAME_LEN];
+    modbus_rtu_stats_t stats;
+
+    fakeSciReset();
+    CHECK(modbusRtuInit(FAKE_SCI(0), SLAVE_ADDRESS, &s_map));
+    CHECK(s_rxHandler != NULL);
+    CHECK(!modbusRtuProcess(FAKE_SCI(0)));
+
+    // Write multiple registers 0x0101-0x0102, the response echoes address and quantity
+    static const uint8_t write_multiple[] = { SLAVE_ADDRESS, 0x10, 0x01, 0x01, 0x00, 0x02, 0x04, 0x12, 0x34, 0xAB, 0xCD };
+    master_send(write_multiple, sizeof(write_multiple), false);
+    CHECK(master_receive(response) == 6U);
+    CHECK(memcmp(response, write_multiple, 6U) == 0);
+    CHECK((s_holding[1] == 0x1234U) && (s_holding[2] == 0xABCDU));
+
+    // Read them back with read holding registers
+    static const uint8_t read_holding[] = { SLAVE_ADDRESS, 0x03, 0x01, 0x00, 0x00, 0x03 };
+    static const uint8_t read_reply[] = { SLAVE_ADDRESS, 0x03, 0x06, 0x00, 0x00, 0x12, 0x34, 0xAB, 0xCD };
+    master_send(read_holding, sizeof(read_holding), false);
+    CHECK(master_receive(response) == sizeof(read_reply));
+    CHECK(memcmp(response, read_reply, sizeof(read_reply)) == 0);
+
+    // Write single register, the response echoes the request
+    static const uint8_t write_single[] = { SLAVE_ADDRESS, 0x06, 0x01, 0x07, 0xBE, 0xEF };
+    master_send(write_single, sizeof(write_single), false);
+    CHECK(master_receive(response) == sizeof(write_single));
+    CHECK(memcmp(response, write_single, sizeof(write_single)) == 0);
+    CHECK(s_holding[7] == 0xBEEFU);
+
+    // Exceptions: unknown function, unmapped address, handler failure
+    static const uint8_t bad_function[] = { SLAVE_ADDRESS, 0x2B, 0x0E, 0x01 };
+    master_send(bad_function, sizeof(bad_function), false);
+    CHECK(master_receive(response) == 3U);
+    CHECK((response[1] == 0xABU) && (response[2] == MODBUS_RTU_EXCEPTION_ILLEGAL_FUNCTION));
+
+    static const uint8_t bad_address[] = { SLAVE_ADDRESS, 0x03, 0x01, 0x06, 0x00, 0x03 };
+    master_send(bad_address, sizeof(bad_address), false);
+    CHECK(master_receive(response) == 3U);
+    CHECK((response[1] == 0x83U) && (response[2] == MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS));
+
+    static const uint8_t read_input[] = { SLAVE_ADDRESS, 0x04, 0x00, 0x00, 0x00, 0x01 };
+    master_send(read_input, sizeof(read_input), false);
+    CHECK(master_receive(response) == 3U);
+    CHECK((response[1] == 0x84U) && (response[2] == MODBUS_RTU_EXCEPTION_DEVICE_FAILURE));
+
+    // Broadcast writes execute without a response, other slaves and bad CRCs are ignored
+    static const uint8_t broadcast[] = { MODBUS_RTU_BROADCAST_ADDRESS, 0x06, 0x01, 0x00, 0x55, 0xAA };
+    master_send(broadcast, sizeof(broadcast), false);
+    CHECK(master_receive(response) == 0U);
+    CHECK(s_holding[0] == 0x55AAU);
+
+    // A failing broadcast is not answered, so it is not counted as an exception either
+    static const uint8_t broadcast_bad[] = { MODBUS_RTU_BROADCAST_ADDRESS, 0x2B, 0x0E, 0x01 };
+    master_send(broadcast_bad, sizeof(broadcast_bad), false);
+    CHECK(master_receive(response) == 0U);
+
+    static const uint8_t other_slave[] = { SLAVE_ADDRESS + 1U, 0x06, 0x01, 0x00, 0x00, 0x00 };
+    master_send(other_slave, sizeof(other_slave), false);
+    CHECK(master_receive(response) == 0U);
+
+    master_send(write_single, sizeof(write_single), true);
+    CHECK(master_receive(response) == 0U);
+
+    // Bytes arriving while the response is still in flight are dropped, the response is not disturbed
+    const uint8_t* data;
+    uint32_t       length;
+    master_send(write_single, sizeof(write_single), false);
+    advance_us(1750U);
+    FAKE_SCI(0)[TMS570_SCI_SET_INT] = 0U;
+    CHECK(modbusRtuProcess(FAKE_SCI(0)));
+    // RX (bit 9) was masked only around the t3.5 check
+    CHECK(FAKE_SCI(0)[TMS570_SCI_CLEAR_INT] == 0x00000200U);
+    CHECK(FAKE_SCI(0)[TMS570_SCI_SET_INT] == 0x00000200U);
+    master_byte(0x00U);
+    CHECK(fakeSciRefill(0U, &data, &length));
+    CHECK((length == (sizeof(write_single) + 2U)) && (memcmp(data, write_single, sizeof(write_single)) == 0));
+    CHECK(!fakeSciRefill(0U, &data, &length));
+
+    // 1200 baud: t1.5 is 13.75 ms and t3.5 32 ms, so a 20 ms pause inside a frame is a gap error
+    FAKE_SCI(0)[TMS570_SCI_BRS] = (VCLK_FREQ / (16U * 1200U)) - 1U;
+    CHECK(modbusRtuUpdateTiming(FAKE_SCI(0)));
+    master_byte(SLAVE_ADDRESS);
+    advance_us(20000U);
+    for (uint32_t i = 1U; i < sizeof(read_holding); i++){
+        master_byte(read_holding[i]);
+    }
+    master_byte(0x00U);
+    master_byte(0x00U);
+    CHECK(!modbusRtuProcess(FAKE_SCI(0)));
+    advance_us(31000U);
+    CHECK(!modbusRtuProcess(FAKE_SCI(0)));
+    advance_us(2000U);
+    CHECK(modbusRtuProcess(FAKE_SCI(0)));
+    CHECK(!fakeSciRefill(0U, &data, &length));
+
+    CHECK(modbusRtuGetStats(FAKE_SCI(0), &stats));
+    CHECK(stats.frames == 9U);
+    CHECK(stats.exceptions == 3U);
+    CHECK(stats.crc_errors == 1U);
+    CHECK(stats.gap_errors == 1U);
+    CHECK(stats.overruns == 1U);
+    printf("%u frames, %u exceptions\n", stats.frames, stats.exceptions);
+    return (0);
+}
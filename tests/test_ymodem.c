@@ -0,0 +1,221 @@
+/*
+ * YMODEM-1K receive against a simulated sender: blocks are delivered byte by
+ * byte through the RX ring interrupt handler while an asynchronous flash
+ * backend stays busy for a while after every program(), so blocks arrive
+ * while the previous one is still being written. One data block is
+ * corrupted and the first EOT is NAKed, as the protocol requires.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "fake_sci.h"
+#include "sci_crc.h"
+#include "sci_isr.h"
+#include "sci_ring.h"
+#include "sci_ymodem.h"
+
+#define IMAGE_SIZE          (3000U)
+#define FLASH_BUSY_POLLS    (5U)
+
+/* Sender states, advanced by the receiver's replies. */
+typedef enum sender_state_e {
+    SENDER_WAIT_HEADER_REQUEST = 0,     /** Waiting for 'C' to send block 0 */
+    SENDER_WAIT_HEADER_ACK,             /** Block 0 sent */
+    SENDER_WAIT_DATA_REQUEST,           /** Waiting for 'C' to start the data */
+    SENDER_WAIT_DATA_ACK,               /** Data block sent */
+    SENDER_WAIT_EOT_NAK,                /** First EOT sent, a NAK is expected */
+    SENDER_WAIT_EOT_ACK,                /** Second EOT sent */
+    SENDER_WAIT_END_REQUEST,            /** Waiting for 'C' to send the null header */
+    SENDER_WAIT_END_ACK,                /** Null header sent */
+    SENDER_FINISHED                     /** Batch closed */
+} sender_state_t;
+
+static sci_isr_handler_t s_rxHandler;
+static bool              s_registerFails;
+static uint8_t           s_replies[64];
+static uint32_t          s_replyCount;
+
+static uint8_t  s_image[IMAGE_SIZE];
+static uint8_t  s_flash[4U * SCI_YMODEM_BLOCK_1K];
+static uint32_t s_flashEnd;
+static uint32_t s_flashBusy;
+static uint32_t s_flashOverlaps;
+static uint32_t s_beginSize;
+static char     s_beginName[16];
+
+/* Replaces sci_isr.c: the test delivers the RX interrupt itself. */
+bool sciIsrRegisterHandler(volatile tms570_reg* sci_lin_reg, uint8_t vector, sci_isr_handler_t handler){
+    CHECK(sci_lin_reg == FAKE_SCI(0));
+    CHECK(vector == SCI_INT_VECTOR_RX);
+    if (s_registerFails){
+        return (false);
+    }
+    s_rxHandler = handler;
+    return (true);
+}
+
+/* Replaces the polled transmitter of sci_lin_utilc.c: replies are collected for the sender. */
+bool sciSendDeadline(volatile tms570_reg* sci_lin_reg, uint32_t length, const uint8_t* data, uint32_t deadline, uint32_t* sent){
+    (void)deadline;
+    CHECK(sci_lin_reg == FAKE_SCI(0));
+    CHECK((s_replyCount + length) <= sizeof(s_replies));
+    memcpy(&s_replies[s_replyCount], data, length);
+    s_replyCount += length;
+    *sent = length;
+    return (true);
+}
+
+static bool flash_begin(void* context, const char* name, uint32_t size){
+    (void)context;
+    strncpy(s_beginName, name, sizeof(s_beginName) - 1U);
+    s_beginSize = size;
+    return (true);
+}
+
+static bool flash_program(void* context, uint32_t offset, const uint8_t* data, uint32_t length){
+    (void)context;
+    CHECK(s_flashBusy == 0U);
+    CHECK((offset + length) <= sizeof(s_flash));
+    memcpy(&s_flash[offset], data, length);
+    s_flashEnd = offset + length;
+    s_flashBusy = FLASH_BUSY_POLLS;
+    return (true);
+}
+
+static sci_ymodem_flash_status_t flash_poll(void* context){
+    (void)context;
+    if (s_flashBusy != 0U){
+        s_flashBusy--;
+        return (SCI_YMODEM_FLASH_BUSY);
+    }
+    return (SCI_YMODEM_FLASH_DONE);
+}
+
+static void sender_bytes(const uint8_t* data, uint32_t length){
+    for (uint32_t i = 0U; i < length; i++){
+        FAKE_SCI(0)[TMS570_SCI_RD] = data[i];
+        s_rxHandler(FAKE_SCI(0), SCI_INT_VECTOR_RX);
+    }
+}
+
+static void sender_block(uint8_t number, const uint8_t* payload, uint32_t length, bool corrupt){
+    uint8_t  block[3U + SCI_YMODEM_BLOCK_1K + 2U];
+    uint16_t crc = sciCrc16Update(SCI_CRC16_XMODEM_INIT, payload, length);
+
+    block[0] = (length == SCI_YMODEM_BLOCK_128) ? SCI_YMODEM_SOH : SCI_YMODEM_STX;
+    block[1] = number;
+    block[2] = (uint8_t)~number;
+    memcpy(&block[3], payload, length);
+    block[3U + length] = (uint8_t)(crc >> 8);
+    block[4U + length] = (uint8_t)crc;
+    if (corrupt){
+        block[10] ^= 0x01U;
+    }
+    sender_bytes(block, 5U + length);
+    if (s_flashBusy != 0U){
+        s_flashOverlaps++;
+    }
+}
+
+static void sender_data(uint8_t number, bool corrupt){
+    uint8_t  payload[SCI_YMODEM_BLOCK_1K];
+    uint32_t offset = (uint32_t)(number - 1U) * SCI_YMODEM_BLOCK_1K;
+    uint32_t length = ((IMAGE_SIZE - offset) < SCI_YMODEM_BLOCK_1K) ? (IMAGE_SIZE - offset) : SCI_YMODEM_BLOCK_1K;
+
+    // The last block is padded with SUB
+    memset(payload, 0x1A, sizeof(payload));
+    memcpy(payload, &s_image[offset], length);
+    sender_block(number, payload, sizeof(payload), corrupt);
+}
+
+static void sender_eot(void){
+    static const uint8_t s_eot = SCI_YMODEM_EOT;
+    sender_bytes(&s_eot, 1U);
+}
+
+int main(void){
+    static uint8_t     ring_buffer[2048];
+    static sci_ymodem_t ymodem;
+    const sci_ymodem_flash_t flash = { flash_begin, flash_program, flash_poll, NULL };
+    sender_state_t     state = SENDER_WAIT_HEADER_REQUEST;
+    uint8_t            number = 0U;
+    uint32_t           naks = 0U;
+    bool               corrupted = false;
+    sci_ymodem_status_t status = SCI_YMODEM_STATUS_RUNNING;
+
+    fakeSciReset();
+    for (uint32_t i = 0U; i < IMAGE_SIZE; i++){
+        s_image[i] = (uint8_t)rand();
+    }
+
+    // A failed handler registration leaves no ring behind
+    s_registerFails = true;
+    CHECK(!sciRxRingInit(FAKE_SCI(0), ring_buffer, sizeof(ring_buffer)));
+    CHECK(sciRxRingGet(FAKE_SCI(0)) == NULL);
+    CHECK(!sciYmodemInit(&ymodem, FAKE_SCI(0), &flash));
+
+    s_registerFails = false;
+    CHECK(sciRxRingInit(FAKE_SCI(0), ring_buffer, sizeof(ring_buffer)));
+    CHECK(sciYmodemInit(&ymodem, FAKE_SCI(0), &flash));
+
+    for (uint32_t step = 0U; (step < 100000U) && (status == SCI_YMODEM_STATUS_RUNNING); step++){
+        uint32_t count = s_replyCount;
+
+        s_replyCount = 0U;
+        for (uint32_t i = 0U; i < count; i++){
+            uint8_t reply = s_replies[i];
+
+            if ((state == SENDER_WAIT_HEADER_REQUEST) && (reply == SCI_YMODEM_CRC_REQUEST)){
+                uint8_t header[SCI_YMODEM_BLOCK_128] = "fw.bin\0" "3000 0";
+                sender_block(0U, header, sizeof(header), false);
+                state = SENDER_WAIT_HEADER_ACK;
+            } else if ((state == SENDER_WAIT_HEADER_ACK) && (reply == SCI_YMODEM_ACK)){
+                state = SENDER_WAIT_DATA_REQUEST;
+            } else if ((state == SENDER_WAIT_DATA_REQUEST) && (reply == SCI_YMODEM_CRC_REQUEST)){
+                number = 1U;
+                sender_data(number, false);
+                state = SENDER_WAIT_DATA_ACK;
+            } else if ((state == SENDER_WAIT_DATA_ACK) && (reply == SCI_YMODEM_NAK)){
+                naks++;
+                sender_data(number, false);
+            } else if ((state == SENDER_WAIT_DATA_ACK) && (reply == SCI_YMODEM_ACK)){
+                if (((uint32_t)number * SCI_YMODEM_BLOCK_1K) >= IMAGE_SIZE){
+                    sender_eot();
+                    state = SENDER_WAIT_EOT_NAK;
+                } else {
+                    number++;
+                    // The second block goes out corrupted once
+                    sender_data(number, (number == 2U) && !corrupted);
+                    corrupted = true;
+                }
+            } else if ((state == SENDER_WAIT_EOT_NAK) && (reply == SCI_YMODEM_NAK)){
+                sender_eot();
+                state = SENDER_WAIT_EOT_ACK;
+            } else if ((state == SENDER_WAIT_EOT_ACK) && (reply == SCI_YMODEM_ACK)){
+                state = SENDER_WAIT_END_REQUEST;
+            } else if ((state == SENDER_WAIT_END_REQUEST) && (reply == SCI_YMODEM_CRC_REQUEST)){
+                uint8_t header[SCI_YMODEM_BLOCK_128] = { 0U };
+                sender_block(0U, header, sizeof(header), false);
+                state = SENDER_WAIT_END_ACK;
+            } else if ((state == SENDER_WAIT_END_ACK) && (reply == SCI_YMODEM_ACK)){
+                state = SENDER_FINISHED;
+            } else {
+                fprintf(stderr, "unexpected reply %02x in sender state %d\n", reply, (int)state);
+                CHECK(false);
+            }
+        }
+        status = sciYmodemProcess(&ymodem);
+    }
+
+    CHECK(status == SCI_YMODEM_STATUS_DONE);
+    CHECK(state == SENDER_FINISHED);
+    CHECK(strcmp(s_beginName, "fw.bin") == 0);
+    CHECK(s_beginSize == IMAGE_SIZE);
+    CHECK(naks == 1U);
+    CHECK(s_flashEnd >= IMAGE_SIZE);
+    CHECK(memcmp(s_flash, s_image, IMAGE_SIZE) == 0);
+    // Blocks were received while the previous one was still being programmed
+    CHECK(s_flashOverlaps != 0U);
+    printf("%u bytes programmed, %u blocks overlapped programming\n", s_flashEnd, s_flashOverlaps);
+    return (0);
+}
@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""Replay a captured MMIO trace against a peripheral model.
+
+Usage: mmio_replay.py capture.bin [--baseline other.bin] [--state]
+
+capture.bin is a raw memory image of g_mmioTrace (tMMIO_trace), e.g. from a
+debugger: dump binary memory mmio.bin &g_mmioTrace (&g_mmioTrace + 1)
+Byte order is detected from the magic word.
+
+The replay reports reads whose captured value differs from the model,
+writes that do not change the modelled state (redundant bus accesses) and
+accesses outside any peripheral frame. With --baseline, both captures are
+replayed and the final register states and access counts are diffed; the
+exit status is 1 if the states differ.
+"""
+
+import argparse
+import collections
+import struct
+import sys
+
+MAGIC = 0x4F494D4D
+HEADER = 20
+RECORD = 8
+WRITE = 0x1
+
+SCI_BASES = {0xFFF7E400: "SCI1", 0xFFF7E600: "SCI2", 0xFFF7E500: "SCI3"}
+SCI_FRAME = 0x100
+
+# Offsets as in sci_lin_regs.h
+SCI_REGS = {
+    0x00: "GCR0", 0x04: "GCR1", 0x08: "GCR2", 0x0C: "SET_INT", 0x10: "CLEAR_INT",
+    0x14: "SET_INT_LVL", 0x18: "CLEAR_INT_LVL", 0x1C: "FLR", 0x20: "INT_VECT_0",
+    0x24: "INT_VECT_1", 0x28: "FORMAT", 0x2C: "BRS", 0x30: "ED", 0x34: "RD", 0x38: "TD",
+    0x3C: "PIO0", 0x40: "PIO1", 0x44: "PIO2", 0x48: "PIO3", 0x4C: "PIO4", 0x50: "PIO5",
+    0x54: "PIO6", 0x58: "PIO7", 0x5C: "PIO8", 0x60: "COMPARE", 0x64: "RD0", 0x68: "RD1",
+    0x6C: "MASK", 0x70: "ID", 0x74: "TD0", 0x78: "TD1", 0x7C: "MBRS", 0x90: "IODFTCTRL",
+}
+READ_ONLY = {0x20, 0x24, 0x30, 0x34, 0x64, 0x68}
+# FLR after reset: TX_RDY and TX_EMPTY
+FLR_RESET = (1 << 8) | (1 << 11)
+
+# Addresses below this are register values that were passed where a pointer was expected
+SUSPICIOUS_LIMIT = 0x10000
+
+
+class SciModel:
+    """Register file of one SCI/LIN module with its write semantics."""
+
+    def __init__(self):
+        self.reset()
+
+    def reset(self):
+        self.regs = collections.defaultdict(int)
+        self.regs[0x1C] = FLR_RESET
+        self.int_enable = 0
+        self.int_level = 0
+
+    def read(self, offset):
+        if offset in (0x0C, 0x10):
+            return self.int_enable
+        if offset in (0x14, 0x18):
+            return self.int_level
+        return self.regs[offset]
+
+    def write(self, offset, value):
+        """Apply a write; returns False if it leaves the state unchanged."""
+        before = (dict(self.regs), self.int_enable, self.int_level)
+        if offset == 0x0C:
+            self.int_enable |= value
+        elif offset == 0x10:
+            self.int_enable &= ~value
+        elif offset == 0x14:
+            self.int_level |= value
+        elif offset == 0x18:
+            self.int_level &= ~value
+        elif offset == 0x1C:
+            # Write-1-to-clear
+            self.regs[0x1C] &= ~value
+        elif offset in READ_ONLY:
+            pass
+        elif offset == 0x00 and not value & 1:
+            self.reset()
+        elif offset == 0x38:
+            # TD always starts a transmission
+            self.regs[offset] = value
+            return True
+        else:
+            self.regs[offset] = value
+        return before != (dict(self.regs), self.int_enable, self.int_level)
+
+    def state(self):
+        state = {SCI_REGS.get(off, "0x%02X" % off): val for off, val in self.regs.items() if off not in READ_ONLY}
+        state["INT_ENABLE"] = self.int_enable
+        state["INT_LEVEL"] = self.int_level
+        return state
+
+
+class System:
+    """SCI/LIN modules plus plain memory for every other address."""
+
+    def __init__(self):
+        self.sci = {base: SciModel() for base in SCI_BASES}
+        self.memory = {}
+
+    def locate(self, address):
+        for base in SCI_BASES:
+            if base <= address < base + SCI_FRAME:
+                return base, address - base
+        return None, address
+
+    def name(self, address):
+        base, offset = self.locate(address)
+        if base is None:
+            return "0x%08X" % address
+        return "%s.%s" % (SCI_BASES[base], SCI_REGS.get(offset, "0x%02X" % offset))
+
+    def read(self, address):
+        base, offset = self.locate(address)
+        if base is None:
+            return self.memory.get(address)
+        return self.sci[base].read(offset)
+
+    def write(self, address, value):
+        base, offset = self.locate(address)
+        if base is None:
+            changed = self.memory.get(address) != value
+            self.memory[address] = value
+            return changed
+        return self.sci[base].write(offset, value)
+
+    def state(self):
+        state = {}
+        for base, model in self.sci.items():
+            for reg, value in model.state().items():
+                state["%s.%s" % (SCI_BASES[base], reg)] = value
+        for address, value in self.memory.items():
+            state["0x%08X" % address] = value
+        return state
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    for endian in "<>":
+        magic, size, count, dropped, _ = struct.unpack_from(endian + "IIIII", data, 0)
+        if magic == MAGIC:
+            break
+    else:
+        raise ValueError("%s: no MMIO trace magic, not a g_mmioTrace dump" % path)
+    count = min(count, size)
+    if len(data) < HEADER + count * RECORD:
+        raise ValueError("%s: dump shorter than %d records" % (path, count))
+    records = [struct.unpack_from(endian + "II", data, HEADER + n * RECORD) for n in range(count)]
+    return records, dropped
+
+
+def replay(records):
+    system = System()
+    report = {"mismatches": [], "redundant": collections.Counter(), "suspicious": collections.Counter(),
+              "accesses": collections.Counter()}
+    for n, (address, value) in enumerate(records):
+        write = bool(address & WRITE)
+        address &= ~WRITE
+        name = system.name(address)
+        report["accesses"][name] += 1
+        if address < SUSPICIOUS_LIMIT:
+            report["suspicious"][name] += 1
+        if write:
+            if not system.write(address, value):
+                report["redundant"][name] += 1
+        else:
+            expected = system.read(address)
+            if expected is not None and expected != value:
+                report["mismatches"].append((n, name, expected, value))
+            if expected is None:
+                system.memory[address] = value
+    return system.state(), report
+
+
+def print_report(path, records, dropped, report):
+    writes = sum(1 for address, _ in records if address & WRITE)
+    print("%s: %d accesses (%d writes, %d reads), %d dropped" % (path, len(records), writes, len(records) - writes, dropped))
+    for n, name, expected, value in report["mismatches"]:
+        print("  #%d read %s = 0x%08X, model 0x%08X" % (n, name, value, expected))
+    for name, count in report["redundant"].most_common():
+        print("  redundant write %s x%d" % (name, count))
+    for name, count in report["suspicious"].most_common():
+        print("  access to %s x%d: register value used as address?" % (name, count))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture")
+    parser.add_argument("--baseline", help="capture to diff the final state and access counts against")
+    parser.add_argument("--state", action="store_true", help="print the final modelled state")
+    args = parser.parse_args()
+
+    records, dropped = load(args.capture)
+    state, report = replay(records)
+    print_report(args.capture, records, dropped, report)
+    if args.state:
+        for name in sorted(state):
+            print("  %-24s 0x%08X" % (name, state[name]))
+
+    if args.baseline is None:
+        return 0
+
+    base_records, base_dropped = load(args.baseline)
+    base_state, base_report = replay(base_records)
+    print_report(args.baseline, base_records, base_dropped, base_report)
+
+    differs = False
+    for name in sorted(set(state) | set(base_state)):
+        now, before = state.get(name), base_state.get(name)
+        if now != before:
+            differs = True
+            fmt = lambda v: "-" if v is None else "0x%08X" % v
+            print("  state %-24s %s -> %s" % (name, fmt(before), fmt(now)))
+    for name in sorted(set(report["accesses"]) | set(base_report["accesses"])):
+        now, before = report["accesses"][name], base_report["accesses"][name]
+        if now != before:
+            print("  accesses %-21s %d -> %d" % (name, before, now))
+    return 1 if differs else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
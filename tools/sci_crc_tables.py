@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Generate the const slice-by-N lookup tables of uart/sci_crc.c.
+
+Usage: sci_crc_tables.py [-o uart/sci_crc_tables.h]
+
+Table k holds the CRC of byte b followed by k zero bytes. Slices beyond
+SCI_CRC_SLICES are compiled out, so each variant keeps only what it uses
+in flash.
+"""
+
+import argparse
+import sys
+
+MAX_SLICES = 8
+CRC16_POLY = 0x1021
+CRC16_MODBUS_POLY = 0xA001
+CRC32_POLY = 0xEDB88320
+
+
+def crc16_msb(b):
+    crc = b << 8
+    for _ in range(8):
+        crc = ((crc << 1) ^ CRC16_POLY) if crc & 0x8000 else (crc << 1)
+    return crc & 0xFFFF
+
+
+def crc_lsb(b, poly):
+    crc = b
+    for _ in range(8):
+        crc = (crc >> 1) ^ poly if crc & 1 else crc >> 1
+    return crc
+
+
+def slices(first, advance):
+    tables = [first]
+    for _ in range(1, MAX_SLICES):
+        tables.append([advance(tables[0], value) for value in tables[-1]])
+    return tables
+
+
+def emit(out, ctype, name, tables, digits):
+    out.append("static const %s %s[SCI_CRC_SLICES][256] = {" % (ctype, name))
+    for k, table in enumerate(tables):
+        if k > 0:
+            out.append("#if (SCI_CRC_SLICES > %d)" % k)
+        out.append("    {")
+        for row in range(0, 256, 8):
+            words = ", ".join("0x%0*XU" % (digits, value) for value in table[row:row + 8])
+            out.append("        %s," % words)
+        out.append("    },")
+        if k > 0:
+            out.append("#endif")
+    out.append("};")
+    out.append("")
+
+
+def generate():
+    crc16 = slices([crc16_msb(b) for b in range(256)],
+                   lambda t0, prev: ((prev << 8) & 0xFFFF) ^ t0[prev >> 8])
+    modbus = slices([crc_lsb(b, CRC16_MODBUS_POLY) for b in range(256)],
+                    lambda t0, prev: (prev >> 8) ^ t0[prev & 0xFF])
+    crc32 = slices([crc_lsb(b, CRC32_POLY) for b in range(256)],
+                   lambda t0, prev: (prev >> 8) ^ t0[prev & 0xFF])
+
+    out = [
+        "/* Generated by tools/sci_crc_tables.py, do not edit. */",
+        "#ifndef SCI_CRC_TABLES_H",
+        "#define SCI_CRC_TABLES_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#if (SCI_CRC_SLICES < 1) || (SCI_CRC_SLICES > %d)" % MAX_SLICES,
+        "#error \"SCI_CRC_SLICES must be 1 to %d\"" % MAX_SLICES,
+        "#endif",
+        "",
+        "/* CRC-16, poly 0x1021, MSB first. */",
+    ]
+    emit(out, "uint16_t", "s_sciCrc16Table", crc16, 4)
+    out.append("/* CRC-16/MODBUS, poly 0x8005 reflected. */")
+    emit(out, "uint16_t", "s_sciCrc16ModbusTable", modbus, 4)
+    out.append("/* CRC-32, IEEE 802.3 reflected. */")
+    emit(out, "uint32_t", "s_sciCrc32Table", crc32, 8)
+    out.append("#endif // SCI_CRC_TABLES_H")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", default="-")
+    args = parser.parse_args()
+
+    text = generate()
+    if args.output == "-":
+        sys.stdout.write(text)
+    else:
+        with open(args.output, "w") as f:
+            f.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Decode binary SCI_LOG records captured from the UART.
+
+Usage: sci_log_decode.py firmware.elf capture.bin [--gclk HZ]
+
+Each record is big-endian: header (0xA5, nargs, seq16), format string
+address, GCLK cycle timestamp, then nargs argument words. Format strings
+and %s arguments are read from the loaded sections of the ELF.
+
+seq16 advances for every record the firmware tried to log, including those
+dropped on a full ring, so a gap counts dropped records as well as bytes
+lost on the wire.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+MAX_ARGS = 6
+SPEC = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d+))?(l{0,2}|h{0,2}|z)?([diuxXcsp%])")
+
+
+class Elf:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            raise ValueError("not a 32-bit ELF file")
+        self.endian = "<" if self.data[5] == 1 else ">"
+        shoff, = struct.unpack_from(self.endian + "I", self.data, 0x20)
+        shentsize, shnum = struct.unpack_from(self.endian + "HH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(
+                self.endian + "IIIIII", self.data, shoff + i * shentsize)
+            # SHF_ALLOC with file contents
+            if (flags & 0x2) and sh_type != 8 and size:
+                self.sections.append((addr, offset, size))
+
+    def string(self, address):
+        for addr, offset, size in self.sections:
+            if addr <= address < addr + size:
+                start = offset + (address - addr)
+                end = self.data.find(b"\0", start, offset + size)
+                if end < 0:
+                    end = offset + size
+                return self.data[start:end].decode("utf-8", "replace")
+        return None
+
+
+def render(elf, fmt, args):
+    args = list(args)
+
+    def convert(match):
+        flags, width, precision, _, conv = match.groups()
+        if conv == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        spec = "%" + flags + width + ("." + precision if precision else "")
+        if conv in "di":
+            return (spec + "d") % (value - (1 << 32) if value & 0x80000000 else value)
+        if conv == "u":
+            return (spec + "d") % value
+        if conv in "xX":
+            return (spec + conv) % value
+        if conv == "p":
+            return "0x%08x" % value
+        if conv == "c":
+            return (spec + "c") % (value & 0xFF)
+        text = elf.string(value)
+        return (spec + "s") % (text if text is not None else "<0x%08x>" % value)
+
+    return SPEC.sub(convert, fmt)
+
+
+def records(data):
+    pos = 0
+    while pos + 12 <= len(data):
+        header, = struct.unpack_from(">I", data, pos)
+        nargs = (header >> 16) & 0xFF
+        if (header >> 24) != SYNC or nargs > MAX_ARGS or pos + 12 + 4 * nargs > len(data):
+            # Lost bytes on the wire, resynchronise on the next sync byte
+            pos += 1
+            continue
+        fmt, stamp = struct.unpack_from(">II", data, pos + 4)
+        args = struct.unpack_from(">%dI" % nargs, data, pos + 12)
+        yield header & 0xFFFF, fmt, stamp, args
+        pos += 12 + 4 * nargs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="firmware image the capture was taken from")
+    parser.add_argument("capture", help="raw bytes received from the UART, '-' for stdin")
+    parser.add_argument("--gclk", type=float, default=160e6, help="cycle counter frequency in Hz")
+    options = parser.parse_args()
+
+    elf = Elf(options.elf)
+    if options.capture == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(options.capture, "rb") as f:
+            data = f.read()
+
+    last_seq = None
+    for seq, fmt_address, stamp, args in records(data):
+        if last_seq is not None and seq != (last_seq + 1) & 0xFFFF:
+            print("# %d record(s) lost" % ((seq - last_seq - 1) & 0xFFFF))
+        last_seq = seq
+        fmt = elf.string(fmt_address)
+        if fmt is None:
+            text = "<unknown format 0x%08x> %s" % (fmt_address, " ".join("0x%08x" % a for a in args))
+        else:
+            text = render(elf, fmt, args)
+        print("%12.6f %s" % (stamp / options.gclk, text.rstrip("\r\n")))
+
+
+if __name__ == "__main__":
+    main()
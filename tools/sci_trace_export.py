@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Export an SCI trace ring dump as Chrome trace JSON.
+
+Usage: sci_trace_export.py trace.bin [-o trace.json] [--gclk HZ]
+
+trace.bin is a raw memory image of g_sciTrace (sci_trace_ring_t), e.g.
+from a debugger: dump binary memory trace.bin &g_sciTrace (&g_sciTrace + 1)
+Byte order is detected from the magic word. Open the result in
+chrome://tracing or https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x54524353
+HEADER = 16
+RECORD = 8
+
+# Same order as sci_trace_point_t
+POINTS = ["sciSend", "sciReceive", "sciIsrDispatch INT0", "sciIsrDispatch INT1", "gio_get_pending_irq"]
+NO_INSTANCE = 0xFF
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    for endian in "<>":
+        magic, size, written, _ = struct.unpack_from(endian + "IIII", data, 0)
+        if magic == MAGIC:
+            break
+    else:
+        raise ValueError("no trace ring magic, not a g_sciTrace dump")
+    if len(data) < HEADER + size * RECORD:
+        raise ValueError("dump shorter than %d records" % size)
+
+    # Oldest first: once wrapped, the slot after the newest holds the oldest record
+    count = min(written, size)
+    first = written - count
+    records = []
+    for n in range(first, written):
+        cycles, point, phase, instance, valid = struct.unpack_from(
+            endian + "IBBBB", data, HEADER + (n % size) * RECORD)
+        if valid:
+            records.append((cycles, point, phase, instance))
+    return records
+
+
+def thread(point, instance):
+    if instance == NO_INSTANCE:
+        return "GIO"
+    context = "INT0" if point == 2 else "INT1" if point == 3 else "task"
+    return "SCI%d %s" % (instance + 1, context)
+
+
+def export(records, gclk):
+    # Records are in reservation order, not time order: an interrupt landing
+    # between the timestamp and the slot reservation in sciTraceRecord() is
+    # stored first with a later time. Unwrap the 32-bit counter on signed
+    # deltas, only a step back of more than 2^31 cycles is a wrap, then sort.
+    unwrapped = []
+    last = None
+    absolute = 0
+    for cycles, point, phase, instance in records:
+        if last is None:
+            absolute = cycles
+        else:
+            delta = (cycles - last) & 0xFFFFFFFF
+            absolute += delta - (1 << 32) if delta >= (1 << 31) else delta
+        last = cycles
+        unwrapped.append((absolute, point, phase, instance))
+    # Stable: an enter and exit stamped in the same cycle keep their order
+    unwrapped.sort(key=lambda record: record[0])
+
+    events = []
+    tids = {}
+    base = unwrapped[0][0] if unwrapped else 0
+    for absolute, point, phase, instance in unwrapped:
+        name = POINTS[point] if point < len(POINTS) else "point %d" % point
+        tid = tids.setdefault(thread(point, instance), len(tids) + 1)
+        events.append({
+            "name": name,
+            "ph": "B" if phase == 0 else "E",
+            "ts": (absolute - base) * 1e6 / gclk,
+            "pid": 1,
+            "tid": tid,
+        })
+    for label, tid in tids.items():
+        events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": tid, "args": {"name": label}})
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dump")
+    parser.add_argument("-o", "--output", default="-")
+    parser.add_argument("--gclk", type=int, default=160000000, help="cycle counter frequency in Hz")
+    args = parser.parse_args()
+
+    trace = export(load(args.dump), args.gclk)
+    if args.output == "-":
+        json.dump(trace, sys.stdout, indent=1)
+    else:
+        with open(args.output, "w") as f:
+            json.dump(trace, f, indent=1)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
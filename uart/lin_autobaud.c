@@ -0,0 +1,121 @@
+#include "lin_autobaud.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "uart_config.h"
+
+static volatile lin_autobaud_result_t g_linAutobaud_t[SCI_LIN_NUM_OF_INSTANCES];
+
+/* One bit time in VCLK cycles: 16 * (P + 1) + M. */
+static uint32_t lin_autobaud_bit_ticks(uint32_t brs){
+    uint32_t p = GET_BITS(brs, TMS570_SCI_BRS_PRESCALER_P_OFFSET, TMS570_SCI_BRS_PRESCALER_P_BIT_LEN);
+    uint32_t m = GET_BITS(brs, TMS570_SCI_BRS_M_OFFSET, TMS570_SCI_BRS_M_BIT_LEN);
+    return ((16U * (p + 1U)) + m);
+}
+
+static bool lin_autobaud_set_adapt(volatile tms570_reg* sci_lin_reg, bool adapt){
+    tms570_reg gcr1_reg = tms570_update_field(sci_lin_reg[TMS570_SCI_GCR1], adapt, TMS570_SCI_GCR1_ADAPT_OFFSET, TMS570_SCI_GCR1_ADAPT_BIT_LEN);
+    return tms570_update_register(&sci_lin_reg[TMS570_SCI_GCR1], gcr1_reg, TMS570_SCI_GCR1_MASK);
+}
+
+bool linAutobaudStart(volatile tms570_reg* sci_lin_reg, uint32_t max_baud){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (max_baud == 0U)){
+        return (false);
+    }
+
+    // MBRS holds VCLK cycles per bit at the highest rate to be detected
+    uint32_t mbr = VCLK_FREQ / max_baud;
+    if ((mbr == 0U) || (mbr > MASK_N(TMS570_MBRS_MBRS_BIT_LEN))){
+        return (false);
+    }
+    if (!sci_set_lin_max_baud_rate(sci_lin_reg, (uint16_t)mbr)){
+        return (false);
+    }
+
+    g_linAutobaud_t[index].brs = 0U;
+    g_linAutobaud_t[index].baudrate = 0U;
+    g_linAutobaud_t[index].drift_ppm = 0;
+    g_linAutobaud_t[index].max_drift_ppm = 0U;
+    g_linAutobaud_t[index].samples = 0U;
+    g_linAutobaud_t[index].state = LIN_AUTOBAUD_STATE_SEARCHING;
+
+    return lin_autobaud_set_adapt(sci_lin_reg, true);
+}
+
+bool linAutobaudStop(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    g_linAutobaud_t[index].state = LIN_AUTOBAUD_STATE_IDLE;
+    return lin_autobaud_set_adapt(sci_lin_reg, false);
+}
+
+bool linAutobaudResample(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (g_linAutobaud_t[index].state == LIN_AUTOBAUD_STATE_IDLE)){
+        return (false);
+    }
+
+    // Still searching: the first lock will do
+    if (g_linAutobaud_t[index].state == LIN_AUTOBAUD_STATE_LOCKED){
+        g_linAutobaud_t[index].state = LIN_AUTOBAUD_STATE_SAMPLING;
+    }
+    return lin_autobaud_set_adapt(sci_lin_reg, true);
+}
+
+bool linAutobaudGetResult(volatile tms570_reg* sci_lin_reg, lin_autobaud_result_t* result){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (result == NULL)){
+        return (false);
+    }
+
+    result->state = g_linAutobaud_t[index].state;
+    result->brs = g_linAutobaud_t[index].brs;
+    result->baudrate = g_linAutobaud_t[index].baudrate;
+    result->drift_ppm = g_linAutobaud_t[index].drift_ppm;
+    result->max_drift_ppm = g_linAutobaud_t[index].max_drift_ppm;
+    result->samples = g_linAutobaud_t[index].samples;
+    return (true);
+}
+
+bool linAutobaudIdInterruptHandler(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile lin_autobaud_result_t* autobaud = &g_linAutobaud_t[index];
+    if ((autobaud->state != LIN_AUTOBAUD_STATE_SEARCHING) && (autobaud->state != LIN_AUTOBAUD_STATE_SAMPLING)){
+        return (false);
+    }
+
+    // A valid header means the sync field was measured and BRS already holds the detected prescaler
+    uint32_t brs = sci_lin_reg[TMS570_SCI_BRS] & TMS570_SCI_BRS_MASK;
+    uint32_t ticks = lin_autobaud_bit_ticks(brs);
+
+    if (autobaud->state == LIN_AUTOBAUD_STATE_SAMPLING){
+        uint32_t old_ticks = lin_autobaud_bit_ticks(autobaud->brs);
+        int32_t  drift = (int32_t)((((int64_t)old_ticks - (int64_t)ticks) * 1000000) / (int64_t)ticks);
+        uint32_t abs_drift = (drift < 0) ? (uint32_t)(-drift) : (uint32_t)drift;
+
+        autobaud->drift_ppm = drift;
+        if (abs_drift > autobaud->max_drift_ppm){
+            autobaud->max_drift_ppm = abs_drift;
+        }
+    }
+
+    autobaud->brs = brs;
+    autobaud->baudrate = VCLK_FREQ / ticks;
+    autobaud->samples++;
+    autobaud->state = LIN_AUTOBAUD_STATE_LOCKED;
+
+    // Later frames run on the cached BRS instead of adapting to every sync field
+    return lin_autobaud_set_adapt(sci_lin_reg, false);
+}
@@ -0,0 +1,89 @@
+#ifndef LIN_AUTOBAUD_H
+#define LIN_AUTOBAUD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Default highest baud rate a LIN slave has to detect (LIN 2.x limit). */
+#define LIN_AUTOBAUD_DEFAULT_MAX_BAUD   (20000U)
+
+/**
+ * @enum lin_autobaud_state_e
+ * @brief Autobaud states of an SCI/LIN instance.
+ */
+typedef enum lin_autobaud_state_e {
+    LIN_AUTOBAUD_STATE_IDLE = 0,    /** Autobaud not running, BRS is left as configured */
+    LIN_AUTOBAUD_STATE_SEARCHING,   /** ADAPT set, waiting for the first valid header */
+    LIN_AUTOBAUD_STATE_LOCKED,      /** ADAPT cleared, the cached BRS is used for every frame */
+    LIN_AUTOBAUD_STATE_SAMPLING,    /** ADAPT set for one header to measure drift */
+    NUM_OF_LIN_AUTOBAUD_STATE       /** Number of autobaud states */
+} lin_autobaud_state_t;
+
+/**
+ * @struct lin_autobaud_result_s
+ * @brief Cached autobaud result of an SCI/LIN instance.
+ */
+typedef struct lin_autobaud_result_s {
+    lin_autobaud_state_t state;         /** Current autobaud state */
+    uint32_t             brs;           /** Cached BRS word (prescaler P and fraction M) */
+    uint32_t             baudrate;      /** Baud rate derived from the cached BRS in bit/s */
+    int32_t              drift_ppm;     /** Drift of the last sample against the previous cache in ppm */
+    uint32_t             max_drift_ppm; /** Largest absolute drift seen since the first lock in ppm */
+    uint32_t             samples;       /** Number of sync fields measured since linAutobaudStart() */
+} lin_autobaud_result_t;
+
+/**
+ * @brief Start LIN slave baud rate detection.
+ *
+ * Programs MBRS from VCLK_FREQ for the given maximum baud rate and sets
+ * ADAPT, so the next valid sync field loads the detected prescaler into BRS.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] max_baud Highest baud rate the master may use, e.g. LIN_AUTOBAUD_DEFAULT_MAX_BAUD.
+ * @return true if detection was started, false otherwise.
+ */
+bool linAutobaudStart(volatile tms570_reg* sci_lin_reg, uint32_t max_baud);
+
+/**
+ * @brief Stop autobaud and keep the current BRS.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if stopped, false otherwise.
+ */
+bool linAutobaudStop(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Measure the master baud rate again on the next header.
+ *
+ * Re-arms ADAPT for a single sync field. The new measurement replaces the
+ * cache and its deviation is reported as drift. Call it periodically, or
+ * after an inconsistent synch field error while locked.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if a sample was requested, false if autobaud is not running.
+ */
+bool linAutobaudResample(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Read the cached autobaud result.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] result Pointer to store the result. @see lin_autobaud_result_t
+ * @return true if the result was read, false otherwise.
+ */
+bool linAutobaudGetResult(volatile tms570_reg* sci_lin_reg, lin_autobaud_result_t* result);
+
+/**
+ * @brief ID interrupt handler: capture the detected baud rate.
+ *
+ * When a measurement is pending, reads the BRS value the module derived from
+ * the sync field, caches it, updates the drift figures and clears ADAPT so
+ * later frames run on the cached value.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if a measurement was captured, false otherwise.
+ */
+bool linAutobaudIdInterruptHandler(volatile tms570_reg* sci_lin_reg);
+
+#endif // LIN_AUTOBAUD_H
@@ -0,0 +1,187 @@
+#include "lin_error_monitor.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+static volatile struct g_linErrorMonitor
+{
+    uint32_t errors[LIN_ERROR_MONITOR_NUM_OF_ROWS][NUM_OF_LIN_ERROR_CLASS];   /* Written by the ISR only */
+    uint32_t headers[LIN_ERROR_MONITOR_NUM_OF_ROWS];                          /* Written by the ISR only */
+    uint32_t last_errors[LIN_ERROR_MONITOR_NUM_OF_ROWS];                      /* Error total at the last tick */
+    uint32_t last_headers[LIN_ERROR_MONITOR_NUM_OF_ROWS];                     /* Header total at the last tick */
+    uint16_t window_errors[LIN_ERROR_MONITOR_NUM_OF_ROWS][LIN_ERROR_MONITOR_WINDOW_SLOTS];
+    uint16_t window_headers[LIN_ERROR_MONITOR_NUM_OF_ROWS][LIN_ERROR_MONITOR_WINDOW_SLOTS];
+    uint8_t  slot;                                                            /* Window slot filled by the next tick */
+    uint16_t threshold_permille;
+    uint32_t min_headers;
+} g_linErrorMonitor_t[SCI_LIN_NUM_OF_INSTANCES];
+
+/* FLR flag cleared for each error class, indexed by lin_error_class_t. */
+static const uint32_t s_linErrorClassFlag[NUM_OF_LIN_ERROR_CLASS] = {
+    MAKE_MASK(TMS570_SCI_FLR_NRE_OFFSET, TMS570_SCI_FLR_NRE_BIT_LEN),
+    MAKE_MASK(TMS570_SCI_FLR_ISFE_OFFSET, TMS570_SCI_FLR_ISFE_BIT_LEN),
+    MAKE_MASK(TMS570_SCI_FLR_CE_OFFSET, TMS570_SCI_FLR_CE_BIT_LEN),
+    MAKE_MASK(TMS570_SCI_FLR_PBE_OFFSET, TMS570_SCI_FLR_PBE_BIT_LEN),
+    MAKE_MASK(TMS570_SCI_FLR_BE_OFFSET, TMS570_SCI_FLR_BE_BIT_LEN),
+};
+
+static uint32_t lin_error_monitor_row_total(volatile struct g_linErrorMonitor* monitor, uint32_t row){
+    uint32_t total = 0U;
+    for (uint32_t error_class = 0U; error_class < NUM_OF_LIN_ERROR_CLASS; error_class++){
+        total += monitor->errors[row][error_class];
+    }
+    return total;
+}
+
+/* Sums the window of one row and applies the threshold, all in the caller's context. */
+static bool lin_error_monitor_window(volatile struct g_linErrorMonitor* monitor, uint32_t row,
+                                     uint32_t* errors, uint32_t* headers, uint16_t* rate_permille){
+    uint32_t window_errors = 0U;
+    uint32_t window_headers = 0U;
+
+    for (uint32_t slot = 0U; slot < LIN_ERROR_MONITOR_WINDOW_SLOTS; slot++){
+        window_errors += monitor->window_errors[row][slot];
+        window_headers += monitor->window_headers[row][slot];
+    }
+
+    // NRE and ISFE come without a completed frame, so rate against every attempt
+    uint32_t attempts = (window_headers > window_errors) ? window_headers : window_errors;
+    uint32_t rate = (attempts == 0U) ? 0U : ((window_errors * 1000U) / attempts);
+
+    *errors = window_errors;
+    *headers = window_headers;
+    *rate_permille = (uint16_t)rate;
+    return ((attempts >= monitor->min_headers) && (attempts != 0U) && (rate >= monitor->threshold_permille));
+}
+
+static uint16_t lin_error_monitor_delta(uint32_t now, uint32_t then){
+    uint32_t delta = now - then;
+    return (delta > 0xFFFFU) ? 0xFFFFU : (uint16_t)delta;
+}
+
+bool linErrorMonitorInit(volatile tms570_reg* sci_lin_reg, uint16_t threshold_permille, uint32_t min_headers){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (threshold_permille > 1000U)){
+        return (false);
+    }
+
+    volatile struct g_linErrorMonitor* monitor = &g_linErrorMonitor_t[index];
+    for (uint32_t row = 0U; row < LIN_ERROR_MONITOR_NUM_OF_ROWS; row++){
+        for (uint32_t error_class = 0U; error_class < NUM_OF_LIN_ERROR_CLASS; error_class++){
+            monitor->errors[row][error_class] = 0U;
+        }
+        for (uint32_t slot = 0U; slot < LIN_ERROR_MONITOR_WINDOW_SLOTS; slot++){
+            monitor->window_errors[row][slot] = 0U;
+            monitor->window_headers[row][slot] = 0U;
+        }
+        monitor->headers[row] = 0U;
+        monitor->last_errors[row] = 0U;
+        monitor->last_headers[row] = 0U;
+    }
+    monitor->slot = 0U;
+    monitor->threshold_permille = threshold_permille;
+    monitor->min_headers = min_headers;
+
+    // FLR is write-1-to-clear and SET_INT write-1-to-set, other flags and enables are left untouched
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_FLR], s_linErrorClassFlag[LIN_ERROR_CLASS_NRE] | s_linErrorClassFlag[LIN_ERROR_CLASS_ISFE] |
+                                                        s_linErrorClassFlag[LIN_ERROR_CLASS_CE] | s_linErrorClassFlag[LIN_ERROR_CLASS_PBE] |
+                                                        s_linErrorClassFlag[LIN_ERROR_CLASS_BE]);
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], MAKE_MASK(TMS570_SCI_SET_INT_SET_NRE_INT_OFFSET, TMS570_SCI_SET_INT_SET_NRE_INT_BIT_LEN) |
+                                                            MAKE_MASK(TMS570_SCI_SET_INT_SET_ISFE_INT_OFFSET, TMS570_SCI_SET_INT_SET_ISFE_INT_BIT_LEN) |
+                                                            MAKE_MASK(TMS570_SCI_SET_INT_SET_CE_INT_OFFSET, TMS570_SCI_SET_INT_SET_CE_INT_BIT_LEN) |
+                                                            MAKE_MASK(TMS570_SCI_SET_INT_SET_PBE_INT_OFFSET, TMS570_SCI_SET_INT_SET_PBE_INT_BIT_LEN) |
+                                                            MAKE_MASK(TMS570_SCI_SET_INT_SET_BE_INT_OFFSET, TMS570_SCI_SET_INT_SET_BE_INT_BIT_LEN));
+    return (true);
+}
+
+bool linErrorMonitorErrorInterruptHandler(volatile tms570_reg* sci_lin_reg, lin_error_class_t error_class){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(error_class, NUM_OF_LIN_ERROR_CLASS)){
+        return (false);
+    }
+
+    // A synch field error leaves the ID register holding the previous frame
+    uint32_t row = (error_class == LIN_ERROR_CLASS_ISFE) ? LIN_ERROR_MONITOR_NO_ID :
+                   GET_BITS(sci_lin_reg[TMS570_LIN_ID], TMS570_LIN_ID_RECEIVER_ID_OFFSET, 6U);
+
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_FLR], s_linErrorClassFlag[error_class]);
+    g_linErrorMonitor_t[index].errors[row][error_class]++;
+    return (true);
+}
+
+bool linErrorMonitorIdInterruptHandler(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    uint32_t row = GET_BITS(sci_lin_reg[TMS570_LIN_ID], TMS570_LIN_ID_RECEIVER_ID_OFFSET, 6U);
+    g_linErrorMonitor_t[index].headers[row]++;
+    g_linErrorMonitor_t[index].headers[LIN_ERROR_MONITOR_NO_ID]++;
+    return (true);
+}
+
+bool linErrorMonitorTick(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile struct g_linErrorMonitor* monitor = &g_linErrorMonitor_t[index];
+    uint8_t slot = monitor->slot;
+
+    // Counters are single 32-bit words written by the ISR, a plain read is consistent
+    for (uint32_t row = 0U; row < LIN_ERROR_MONITOR_NUM_OF_ROWS; row++){
+        uint32_t errors = lin_error_monitor_row_total(monitor, row);
+        uint32_t headers = monitor->headers[row];
+
+        monitor->window_errors[row][slot] = lin_error_monitor_delta(errors, monitor->last_errors[row]);
+        monitor->window_headers[row][slot] = lin_error_monitor_delta(headers, monitor->last_headers[row]);
+        monitor->last_errors[row] = errors;
+        monitor->last_headers[row] = headers;
+    }
+
+    monitor->slot = (uint8_t)((slot + 1U) % LIN_ERROR_MONITOR_WINDOW_SLOTS);
+    return (true);
+}
+
+bool linErrorMonitorGetStats(volatile tms570_reg* sci_lin_reg, uint8_t id, lin_error_stats_t* stats){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (id >= LIN_ERROR_MONITOR_NUM_OF_ROWS) || (stats == NULL)){
+        return (false);
+    }
+
+    volatile struct g_linErrorMonitor* monitor = &g_linErrorMonitor_t[index];
+    for (uint32_t error_class = 0U; error_class < NUM_OF_LIN_ERROR_CLASS; error_class++){
+        stats->errors[error_class] = monitor->errors[id][error_class];
+    }
+    stats->headers = monitor->headers[id];
+    stats->degraded = lin_error_monitor_window(monitor, id, &stats->window_errors, &stats->window_headers,
+                                               &stats->error_rate_permille);
+    return (true);
+}
+
+bool linErrorMonitorGetDegraded(volatile tms570_reg* sci_lin_reg, uint64_t* degraded){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (degraded == NULL)){
+        return (false);
+    }
+
+    uint64_t bitmap = 0U;
+    for (uint32_t id = 0U; id < LIN_ERROR_MONITOR_NO_ID; id++){
+        uint32_t errors;
+        uint32_t headers;
+        uint16_t rate_permille;
+        if (lin_error_monitor_window(&g_linErrorMonitor_t[index], id, &errors, &headers, &rate_permille)){
+            bitmap |= ((uint64_t)1U << id);
+        }
+    }
+
+    *degraded = bitmap;
+    return (true);
+}
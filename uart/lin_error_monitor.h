@@ -0,0 +1,104 @@
+#ifndef LIN_ERROR_MONITOR_H
+#define LIN_ERROR_MONITOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Table row for errors detected before a valid ID was received (synch field errors). */
+#define LIN_ERROR_MONITOR_NO_ID             (64U)
+
+/** @brief Rows in the per-instance table: 64 frame IDs plus LIN_ERROR_MONITOR_NO_ID. */
+#define LIN_ERROR_MONITOR_NUM_OF_ROWS       (65U)
+
+/** @brief Number of sliding window slots, each covering one linErrorMonitorTick() period. */
+#define LIN_ERROR_MONITOR_WINDOW_SLOTS      (8U)
+
+/**
+ * @enum lin_error_class_e
+ * @brief LIN error classes reported in SCIFLR.
+ */
+typedef enum lin_error_class_e {
+    LIN_ERROR_CLASS_NRE = 0,    /** No-response error */
+    LIN_ERROR_CLASS_ISFE,       /** Inconsistent synch field error, counted under LIN_ERROR_MONITOR_NO_ID */
+    LIN_ERROR_CLASS_CE,         /** Checksum error */
+    LIN_ERROR_CLASS_PBE,        /** Physical bus error */
+    LIN_ERROR_CLASS_BE,         /** Bit error */
+    NUM_OF_LIN_ERROR_CLASS      /** Number of error classes */
+} lin_error_class_t;
+
+/**
+ * @struct lin_error_stats_s
+ * @brief Health of one frame ID, aggregated at query time.
+ */
+typedef struct lin_error_stats_s {
+    uint32_t errors[NUM_OF_LIN_ERROR_CLASS];    /** Errors per class since linErrorMonitorInit() */
+    uint32_t headers;                           /** Headers seen since linErrorMonitorInit() */
+    uint32_t window_errors;                     /** Errors of all classes inside the sliding window */
+    uint32_t window_headers;                    /** Headers inside the sliding window */
+    uint16_t error_rate_permille;               /** window_errors per 1000 window_headers */
+    bool     degraded;                          /** true if the rate is at or above the configured threshold */
+} lin_error_stats_t;
+
+/**
+ * @brief Initialize the error monitor of an SCI/LIN instance.
+ *
+ * Clears all counters and enables the NRE, ISFE, CE, PBE and BE interrupts.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] threshold_permille Window error rate at which a frame ID is flagged degraded.
+ * @param[in] min_headers Headers needed inside the window before an ID can be flagged.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool linErrorMonitorInit(volatile tms570_reg* sci_lin_reg, uint16_t threshold_permille, uint32_t min_headers);
+
+/**
+ * @brief Error interrupt handler: count one error against the current frame ID.
+ *
+ * Only increments a counter, so it adds no aggregation work to the interrupt.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] error_class Class of the error. @see lin_error_class_t
+ * @return true if the error was counted, false otherwise.
+ */
+bool linErrorMonitorErrorInterruptHandler(volatile tms570_reg* sci_lin_reg, lin_error_class_t error_class);
+
+/**
+ * @brief ID interrupt handler: count one header for the received frame ID.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if the header was counted, false otherwise.
+ */
+bool linErrorMonitorIdInterruptHandler(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Advance the sliding window by one slot.
+ *
+ * Call periodically from task context; the window spans the last
+ * LIN_ERROR_MONITOR_WINDOW_SLOTS periods.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if the window was advanced, false otherwise.
+ */
+bool linErrorMonitorTick(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Get the statistics of one frame ID.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] id Frame identifier (0x00 - 0x3F) or LIN_ERROR_MONITOR_NO_ID.
+ * @param[out] stats Pointer to store the statistics. @see lin_error_stats_t
+ * @return true if the statistics were read, false otherwise.
+ */
+bool linErrorMonitorGetStats(volatile tms570_reg* sci_lin_reg, uint8_t id, lin_error_stats_t* stats);
+
+/**
+ * @brief Get the set of degraded frame IDs.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] degraded Bit n set if frame ID n is degraded.
+ * @return true if the bitmap was computed, false otherwise.
+ */
+bool linErrorMonitorGetDegraded(volatile tms570_reg* sci_lin_reg, uint64_t* degraded);
+
+#endif // LIN_ERROR_MONITOR_H
@@ -0,0 +1,193 @@
+#include "lin_power.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+static volatile struct g_linPower
+{
+    lin_power_state_t state;        /* Current power state */
+    lin_power_hook_t  hook;         /* Clock gating hook */
+    uint8_t           max_series;   /* Wakeup series before giving up */
+    uint8_t           series;       /* Wakeup series completed */
+    uint8_t           signals;      /* Wakeup signals sent in the current series */
+} g_linPower_t[SCI_LIN_NUM_OF_INSTANCES];
+
+/* FLR flag cleared for each event, indexed by lin_power_event_t. */
+static const uint32_t s_linPowerEventFlag[NUM_OF_LIN_POWER_EVENT] = {
+    MAKE_MASK(TMS570_SCI_FLR_TIMEOUT_OFFSET, TMS570_SCI_FLR_TIMEOUT_BIT_LEN),
+    MAKE_MASK(TMS570_SCI_FLR_WAKEUP_OFFSET, TMS570_SCI_FLR_WAKEUP_BIT_LEN),
+    MAKE_MASK(TMS570_SCI_FLR_TOAWUS_OFFSET, TMS570_SCI_FLR_TOAWUS_BIT_LEN),
+    MAKE_MASK(TMS570_SCI_FLR_TOA3WUS_OFFSET, TMS570_SCI_FLR_TOA3WUS_BIT_LEN),
+    0U,
+};
+
+static bool lin_power_set_gcr2_bit(volatile tms570_reg* sci_lin_reg, uint32_t offset, bool value){
+    tms570_reg gcr2_reg = tms570_update_field(sci_lin_reg[TMS570_SCI_GCR2], value, offset, 1U);
+    return tms570_update_register(&sci_lin_reg[TMS570_SCI_GCR2], gcr2_reg, TMS570_SCI_GCR2_MASK);
+}
+
+static void lin_power_enter(volatile tms570_reg* sci_lin_reg, volatile struct g_linPower* power, lin_power_state_t state){
+    power->state = state;
+    if (power->hook != NULL){
+        power->hook(sci_lin_reg, state);
+    }
+}
+
+static void lin_power_sleep(volatile tms570_reg* sci_lin_reg, volatile struct g_linPower* power){
+    lin_power_set_gcr2_bit(sci_lin_reg, TMS570_SCI_GCR2_POWERDOWN_OFFSET, true);
+    lin_power_enter(sci_lin_reg, power, LIN_POWER_STATE_SLEEP);
+}
+
+/* Clocks come back through the hook before the module is touched. */
+static bool lin_power_send_wakeup(volatile tms570_reg* sci_lin_reg, volatile struct g_linPower* power){
+    lin_power_enter(sci_lin_reg, power, LIN_POWER_STATE_WAKE_REQUEST);
+    power->signals++;
+    if (!lin_power_set_gcr2_bit(sci_lin_reg, TMS570_SCI_GCR2_POWERDOWN_OFFSET, false)){
+        return (false);
+    }
+    // GEN_WU is cleared by the module once the wakeup signal has been sent
+    return lin_power_set_gcr2_bit(sci_lin_reg, TMS570_SCI_GCR2_GEN_WU_OFFSET, true);
+}
+
+bool linPowerInit(volatile tms570_reg* sci_lin_reg, lin_power_hook_t hook, uint8_t max_series){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (max_series == 0U)){
+        return (false);
+    }
+
+    g_linPower_t[index].state = LIN_POWER_STATE_ACTIVE;
+    g_linPower_t[index].hook = hook;
+    g_linPower_t[index].max_series = max_series;
+    g_linPower_t[index].series = 0U;
+    g_linPower_t[index].signals = 0U;
+
+    // FLR is write-1-to-clear and SET_INT write-1-to-set, other flags and enables are left untouched
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_FLR], s_linPowerEventFlag[LIN_POWER_EVENT_TIMEOUT] | s_linPowerEventFlag[LIN_POWER_EVENT_WAKEUP] |
+                                                        s_linPowerEventFlag[LIN_POWER_EVENT_TOAWUS] | s_linPowerEventFlag[LIN_POWER_EVENT_TOA3WUS]);
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], MAKE_MASK(TMS570_SCI_SET_INT_SET_TIMEOUT_INT_OFFSET, TMS570_SCI_SET_INT_SET_TIMEOUT_INT_BIT_LEN) |
+                                                            MAKE_MASK(TMS570_SCI_SET_INT_SET_WAKEUP_INT_OFFSET, TMS570_SCI_SET_INT_SET_WAKEUP_INT_BIT_LEN) |
+                                                            MAKE_MASK(TMS570_SCI_SET_INT_SET_TOAWUS_INT_OFFSET, TMS570_SCI_SET_INT_SET_TOAWUS_INT_BIT_LEN) |
+                                                            MAKE_MASK(TMS570_SCI_SET_INT_SET_TOA3WUS_INT_OFFSET, TMS570_SCI_SET_INT_SET_TOA3WUS_INT_BIT_LEN));
+
+    return lin_power_set_gcr2_bit(sci_lin_reg, TMS570_SCI_GCR2_POWERDOWN_OFFSET, false);
+}
+
+bool linPowerRequestSleep(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (g_linPower_t[index].state != LIN_POWER_STATE_ACTIVE)){
+        return (false);
+    }
+
+    g_linPower_t[index].state = LIN_POWER_STATE_GOING_TO_SLEEP;
+    return lin_power_set_gcr2_bit(sci_lin_reg, TMS570_SCI_GCR2_POWERDOWN_OFFSET, true);
+}
+
+bool linPowerRequestWakeup(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile struct g_linPower* power = &g_linPower_t[index];
+    if ((power->state != LIN_POWER_STATE_SLEEP) && (power->state != LIN_POWER_STATE_GOING_TO_SLEEP)){
+        return (false);
+    }
+
+    power->series = 0U;
+    power->signals = 0U;
+    return lin_power_send_wakeup(sci_lin_reg, power);
+}
+
+bool linPowerProcess(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile struct g_linPower* power = &g_linPower_t[index];
+    if ((power->state == LIN_POWER_STATE_GOING_TO_SLEEP) &&
+        (GET_BITS(sci_lin_reg[TMS570_SCI_FLR], TMS570_SCI_FLR_BUSY_OFFSET, TMS570_SCI_FLR_BUSY_BIT_LEN) == 0U)){
+        lin_power_enter(sci_lin_reg, power, LIN_POWER_STATE_SLEEP);
+    }
+    return (power->state == LIN_POWER_STATE_SLEEP);
+}
+
+bool linPowerHandleEvent(volatile tms570_reg* sci_lin_reg, lin_power_event_t event){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(event, NUM_OF_LIN_POWER_EVENT)){
+        return (false);
+    }
+
+    volatile struct g_linPower* power = &g_linPower_t[index];
+    lin_power_state_t           state = power->state;
+
+    // FLR is write-1-to-clear; a no-op if the interrupt vector read already cleared it
+    if (s_linPowerEventFlag[event] != 0U){
+        tms570_write_register(&sci_lin_reg[TMS570_SCI_FLR], s_linPowerEventFlag[event]);
+    }
+
+    switch (event){
+    case LIN_POWER_EVENT_TIMEOUT:
+        // Four seconds without bus activity, nothing is in flight
+        if ((state == LIN_POWER_STATE_ACTIVE) || (state == LIN_POWER_STATE_GOING_TO_SLEEP)){
+            lin_power_sleep(sci_lin_reg, power);
+        }
+        break;
+
+    case LIN_POWER_EVENT_WAKEUP:
+        if ((state == LIN_POWER_STATE_SLEEP) || (state == LIN_POWER_STATE_GOING_TO_SLEEP)){
+            lin_power_enter(sci_lin_reg, power, LIN_POWER_STATE_ACTIVE);
+            lin_power_set_gcr2_bit(sci_lin_reg, TMS570_SCI_GCR2_POWERDOWN_OFFSET, false);
+        }
+        break;
+
+    case LIN_POWER_EVENT_TOAWUS:
+        if (state == LIN_POWER_STATE_WAKE_REQUEST){
+            if (power->signals < LIN_POWER_WAKEUP_SIGNALS_PER_SERIES){
+                lin_power_send_wakeup(sci_lin_reg, power);
+            } else {
+                // The module itself times the 1.5 s pause and raises TOA3WUS
+                power->state = LIN_POWER_STATE_WAKE_RETRY;
+            }
+        }
+        break;
+
+    case LIN_POWER_EVENT_TOA3WUS:
+        if ((state == LIN_POWER_STATE_WAKE_REQUEST) || (state == LIN_POWER_STATE_WAKE_RETRY)){
+            power->series++;
+            power->signals = 0U;
+            if (power->series < power->max_series){
+                lin_power_send_wakeup(sci_lin_reg, power);
+            } else {
+                lin_power_sleep(sci_lin_reg, power);
+            }
+        }
+        break;
+
+    case LIN_POWER_EVENT_HEADER:
+        if ((state == LIN_POWER_STATE_WAKE_REQUEST) || (state == LIN_POWER_STATE_WAKE_RETRY)){
+            power->state = LIN_POWER_STATE_ACTIVE;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return (power->state != state);
+}
+
+bool linPowerGetState(volatile tms570_reg* sci_lin_reg, lin_power_state_t* state){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (state == NULL)){
+        return (false);
+    }
+
+    *state = g_linPower_t[index].state;
+    return (true);
+}
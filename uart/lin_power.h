@@ -0,0 +1,113 @@
+#ifndef LIN_POWER_H
+#define LIN_POWER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Wakeup signals sent before the module waits for the 1.5 s TOA3WUS timeout. */
+#define LIN_POWER_WAKEUP_SIGNALS_PER_SERIES (3U)
+
+/** @brief Default number of wakeup series before giving up and going back to sleep. */
+#define LIN_POWER_DEFAULT_MAX_SERIES        (2U)
+
+/**
+ * @enum lin_power_state_e
+ * @brief Power states of an SCI/LIN instance.
+ */
+typedef enum lin_power_state_e {
+    LIN_POWER_STATE_ACTIVE = 0,         /** Bus active, module clocked */
+    LIN_POWER_STATE_GOING_TO_SLEEP,     /** POWERDOWN set, waiting for the current frame to finish */
+    LIN_POWER_STATE_SLEEP,              /** Module in low-power mode, clocks may be gated */
+    LIN_POWER_STATE_WAKE_REQUEST,       /** Wakeup signal sent, waiting 150 ms for a header */
+    LIN_POWER_STATE_WAKE_RETRY,         /** Three wakeup signals unanswered, waiting 1.5 s */
+    NUM_OF_LIN_POWER_STATE              /** Number of power states */
+} lin_power_state_t;
+
+/**
+ * @enum lin_power_event_e
+ * @brief Events driving the power state machine.
+ */
+typedef enum lin_power_event_e {
+    LIN_POWER_EVENT_TIMEOUT = 0,        /** Bus idle timeout (FLR TIMEOUT, 4 s) */
+    LIN_POWER_EVENT_WAKEUP,             /** Wakeup signal received from the bus (FLR WAKEUP) */
+    LIN_POWER_EVENT_TOAWUS,             /** No header 150 ms after a wakeup signal (FLR TOAWUS) */
+    LIN_POWER_EVENT_TOA3WUS,            /** No header 1.5 s after the third wakeup signal (FLR TOA3WUS) */
+    LIN_POWER_EVENT_HEADER,             /** Valid header received (ID interrupt) */
+    NUM_OF_LIN_POWER_EVENT              /** Number of power events */
+} lin_power_event_t;
+
+/**
+ * @brief Clock gating hook.
+ *
+ * Called with LIN_POWER_STATE_SLEEP once the module is in low-power mode
+ * (clocks may be gated), and with the new state before the module is used
+ * again on wakeup (clocks must be running when the hook returns).
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] state State being entered. @see lin_power_state_t
+ */
+typedef void (*lin_power_hook_t)(volatile tms570_reg* sci_lin_reg, lin_power_state_t state);
+
+/**
+ * @brief Initialize the power state machine of an SCI/LIN instance.
+ *
+ * Enables the bus idle timeout, wakeup, TOAWUS and TOA3WUS interrupts and
+ * starts in LIN_POWER_STATE_ACTIVE.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] hook Clock gating hook, may be NULL.
+ * @param[in] max_series Wakeup series (of three signals each) before giving up, at least 1.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool linPowerInit(volatile tms570_reg* sci_lin_reg, lin_power_hook_t hook, uint8_t max_series);
+
+/**
+ * @brief Request bus sleep, e.g. after a go-to-sleep command.
+ *
+ * Sets POWERDOWN; the module enters low-power mode once the current frame
+ * has finished, which linPowerProcess() detects.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if the request was accepted, false otherwise.
+ */
+bool linPowerRequestSleep(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Wake the cluster from this node.
+ *
+ * Runs the hook, leaves low-power mode and sends a wakeup signal. Retries
+ * follow the TOAWUS/TOA3WUS timing of the module.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if a wakeup signal was sent, false otherwise.
+ */
+bool linPowerRequestWakeup(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Complete a pending sleep request once the bus is no longer busy.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if the instance is in LIN_POWER_STATE_SLEEP afterwards, false otherwise.
+ */
+bool linPowerProcess(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Feed an interrupt event into the power state machine.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] event Event that occurred. @see lin_power_event_t
+ * @return true if the event changed the state, false otherwise.
+ */
+bool linPowerHandleEvent(volatile tms570_reg* sci_lin_reg, lin_power_event_t event);
+
+/**
+ * @brief Get the current power state.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] state Pointer to store the state. @see lin_power_state_t
+ * @return true if the state was read, false otherwise.
+ */
+bool linPowerGetState(volatile tms570_reg* sci_lin_reg, lin_power_state_t* state);
+
+#endif // LIN_POWER_H
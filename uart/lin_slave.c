@@ -0,0 +1,118 @@
+#include "lin_slave.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+/* 8-bit characters are used for every LIN response byte. */
+#define LIN_SLAVE_FORMAT_CHAR_8BIT  (7U)
+
+static volatile lin_slave_entry_t g_linSlaveTable[SCI_LIN_NUM_OF_INSTANCES][LIN_SLAVE_NUM_OF_IDS];
+
+/* Shadow of the last SCIFORMAT word written by the ID interrupt, avoids a read-modify-write on the hot path. */
+static tms570_reg g_linSlaveFormat[SCI_LIN_NUM_OF_INSTANCES];
+
+static uint32_t lin_slave_pack_word(const uint8_t* data, uint8_t length){
+    uint32_t word = 0U;
+    uint8_t  i;
+
+    for (i = 0U; i < 4U; i++){
+        word <<= 8U;
+        if (i < length){
+            word |= data[i];
+        }
+    }
+    return (word);
+}
+
+bool linSlaveInit(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+    uint32_t id;
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    for (id = 0U; id < LIN_SLAVE_NUM_OF_IDS; id++){
+        g_linSlaveTable[index][id].buffer[0U].length = 0U;
+        g_linSlaveTable[index][id].buffer[1U].length = 0U;
+        g_linSlaveTable[index][id].active = 0U;
+    }
+    g_linSlaveFormat[index] = sci_lin_reg[TMS570_SCI_FORMAT];
+
+    // Mask every ID bit so each valid header is both an RX and a TX match; the table decides who answers
+    tms570_reg mask_reg = VAL2FIELD(0xFFU, TMS570_LIN_MASK_RX_ID_MASK_OFFSET, TMS570_LIN_MASK_RX_ID_MASK_BIT_LEN) |
+                          VAL2FIELD(0xFFU, TMS570_LIN_MASK_TX_ID_MASK_OFFSET, TMS570_LIN_MASK_TX_ID_MASK_BIT_LEN);
+    if (!tms570_update_register(&sci_lin_reg[TMS570_LIN_MASK], mask_reg, TMS570_LIN_MASK_MASK)){
+        return (false);
+    }
+
+    // SET_INT is write-1-to-set, other enables are left untouched
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], MAKE_MASK(TMS570_SCI_SET_INT_SET_ID_INT_OFFSET, TMS570_SCI_SET_INT_SET_ID_INT_BIT_LEN));
+
+    return (true);
+}
+
+static bool lin_slave_update(volatile tms570_reg* sci_lin_reg, uint8_t id, const uint8_t* data, uint8_t length, bool publish){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (length > LIN_SLAVE_MAX_RESPONSE_LEN) || (publish && (length != 0U) && (data == NULL))){
+        return (false);
+    }
+
+    volatile lin_slave_entry_t*    entry = &g_linSlaveTable[index][id & MASK_N(6U)];
+    uint8_t                        next = entry->active ^ 1U;
+    volatile lin_slave_response_t* response = &entry->buffer[next];
+
+    response->length = length;
+    response->publish = publish;
+    if (length != 0U){
+        response->td0 = publish ? lin_slave_pack_word(&data[0U], length) : 0U;
+        response->td1 = (publish && (length > 4U)) ? lin_slave_pack_word(&data[4U], length - 4U) : 0U;
+        response->format = tms570_update_field(g_linSlaveFormat[index], LIN_SLAVE_FORMAT_CHAR_8BIT, TMS570_SCI_FORMAT_CHAR_OFFSET, TMS570_SCI_FORMAT_CHAR_BIT_LEN);
+        response->format = tms570_update_field(response->format, length - 1U, TMS570_SCI_FORMAT_LENGTH_OFFSET, TMS570_SCI_FORMAT_LENGTH_BIT_LEN);
+    }
+
+    // Buffer is complete, make it the one the ID interrupt reads
+    entry->active = next;
+
+    return (true);
+}
+
+bool linSlavePublish(volatile tms570_reg* sci_lin_reg, uint8_t id, const uint8_t* data, uint8_t length){
+    return lin_slave_update(sci_lin_reg, id, data, length, true);
+}
+
+bool linSlaveSubscribe(volatile tms570_reg* sci_lin_reg, uint8_t id, uint8_t length){
+    return lin_slave_update(sci_lin_reg, id, NULL, length, false);
+}
+
+bool linSlaveIdInterruptHandler(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    // Only the 6 ID bits index the table; the parity bits were already checked by the module
+    uint32_t id = GET_BITS(sci_lin_reg[TMS570_LIN_ID], TMS570_LIN_ID_RECEIVER_ID_OFFSET, 6U);
+    volatile lin_slave_entry_t*    entry = &g_linSlaveTable[index][id];
+    volatile lin_slave_response_t* response = &entry->buffer[entry->active];
+
+    if (response->length == 0U){
+        return (false);
+    }
+
+    if (response->format != g_linSlaveFormat[index]){
+        tms570_write_register(&sci_lin_reg[TMS570_SCI_FORMAT], response->format);
+        g_linSlaveFormat[index] = response->format;
+    }
+
+    if (!response->publish){
+        return (false);
+    }
+
+    // Plain stores: the read-back in tms570_update_register would cost bus cycles inside the response space
+    tms570_write_register(&sci_lin_reg[TMS570_LIN_TD_1], response->td1);
+    tms570_write_register(&sci_lin_reg[TMS570_LIN_TD_0], response->td0); // Writing TD0 starts the response
+
+    return (true);
+}
@@ -0,0 +1,92 @@
+#ifndef LIN_SLAVE_H
+#define LIN_SLAVE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Number of LIN frame identifiers (6-bit ID space). */
+#define LIN_SLAVE_NUM_OF_IDS        (64U)
+
+/** @brief Maximum LIN response length in bytes (LINTD0 + LINTD1). */
+#define LIN_SLAVE_MAX_RESPONSE_LEN  (8U)
+
+/**
+ * @struct lin_slave_response_s
+ * @brief Response pre-packed in the exact layout the ID interrupt stores to the module.
+ */
+typedef struct lin_slave_response_s {
+    uint32_t td0;       /** LINTD0 word, bytes 0-3 (byte 0 in bits 31:24) */
+    uint32_t td1;       /** LINTD1 word, bytes 4-7 (byte 4 in bits 31:24) */
+    uint32_t format;    /** SCIFORMAT word with LENGTH = response length - 1 */
+    uint8_t  length;    /** Response length in bytes, 0 if this node does not handle the ID */
+    bool     publish;   /** true if this node transmits the response, false if it only receives it */
+} lin_slave_response_t;
+
+/**
+ * @struct lin_slave_entry_s
+ * @brief Double-buffered response slot for one frame ID.
+ *
+ * The application fills buffer[!active] and then flips active, so the
+ * ID interrupt always reads a complete response without locking.
+ */
+typedef struct lin_slave_entry_s {
+    lin_slave_response_t buffer[2U];    /** Response buffers */
+    uint8_t              active;        /** Index of the buffer the ID interrupt reads */
+} lin_slave_entry_t;
+
+/**
+ * @brief Initialize the slave response table of an SCI/LIN instance.
+ *
+ * Withdraws every response, opens the RX/TX ID masks so that every valid
+ * header raises the ID interrupt, and enables the ID interrupt.
+ * Call while the module is held in reset (SWnRST = 0).
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool linSlaveInit(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Publish (or withdraw) the response for a frame ID.
+ *
+ * Packs the data into the inactive buffer of the entry and flips it live.
+ * Must not be called from a context with higher priority than the ID interrupt.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] id Frame identifier (0x00 - 0x3F), with or without parity bits.
+ * @param[in] data Response bytes, may be NULL when length is 0.
+ * @param[in] length Response length 1-8, or 0 to stop responding to the ID.
+ * @return true if the response was published, false otherwise.
+ */
+bool linSlavePublish(volatile tms570_reg* sci_lin_reg, uint8_t id, const uint8_t* data, uint8_t length);
+
+/**
+ * @brief Subscribe to (or unsubscribe from) the response of a frame ID.
+ *
+ * The ID interrupt then programs the expected response length so the
+ * module receives the frame into LINRD0/LINRD1. Replaces any published
+ * response for the same ID.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] id Frame identifier (0x00 - 0x3F), with or without parity bits.
+ * @param[in] length Expected response length 1-8, or 0 to unsubscribe.
+ * @return true if the subscription was updated, false otherwise.
+ */
+bool linSlaveSubscribe(volatile tms570_reg* sci_lin_reg, uint8_t id, uint8_t length);
+
+/**
+ * @brief ID interrupt handler: start the response for the received header.
+ *
+ * Looks up the 6-bit frame ID of the received header in the response table
+ * (the module has already checked the parity bits). SCIFORMAT is
+ * only written when the length differs from the previous frame. If this node
+ * publishes the frame, LINTD1 and then LINTD0 (which starts the response)
+ * are stored.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if a response was started, false if the ID is not published by this node.
+ */
+bool linSlaveIdInterruptHandler(volatile tms570_reg* sci_lin_reg);
+
+#endif // LIN_SLAVE_H
@@ -0,0 +1,268 @@
+#include "lin_tp.h"
+#include "lin_slave.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+#define LIN_TP_FRAME_LEN        (8U)
+#define LIN_TP_PCI_TYPE_SF      (0x0U)  /* Single frame */
+#define LIN_TP_PCI_TYPE_FF      (0x1U)  /* First frame */
+#define LIN_TP_PCI_TYPE_CF      (0x2U)  /* Consecutive frame */
+#define LIN_TP_SF_MAX_DATA      (6U)
+#define LIN_TP_FF_DATA          (5U)
+#define LIN_TP_CF_DATA          (6U)
+#define LIN_TP_SN_MASK          (0x0FU)
+#define LIN_TP_PADDING          (0xFFU)
+
+static volatile struct g_linTpChannel
+{
+    lin_tp_state_t       state;         /* Channel state */
+    uint8_t              nad;           /* Own node address */
+    uint8_t              request_nad;   /* NAD the current request was addressed to */
+    uint8_t            * rx_buffer;     /* Reassembly buffer */
+    uint16_t             rx_capacity;   /* Reassembly buffer size in bytes */
+    uint16_t             rx_length;     /* Announced request length */
+    uint16_t             rx_offset;     /* Request bytes received so far */
+    uint8_t              rx_sn;         /* Expected consecutive frame sequence number */
+    const uint8_t      * tx_data;       /* Response PDU */
+    uint16_t             tx_length;     /* Response length in bytes */
+    uint16_t             tx_offset;     /* Response bytes already packed into frames */
+    uint8_t              tx_sn;         /* Next consecutive frame sequence number */
+    lin_tp_rx_callback_t rx_callback;   /* Request complete notification */
+} g_linTpChannel_t[SCI_LIN_NUM_OF_INSTANCES];
+
+/* Byte n (0-7) of a frame, byte 0 sits in bits 31:24 of LINRD0. */
+static uint8_t lin_tp_frame_byte(uint32_t rd0, uint32_t rd1, uint32_t n){
+    uint32_t word = (n < 4U) ? rd0 : rd1;
+    return (uint8_t)(word >> (24U - (8U * (n & 3U))));
+}
+
+static void lin_tp_copy_payload(volatile struct g_linTpChannel* channel, uint32_t rd0, uint32_t rd1, uint32_t first, uint32_t count){
+    uint32_t remaining = (uint32_t)channel->rx_length - channel->rx_offset;
+    uint32_t n;
+
+    count = (count < remaining) ? count : remaining;
+    for (n = first; n < (first + count); n++){
+        channel->rx_buffer[channel->rx_offset] = lin_tp_frame_byte(rd0, rd1, n);
+        channel->rx_offset++;
+    }
+}
+
+static void lin_tp_rx_complete(volatile tms570_reg* sci_lin_reg, volatile struct g_linTpChannel* channel){
+    channel->state = LIN_TP_STATE_RX_COMPLETE;
+    if (channel->rx_callback != NULL){
+        channel->rx_callback(sci_lin_reg, channel->request_nad, channel->rx_buffer, channel->rx_length);
+    }
+}
+
+static void lin_tp_stop_response(volatile tms570_reg* sci_lin_reg, volatile struct g_linTpChannel* channel){
+    linSlavePublish(sci_lin_reg, LIN_TP_SRF_ID, NULL, 0U);
+    channel->state = LIN_TP_STATE_IDLE;
+}
+
+/* Pack the next response frame and make it the live 0x3D response. */
+static bool lin_tp_publish_next(volatile tms570_reg* sci_lin_reg, volatile struct g_linTpChannel* channel){
+    uint8_t  frame[LIN_TP_FRAME_LEN];
+    uint32_t n = 2U;
+    uint32_t count;
+
+    frame[0U] = channel->nad;
+    if (channel->tx_offset == 0U){
+        if (channel->tx_length <= LIN_TP_SF_MAX_DATA){
+            frame[1U] = (uint8_t)((LIN_TP_PCI_TYPE_SF << 4U) | channel->tx_length);
+            count = channel->tx_length;
+        } else {
+            frame[1U] = (uint8_t)((LIN_TP_PCI_TYPE_FF << 4U) | (channel->tx_length >> 8U));
+            frame[n++] = (uint8_t)channel->tx_length;
+            count = LIN_TP_FF_DATA;
+        }
+    } else {
+        frame[1U] = (uint8_t)((LIN_TP_PCI_TYPE_CF << 4U) | channel->tx_sn);
+        channel->tx_sn = (channel->tx_sn + 1U) & LIN_TP_SN_MASK;
+        count = (uint32_t)channel->tx_length - channel->tx_offset;
+        count = (count < LIN_TP_CF_DATA) ? count : LIN_TP_CF_DATA;
+    }
+
+    while (count > 0U){
+        frame[n++] = channel->tx_data[channel->tx_offset];
+        channel->tx_offset++;
+        count--;
+    }
+    while (n < LIN_TP_FRAME_LEN){
+        frame[n++] = LIN_TP_PADDING;
+    }
+
+    return linSlavePublish(sci_lin_reg, LIN_TP_SRF_ID, frame, LIN_TP_FRAME_LEN);
+}
+
+bool linTpInit(volatile tms570_reg* sci_lin_reg, uint8_t nad, uint8_t* rx_buffer, uint16_t rx_capacity, lin_tp_rx_callback_t rx_callback){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (rx_buffer == NULL) || (rx_capacity == 0U)){
+        return (false);
+    }
+
+    g_linTpChannel_t[index].state = LIN_TP_STATE_IDLE;
+    g_linTpChannel_t[index].nad = nad;
+    g_linTpChannel_t[index].rx_buffer = rx_buffer;
+    g_linTpChannel_t[index].rx_capacity = rx_capacity;
+    g_linTpChannel_t[index].rx_callback = rx_callback;
+
+    if (!linSlavePublish(sci_lin_reg, LIN_TP_SRF_ID, NULL, 0U)){
+        return (false);
+    }
+    return linSlaveSubscribe(sci_lin_reg, LIN_TP_MRF_ID, LIN_TP_FRAME_LEN);
+}
+
+bool linTpSend(volatile tms570_reg* sci_lin_reg, const uint8_t* data, uint16_t length){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (data == NULL) || (length == 0U) || (length > LIN_TP_MAX_PDU_LEN)){
+        return (false);
+    }
+
+    volatile struct g_linTpChannel* channel = &g_linTpChannel_t[index];
+    if ((channel->state != LIN_TP_STATE_IDLE) && (channel->state != LIN_TP_STATE_RX_COMPLETE)){
+        return (false);
+    }
+
+    channel->tx_data = data;
+    channel->tx_length = length;
+    channel->tx_offset = 0U;
+    channel->tx_sn = 1U;
+    channel->state = LIN_TP_STATE_TX;
+
+    // Headers arriving before this point find nothing published and do not advance the channel
+    return lin_tp_publish_next(sci_lin_reg, channel);
+}
+
+bool linTpRelease(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    if (g_linTpChannel_t[index].state == LIN_TP_STATE_TX){
+        lin_tp_stop_response(sci_lin_reg, &g_linTpChannel_t[index]);
+    }
+    g_linTpChannel_t[index].state = LIN_TP_STATE_IDLE;
+    return (true);
+}
+
+bool linTpGetState(volatile tms570_reg* sci_lin_reg, lin_tp_state_t* state){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (state == NULL)){
+        return (false);
+    }
+
+    *state = g_linTpChannel_t[index].state;
+    return (true);
+}
+
+bool linTpRxInterruptHandler(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (g_linTpChannel_t[index].rx_buffer == NULL)){
+        return (false);
+    }
+    if (GET_BITS(sci_lin_reg[TMS570_LIN_ID], TMS570_LIN_ID_RECEIVER_ID_OFFSET, 6U) != LIN_TP_MRF_ID){
+        return (false);
+    }
+
+    volatile struct g_linTpChannel* channel = &g_linTpChannel_t[index];
+    uint32_t rd0 = sci_lin_reg[TMS570_LIN_RD_0];
+    uint32_t rd1 = sci_lin_reg[TMS570_LIN_RD_1];
+    uint8_t  nad = lin_tp_frame_byte(rd0, rd1, 0U);
+    uint8_t  pci = lin_tp_frame_byte(rd0, rd1, 1U);
+    uint16_t length;
+
+    if ((nad != channel->nad) && (nad != LIN_TP_NAD_FUNCTIONAL) && (nad != LIN_TP_NAD_BROADCAST)){
+        return (false);
+    }
+    // The application still owns the buffer, the request is dropped
+    if (channel->state == LIN_TP_STATE_RX_COMPLETE){
+        return (true);
+    }
+
+    switch (pci >> 4U){
+    case LIN_TP_PCI_TYPE_SF:
+        length = pci & 0x0FU;
+        if ((length == 0U) || (length > LIN_TP_SF_MAX_DATA) || (length > channel->rx_capacity)){
+            return (true);
+        }
+        // A new request aborts an ongoing response
+        if (channel->state == LIN_TP_STATE_TX){
+            lin_tp_stop_response(sci_lin_reg, channel);
+        }
+        channel->request_nad = nad;
+        channel->rx_length = length;
+        channel->rx_offset = 0U;
+        lin_tp_copy_payload(channel, rd0, rd1, 2U, length);
+        lin_tp_rx_complete(sci_lin_reg, channel);
+        break;
+
+    case LIN_TP_PCI_TYPE_FF:
+        length = (uint16_t)(((pci & 0x0FU) << 8U) | lin_tp_frame_byte(rd0, rd1, 2U));
+        if ((length <= LIN_TP_SF_MAX_DATA) || (length > channel->rx_capacity)){
+            channel->state = (channel->state == LIN_TP_STATE_RX) ? LIN_TP_STATE_IDLE : channel->state;
+            return (true);
+        }
+        if (channel->state == LIN_TP_STATE_TX){
+            lin_tp_stop_response(sci_lin_reg, channel);
+        }
+        channel->request_nad = nad;
+        channel->rx_length = length;
+        channel->rx_offset = 0U;
+        channel->rx_sn = 1U;
+        lin_tp_copy_payload(channel, rd0, rd1, 3U, LIN_TP_FF_DATA);
+        channel->state = LIN_TP_STATE_RX;
+        break;
+
+    case LIN_TP_PCI_TYPE_CF:
+        if (channel->state != LIN_TP_STATE_RX){
+            return (true);
+        }
+        // Lost or repeated frame: the whole request is discarded
+        if ((pci & LIN_TP_SN_MASK) != channel->rx_sn){
+            channel->state = LIN_TP_STATE_IDLE;
+            return (true);
+        }
+        channel->rx_sn = (channel->rx_sn + 1U) & LIN_TP_SN_MASK;
+        lin_tp_copy_payload(channel, rd0, rd1, 2U, LIN_TP_CF_DATA);
+        if (channel->rx_offset == channel->rx_length){
+            lin_tp_rx_complete(sci_lin_reg, channel);
+        }
+        break;
+
+    default:
+        return (false);
+    }
+
+    return (true);
+}
+
+bool linTpIdInterruptHandler(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+    bool     started = linSlaveIdInterruptHandler(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !started){
+        return (started);
+    }
+    if (GET_BITS(sci_lin_reg[TMS570_LIN_ID], TMS570_LIN_ID_RECEIVER_ID_OFFSET, 6U) != LIN_TP_SRF_ID){
+        return (started);
+    }
+
+    volatile struct g_linTpChannel* channel = &g_linTpChannel_t[index];
+    if (channel->state != LIN_TP_STATE_TX){
+        return (started);
+    }
+
+    // The current frame is already in LINTD0/1, so the table slot is free for the next one
+    if (channel->tx_offset >= channel->tx_length){
+        lin_tp_stop_response(sci_lin_reg, channel);
+    } else {
+        lin_tp_publish_next(sci_lin_reg, channel);
+    }
+    return (started);
+}
@@ -0,0 +1,122 @@
+#ifndef LIN_TP_H
+#define LIN_TP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Master request frame identifier (diagnostic request). */
+#define LIN_TP_MRF_ID               (0x3CU)
+
+/** @brief Slave response frame identifier (diagnostic response). */
+#define LIN_TP_SRF_ID               (0x3DU)
+
+/** @brief Largest PDU that a first frame can announce (12-bit length). */
+#define LIN_TP_MAX_PDU_LEN          (4095U)
+
+/** @brief Functional NAD, accepted in addition to the configured NAD. */
+#define LIN_TP_NAD_FUNCTIONAL       (0x7EU)
+
+/** @brief Broadcast NAD, accepted in addition to the configured NAD. */
+#define LIN_TP_NAD_BROADCAST        (0x7FU)
+
+/**
+ * @enum lin_tp_state_e
+ * @brief Transport layer channel states.
+ */
+typedef enum lin_tp_state_e {
+    LIN_TP_STATE_IDLE = 0,      /** Waiting for a request */
+    LIN_TP_STATE_RX,            /** Reassembling a segmented request */
+    LIN_TP_STATE_RX_COMPLETE,   /** Request handed to the application, waiting for linTpSend/linTpRelease */
+    LIN_TP_STATE_TX,            /** Transmitting a response on the slave response frame */
+    NUM_OF_LIN_TP_STATE         /** Number of transport layer states */
+} lin_tp_state_t;
+
+/**
+ * @brief Request reception callback.
+ *
+ * Called from interrupt context once a request PDU is complete. The data
+ * points into the receive buffer given to linTpInit() and stays valid until
+ * linTpSend() or linTpRelease() is called.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] nad NAD the request was addressed to.
+ * @param[in] data Request PDU (SID first).
+ * @param[in] length Request PDU length in bytes.
+ */
+typedef void (*lin_tp_rx_callback_t)(volatile tms570_reg* sci_lin_reg, uint8_t nad, uint8_t* data, uint16_t length);
+
+/**
+ * @brief Initialize the diagnostic transport layer of an SCI/LIN instance.
+ *
+ * Subscribes to the master request frame through the slave response table,
+ * so linSlaveInit() must have been called on the instance first.
+ *
+ * @note Diagnostic frames use the classic checksum; GCR1 CTYPE must select it
+ * while diagnostic traffic is running.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] nad Node address of this slave.
+ * @param[in] rx_buffer Reassembly buffer, owned by the transport layer from now on.
+ * @param[in] rx_capacity Size of rx_buffer in bytes.
+ * @param[in] rx_callback Called when a request is complete, may be NULL for polling.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool linTpInit(volatile tms570_reg* sci_lin_reg, uint8_t nad, uint8_t* rx_buffer, uint16_t rx_capacity, lin_tp_rx_callback_t rx_callback);
+
+/**
+ * @brief Start sending a response PDU.
+ *
+ * The PDU is segmented straight out of data, which must stay valid until the
+ * channel returns to LIN_TP_STATE_IDLE. The first frame is published at once
+ * and each further frame is pre-packed as soon as the previous one starts.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] data Response PDU (RSID first).
+ * @param[in] length Response PDU length, 1 to LIN_TP_MAX_PDU_LEN bytes.
+ * @return true if the response was queued, false otherwise.
+ */
+bool linTpSend(volatile tms570_reg* sci_lin_reg, const uint8_t* data, uint16_t length);
+
+/**
+ * @brief Hand the receive buffer back without sending a response.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if the channel is idle afterwards, false otherwise.
+ */
+bool linTpRelease(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Get the current transport layer state.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] state Pointer to store the state. @see lin_tp_state_t
+ * @return true if the state was read, false otherwise.
+ */
+bool linTpGetState(volatile tms570_reg* sci_lin_reg, lin_tp_state_t* state);
+
+/**
+ * @brief Receive interrupt handler: consume a master request frame.
+ *
+ * Reads LINRD0/LINRD1 of a received 0x3C frame and writes the payload
+ * directly into the reassembly buffer.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if the frame was consumed by the transport layer, false otherwise.
+ */
+bool linTpRxInterruptHandler(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief ID interrupt handler: start the response and advance the transport layer.
+ *
+ * Runs linSlaveIdInterruptHandler() and, when a slave response frame was
+ * started, packs the next frame into the response table so it is ready
+ * before the master sends the next header. Use it in place of
+ * linSlaveIdInterruptHandler() on instances running the transport layer.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if a response was started, false otherwise.
+ */
+bool linTpIdInterruptHandler(volatile tms570_reg* sci_lin_reg);
+
+#endif // LIN_TP_H
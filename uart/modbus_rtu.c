@@ -0,0 +1,320 @@
+#include <stdatomic.h>
+#include "modbus_rtu.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_isr.h"
+#include "sci_sg.h"
+#include "sci_crc.h"
+#include "sci_cycle.h"
+#include "sci_stats.h"
+#include "uart_config.h"
+
+#define MODBUS_RTU_FUNC_READ_HOLDING    (0x03U)
+#define MODBUS_RTU_FUNC_READ_INPUT      (0x04U)
+#define MODBUS_RTU_FUNC_WRITE_SINGLE    (0x06U)
+#define MODBUS_RTU_FUNC_WRITE_MULTIPLE  (0x10U)
+#define MODBUS_RTU_EXCEPTION_FLAG       (0x80U)
+
+#define MODBUS_RTU_MAX_READ             (125U)
+#define MODBUS_RTU_MAX_WRITE            (123U)
+
+/* Address, function and CRC: the shortest frame. */
+#define MODBUS_RTU_MIN_FRAME_LEN        (4U)
+
+static volatile struct g_modbusRtu
+{
+    const modbus_rtu_map_t* map;            /* Register map */
+    uint8_t                 address;        /* Own slave address */
+    bool                    busy;           /* Request being handled or response in flight, RX bytes are dropped */
+    bool                    frame_error;    /* 1.5 character gap or overflow inside the current frame */
+    uint32_t                length;         /* Bytes in the frame buffer */
+    uint32_t                last_cycle;     /* Cycle counter at the last received byte */
+    uint32_t                t15;            /* 1.5 character times in cycles */
+    uint32_t                t35;            /* 3.5 character times in cycles */
+    modbus_rtu_stats_t      stats;          /* Counters */
+} g_modbusRtu_t[SCI_LIN_NUM_OF_INSTANCES];
+
+/* Request and response share the buffer, written by the RX interrupt and the task in turn. */
+static uint8_t g_modbusRtuFrame[SCI_LIN_NUM_OF_INSTANCES][MODBUS_RTU_MAX_FRAME_LEN];
+
+static void modbus_rtu_restart(volatile struct g_modbusRtu* slave){
+    slave->length = 0U;
+    slave->frame_error = false;
+    atomic_signal_fence(memory_order_release);
+    slave->busy = false;
+}
+
+static void modbus_rtu_rx(volatile tms570_reg* sci_lin_reg, uint8_t vector){
+    // Reading RD clears the RX flag, so it happens whatever the state
+    uint8_t  byte = (uint8_t)GET_BITS(sci_lin_reg[TMS570_SCI_RD], TMS570_SCI_RD_RD_OFFSET, TMS570_SCI_RD_RD_BIT_LEN);
+    uint32_t now = sciCycleNow();
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    (void)vector;
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return;
+    }
+    sciStatsAdd(sci_lin_reg, SCI_STATS_RX_BYTES, 1U);
+
+    volatile struct g_modbusRtu* slave = &g_modbusRtu_t[index];
+    if (slave->busy){
+        slave->stats.overruns++;
+        return;
+    }
+
+    if (slave->length != 0U){
+        uint32_t gap = now - slave->last_cycle;
+        if (gap >= slave->t35){
+            // The previous frame was not picked up within t3.5, it is lost
+            slave->stats.gap_errors++;
+            slave->length = 0U;
+            slave->frame_error = false;
+        } else if (gap > slave->t15){
+            slave->frame_error = true;
+        }
+    }
+
+    if (slave->length < MODBUS_RTU_MAX_FRAME_LEN){
+        g_modbusRtuFrame[index][slave->length] = byte;
+        slave->length++;
+    } else {
+        slave->frame_error = true;
+    }
+    slave->last_cycle = now;
+}
+
+static void modbus_rtu_sent(volatile tms570_reg* sci_lin_reg, const sci_sg_segment_t* segment){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    (void)segment;
+    if (index < SCI_LIN_NUM_OF_INSTANCES){
+        modbus_rtu_restart(&g_modbusRtu_t[index]);
+    }
+}
+
+/* Binary search for the entry holding [address, address + count). */
+static const modbus_rtu_range_t* modbus_rtu_find(const modbus_rtu_range_t* table, uint32_t entries, uint16_t address, uint16_t count){
+    uint32_t low = 0U;
+    uint32_t high = entries;
+
+    if (table == NULL){
+        return (NULL);
+    }
+    while (low < high){
+        uint32_t mid = low + ((high - low) / 2U);
+        if (table[mid].start <= address){
+            low = mid + 1U;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == 0U){
+        return (NULL);
+    }
+
+    const modbus_rtu_range_t* range = &table[low - 1U];
+    if (((uint32_t)address + count) > ((uint32_t)range->start + range->count)){
+        return (NULL);
+    }
+    return (range);
+}
+
+static uint16_t modbus_rtu_get16(const uint8_t* data){
+    return (uint16_t)(((uint16_t)data[0] << 8) | data[1]);
+}
+
+static uint32_t modbus_rtu_exception(uint8_t* frame, modbus_rtu_exception_t exception){
+    frame[1] |= MODBUS_RTU_EXCEPTION_FLAG;
+    frame[2] = (uint8_t)exception;
+    return (3U);
+}
+
+/* Executes the PDU and writes the response over the request; returns the response length without CRC. */
+static uint32_t modbus_rtu_execute(const modbus_rtu_map_t* map, uint8_t* frame, uint32_t length){
+    uint8_t  function = frame[1];
+    uint16_t start = (length >= 4U) ? modbus_rtu_get16(&frame[2]) : 0U;
+    uint16_t quantity = (length >= 6U) ? modbus_rtu_get16(&frame[4]) : 0U;
+    const modbus_rtu_range_t* range;
+
+    switch (function){
+    case MODBUS_RTU_FUNC_READ_HOLDING:
+    case MODBUS_RTU_FUNC_READ_INPUT:
+        if ((length != 6U) || (quantity == 0U) || (quantity > MODBUS_RTU_MAX_READ)){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE);
+        }
+        range = (function == MODBUS_RTU_FUNC_READ_HOLDING) ? modbus_rtu_find(map->holding, map->holding_count, start, quantity) :
+                                                              modbus_rtu_find(map->input, map->input_count, start, quantity);
+        if ((range == NULL) || (range->read == NULL)){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS);
+        }
+        // start and quantity are in locals, the register data may overwrite them
+        frame[2] = (uint8_t)(2U * quantity);
+        if (!range->read(range->context, (uint16_t)(start - range->start), quantity, &frame[3])){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_DEVICE_FAILURE);
+        }
+        return (3U + (2U * quantity));
+
+    case MODBUS_RTU_FUNC_WRITE_SINGLE:
+        if (length != 6U){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE);
+        }
+        range = modbus_rtu_find(map->holding, map->holding_count, start, 1U);
+        if ((range == NULL) || (range->write == NULL)){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS);
+        }
+        if (!range->write(range->context, (uint16_t)(start - range->start), 1U, &frame[4])){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_DEVICE_FAILURE);
+        }
+        // The response echoes the request
+        return (6U);
+
+    case MODBUS_RTU_FUNC_WRITE_MULTIPLE:
+        if ((length < 7U) || (quantity == 0U) || (quantity > MODBUS_RTU_MAX_WRITE) ||
+            (frame[6] != (2U * quantity)) || (length != (7U + frame[6]))){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE);
+        }
+        range = modbus_rtu_find(map->holding, map->holding_count, start, quantity);
+        if ((range == NULL) || (range->write == NULL)){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS);
+        }
+        if (!range->write(range->context, (uint16_t)(start - range->start), quantity, &frame[7])){
+            return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_DEVICE_FAILURE);
+        }
+        // The response is the first six bytes of the request
+        return (6U);
+
+    default:
+        return modbus_rtu_exception(frame, MODBUS_RTU_EXCEPTION_ILLEGAL_FUNCTION);
+    }
+}
+
+bool modbusRtuUpdateTiming(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    // Asynchronous timing: one bit is 16 * (P + 1) + M VCLK cycles
+    uint32_t brs = sci_lin_reg[TMS570_SCI_BRS];
+    uint32_t p = GET_BITS(brs, TMS570_SCI_BRS_PRESCALER_P_OFFSET, TMS570_SCI_BRS_PRESCALER_P_BIT_LEN);
+    uint32_t m = GET_BITS(brs, TMS570_SCI_BRS_M_OFFSET, TMS570_SCI_BRS_M_BIT_LEN);
+    uint32_t bit_vclk = (16U * (p + 1U)) + m;
+
+    if ((VCLK_FREQ / bit_vclk) > MODBUS_RTU_FIXED_TIMING_BAUD){
+        g_modbusRtu_t[index].t15 = 750U * SCI_CYCLE_PER_US;
+        g_modbusRtu_t[index].t35 = 1750U * SCI_CYCLE_PER_US;
+    } else {
+        // An RTU character is 11 bits: 1.5 characters are 33 / 2 bits, 3.5 characters 77 / 2 bits
+        g_modbusRtu_t[index].t15 = (uint32_t)(((uint64_t)bit_vclk * 33U * GCLK_FREQ) / (2U * (uint64_t)VCLK_FREQ));
+        g_modbusRtu_t[index].t35 = (uint32_t)(((uint64_t)bit_vclk * 77U * GCLK_FREQ) / (2U * (uint64_t)VCLK_FREQ));
+    }
+    return (true);
+}
+
+bool modbusRtuInit(volatile tms570_reg* sci_lin_reg, uint8_t address, const modbus_rtu_map_t* map){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (address == MODBUS_RTU_BROADCAST_ADDRESS) || (address > 247U) || (map == NULL)){
+        return (false);
+    }
+
+    volatile struct g_modbusRtu* slave = &g_modbusRtu_t[index];
+    slave->map = map;
+    slave->address = address;
+    slave->stats.frames = 0U;
+    slave->stats.crc_errors = 0U;
+    slave->stats.gap_errors = 0U;
+    slave->stats.exceptions = 0U;
+    slave->stats.overruns = 0U;
+    slave->last_cycle = 0U;
+    modbus_rtu_restart(slave);
+
+    sciCycleInit();
+    if (!modbusRtuUpdateTiming(sci_lin_reg) || !sciSgInit(sci_lin_reg) ||
+        !sciIsrRegisterHandler(sci_lin_reg, SCI_INT_VECTOR_RX, modbus_rtu_rx)){
+        return (false);
+    }
+
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], MAKE_MASK(TMS570_SCI_SET_INT_SET_RX_INT_OFFSET, TMS570_SCI_SET_INT_SET_RX_INT_BIT_LEN));
+    return (true);
+}
+
+bool modbusRtuProcess(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile struct g_modbusRtu* slave = &g_modbusRtu_t[index];
+    if (slave->busy || (slave->length == 0U)){
+        return (false);
+    }
+
+    // The t3.5 check and the claim must not be split by an RX byte, which would restart the frame under us.
+    // A byte arriving meanwhile waits in RD, far less than a character time.
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_CLEAR_INT], MAKE_MASK(TMS570_SCI_CLEAR_INT_CLEAR_RX_INT_OFFSET, TMS570_SCI_CLEAR_INT_CLEAR_RX_INT_BIT_LEN));
+    atomic_signal_fence(memory_order_seq_cst);
+    bool expired = (slave->length != 0U) && ((sciCycleNow() - slave->last_cycle) >= slave->t35);
+    if (expired){
+        // From here on the RX interrupt leaves the buffer alone until the response has gone out
+        slave->busy = true;
+    }
+    atomic_signal_fence(memory_order_seq_cst);
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], MAKE_MASK(TMS570_SCI_SET_INT_SET_RX_INT_OFFSET, TMS570_SCI_SET_INT_SET_RX_INT_BIT_LEN));
+    if (!expired){
+        return (false);
+    }
+
+    uint8_t* frame = g_modbusRtuFrame[index];
+    uint32_t length = slave->length;
+    uint32_t response = 0U;
+
+    if (slave->frame_error){
+        slave->stats.gap_errors++;
+    } else if ((length < MODBUS_RTU_MIN_FRAME_LEN) || (sciCrc16ModbusUpdate(SCI_CRC16_MODBUS_INIT, frame, length) != 0U)){
+        // A good frame leaves a zero residue with its own CRC included
+        slave->stats.crc_errors++;
+    } else if ((frame[0] == slave->address) || (frame[0] == MODBUS_RTU_BROADCAST_ADDRESS)){
+        slave->stats.frames++;
+        sciStatsAdd(sci_lin_reg, SCI_STATS_RX_FRAMES, 1U);
+        response = modbus_rtu_execute(slave->map, frame, length - 2U);
+        if (frame[0] == MODBUS_RTU_BROADCAST_ADDRESS){
+            // Broadcasts are never answered, not even with an exception
+            response = 0U;
+        } else if ((frame[1] & MODBUS_RTU_EXCEPTION_FLAG) != 0U){
+            slave->stats.exceptions++;
+        }
+    }
+
+    if (response != 0U){
+        uint16_t crc = sciCrc16ModbusUpdate(SCI_CRC16_MODBUS_INIT, frame, response);
+        frame[response] = (uint8_t)crc;
+        frame[response + 1U] = (uint8_t)(crc >> 8);
+
+        sci_sg_segment_t segment = { frame, response + 2U, modbus_rtu_sent, NULL };
+        if (sciSgSend(sci_lin_reg, &segment, 1U)){
+            sciStatsAdd(sci_lin_reg, SCI_STATS_TX_FRAMES, 1U);
+            return (true);
+        }
+    }
+
+    modbus_rtu_restart(slave);
+    return (true);
+}
+
+bool modbusRtuGetStats(volatile tms570_reg* sci_lin_reg, modbus_rtu_stats_t* stats){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (stats == NULL)){
+        return (false);
+    }
+
+    stats->frames = g_modbusRtu_t[index].stats.frames;
+    stats->crc_errors = g_modbusRtu_t[index].stats.crc_errors;
+    stats->gap_errors = g_modbusRtu_t[index].stats.gap_errors;
+    stats->exceptions = g_modbusRtu_t[index].stats.exceptions;
+    stats->overruns = g_modbusRtu_t[index].stats.overruns;
+    return (true);
+}
@@ -0,0 +1,129 @@
+#ifndef MODBUS_RTU_H
+#define MODBUS_RTU_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Largest RTU frame: address, PDU of up to 253 bytes and CRC. */
+#define MODBUS_RTU_MAX_FRAME_LEN        (256U)
+
+/** @brief Broadcast slave address, requests are executed without a response. */
+#define MODBUS_RTU_BROADCAST_ADDRESS    (0U)
+
+/** @brief Above this baud rate the spec fixes t1.5 at 750 us and t3.5 at 1750 us. */
+#define MODBUS_RTU_FIXED_TIMING_BAUD    (19200U)
+
+/**
+ * @enum modbus_rtu_exception_e
+ * @brief Exception codes returned to the master.
+ */
+typedef enum modbus_rtu_exception_e {
+    MODBUS_RTU_EXCEPTION_NONE = 0,              /** Request executed */
+    MODBUS_RTU_EXCEPTION_ILLEGAL_FUNCTION,      /** Function code not supported */
+    MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS,       /** Register range not mapped by a single entry */
+    MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE,         /** Quantity or byte count out of range */
+    MODBUS_RTU_EXCEPTION_DEVICE_FAILURE,        /** Handler reported a failure */
+    NUM_OF_MODBUS_RTU_EXCEPTION                 /** Number of exception codes */
+} modbus_rtu_exception_t;
+
+/**
+ * @brief Register block read handler.
+ *
+ * @param[in] context Context of the range.
+ * @param[in] offset First register, relative to the start of the range.
+ * @param[in] count Number of registers.
+ * @param[out] data Big-endian register values, written in place into the response.
+ * @return true if read, false to answer with a device failure.
+ */
+typedef bool (*modbus_rtu_read_t)(void* context, uint16_t offset, uint16_t count, uint8_t* data);
+
+/**
+ * @brief Register block write handler.
+ *
+ * @param[in] context Context of the range.
+ * @param[in] offset First register, relative to the start of the range.
+ * @param[in] count Number of registers.
+ * @param[in] data Big-endian register values from the request.
+ * @return true if written, false to answer with a device failure.
+ */
+typedef bool (*modbus_rtu_write_t)(void* context, uint16_t offset, uint16_t count, const uint8_t* data);
+
+/**
+ * @struct modbus_rtu_range_s
+ * @brief One contiguous block of registers.
+ */
+typedef struct modbus_rtu_range_s {
+    uint16_t           start;       /** First register address */
+    uint16_t           count;       /** Number of registers */
+    modbus_rtu_read_t  read;        /** Read handler, NULL if not readable */
+    modbus_rtu_write_t write;       /** Write handler, NULL if read-only */
+    void*              context;     /** Passed to the handlers */
+} modbus_rtu_range_t;
+
+/**
+ * @struct modbus_rtu_map_s
+ * @brief Register map of a slave, each table sorted by start without overlaps.
+ */
+typedef struct modbus_rtu_map_s {
+    const modbus_rtu_range_t* holding;          /** Holding registers: functions 0x03, 0x06, 0x10 */
+    uint32_t                  holding_count;    /** Entries in holding */
+    const modbus_rtu_range_t* input;            /** Input registers: function 0x04 */
+    uint32_t                  input_count;      /** Entries in input */
+} modbus_rtu_map_t;
+
+/**
+ * @struct modbus_rtu_stats_s
+ * @brief Slave counters.
+ */
+typedef struct modbus_rtu_stats_s {
+    uint32_t frames;        /** Frames addressed to this slave with a valid CRC */
+    uint32_t crc_errors;    /** Frames dropped for a bad CRC */
+    uint32_t gap_errors;    /** Frames dropped for a 1.5 character gap inside the frame or overflow */
+    uint32_t exceptions;    /** Exception responses sent */
+    uint32_t overruns;      /** Bytes dropped while a request was being handled */
+} modbus_rtu_stats_t;
+
+/**
+ * @brief Start a Modbus RTU slave on an SCI instance.
+ *
+ * Takes over the RX vector of the interrupt dispatcher and the TX refill
+ * hook (responses are sent with sciSgSend() straight from the RX buffer), so
+ * sciIsrInit() must have run. Inter-frame timing follows the current BRS.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] address Slave address (1 - 247).
+ * @param[in] map Register map, must stay valid. @see modbus_rtu_map_t
+ * @return true if started, false otherwise.
+ */
+bool modbusRtuInit(volatile tms570_reg* sci_lin_reg, uint8_t address, const modbus_rtu_map_t* map);
+
+/**
+ * @brief Recompute t1.5 and t3.5 from BRS, e.g. after a baud rate change.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if updated, false otherwise.
+ */
+bool modbusRtuUpdateTiming(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Handle a request once the 3.5 character gap has passed.
+ *
+ * Call from the main loop at least once per t3.5. The response is built in
+ * the RX buffer and queued without copying.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if a request was handled, false otherwise.
+ */
+bool modbusRtuProcess(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Read the slave counters.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] stats Pointer to store the counters. @see modbus_rtu_stats_t
+ * @return true if read, false otherwise.
+ */
+bool modbusRtuGetStats(volatile tms570_reg* sci_lin_reg, modbus_rtu_stats_t* stats);
+
+#endif // MODBUS_RTU_H
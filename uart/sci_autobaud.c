@@ -0,0 +1,124 @@
+#include "sci_autobaud.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_cycle.h"
+#include "uart_config.h"
+
+/** @brief Falling edges of a 0x55 character: start bit and data bits 1, 3, 5, 7. */
+#define SCI_AUTOBAUD_SYNC_EDGES     (5U)
+
+/** @brief Bit times spanned by the sync edges. */
+#define SCI_AUTOBAUD_SYNC_BITS      (8U)
+
+/* Rates host tools use, ascending. */
+static const uint32_t s_sciAutobaudStandard[] = {
+    1200U, 2400U, 4800U, 9600U, 19200U, 38400U, 57600U, 115200U, 230400U, 460800U, 921600U, 1000000U,
+};
+
+static inline uint32_t sci_autobaud_rx_pin(volatile tms570_reg* sci_lin_reg){
+    return GET_BITS(sci_lin_reg[TMS570_SCI_PIO_2], TMS570_SCI_PIO_2_RX_IN_OFFSET, TMS570_SCI_PIO_2_RX_IN_BIT_LEN);
+}
+
+static uint32_t sci_autobaud_snap(uint32_t measured){
+    for (uint32_t entry = 0U; entry < (sizeof(s_sciAutobaudStandard) / sizeof(s_sciAutobaudStandard[0])); entry++){
+        uint32_t standard = s_sciAutobaudStandard[entry];
+        uint32_t deviation = (measured > standard) ? (measured - standard) : (standard - measured);
+        if (((uint64_t)deviation * 1000U) <= ((uint64_t)standard * SCI_AUTOBAUD_SNAP_PERMILLE)){
+            return (standard);
+        }
+    }
+    return (measured);
+}
+
+/* Each falling-to-falling period is two bits; all four must lie within 25 % of their mean. */
+static bool sci_autobaud_sync_even(const uint32_t* edge){
+    uint32_t total = edge[SCI_AUTOBAUD_SYNC_EDGES - 1U] - edge[0];
+
+    for (uint32_t period = 1U; period < SCI_AUTOBAUD_SYNC_EDGES; period++){
+        uint32_t scaled = (edge[period] - edge[period - 1U]) * (SCI_AUTOBAUD_SYNC_EDGES - 1U);
+        uint32_t deviation = (scaled > total) ? (scaled - total) : (total - scaled);
+        if (deviation > (total / 4U)){
+            return (false);
+        }
+    }
+    return (true);
+}
+
+// Returns the cycles spanned by bits bit times, 0 on timeout
+static uint32_t sci_autobaud_measure(volatile tms570_reg* sci_lin_reg, sci_autobaud_mode_t mode, uint32_t deadline, uint32_t* bits){
+    uint32_t edge[SCI_AUTOBAUD_SYNC_EDGES] = { 0U };
+    uint32_t edges = 0U;
+    uint32_t level = sci_autobaud_rx_pin(sci_lin_reg);
+
+    while (!sciCycleExpired(deadline)){
+        uint32_t sample = sci_autobaud_rx_pin(sci_lin_reg);
+        if (sample == level){
+            continue;
+        }
+        uint32_t now = sciCycleNow();
+        level = sample;
+
+        if (mode == SCI_AUTOBAUD_MODE_START_BIT){
+            if (level == 0U){
+                edge[0] = now;
+                edges = 1U;
+            } else if (edges != 0U){
+                *bits = 1U;
+                return (now - edge[0]);
+            }
+        } else if (level == 0U){
+            // Slide the window so a break or garbage ahead of the sync character falls out of it
+            for (uint32_t slot = 1U; slot < SCI_AUTOBAUD_SYNC_EDGES; slot++){
+                edge[slot - 1U] = edge[slot];
+            }
+            edge[SCI_AUTOBAUD_SYNC_EDGES - 1U] = now;
+            edges++;
+            if ((edges >= SCI_AUTOBAUD_SYNC_EDGES) && sci_autobaud_sync_even(edge)){
+                *bits = SCI_AUTOBAUD_SYNC_BITS;
+                return (now - edge[0]);
+            }
+        }
+    }
+    return (0U);
+}
+
+bool sciAutobaudDetect(volatile tms570_reg* sci_lin_reg, sci_autobaud_mode_t mode, uint32_t deadline, sci_autobaud_result_t* result){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+    uint32_t bits = 0U;
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(mode, NUM_OF_SCI_AUTOBAUD_MODE) || (result == NULL)){
+        return (false);
+    }
+
+    uint32_t cycles = sci_autobaud_measure(sci_lin_reg, mode, deadline, &bits);
+    if (cycles == 0U){
+        return (false);
+    }
+
+    result->bit_cycles = (cycles + (bits / 2U)) / bits;
+    result->measured = (uint32_t)((((uint64_t)GCLK_FREQ * bits) + (cycles / 2U)) / cycles);
+    result->baudrate = sci_autobaud_snap(result->measured);
+
+    bool async = (GET_BITS(sci_lin_reg[TMS570_SCI_GCR1], TMS570_SCI_GCR1_TIMING_MODE_OFFSET, TMS570_SCI_GCR1_TIMING_MODE_BIT_LEN) == 1U);
+    if (!sciBaudrateToBrs(result->baudrate, async, &result->brs)){
+        return (false);
+    }
+
+    // Leaving reset while the line is low would start a frame in the middle of the character
+    while (sci_autobaud_rx_pin(sci_lin_reg) == 0U){
+        if (sciCycleExpired(deadline)){
+            return (false);
+        }
+    }
+    if (!sciSwitchBaudrate(sci_lin_reg, result->baudrate, deadline)){
+        return (false);
+    }
+
+    // FLR is write-1-to-clear; whatever was received at the old rate is garbage
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_FLR], MAKE_MASK(TMS570_SCI_FLR_PE_OFFSET, TMS570_SCI_FLR_PE_BIT_LEN) |
+                                                        MAKE_MASK(TMS570_SCI_FLR_OE_OFFSET, TMS570_SCI_FLR_OE_BIT_LEN) |
+                                                        MAKE_MASK(TMS570_SCI_FLR_FE_OFFSET, TMS570_SCI_FLR_FE_BIT_LEN) |
+                                                        MAKE_MASK(TMS570_SCI_FLR_BRKDT_OFFSET, TMS570_SCI_FLR_BRKDT_BIT_LEN));
+    (void)sci_lin_reg[TMS570_SCI_RD];
+    return (true);
+}
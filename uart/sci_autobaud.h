@@ -0,0 +1,53 @@
+#ifndef SCI_AUTOBAUD_H
+#define SCI_AUTOBAUD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Largest deviation from a standard rate that is still snapped to it, in permille. */
+#define SCI_AUTOBAUD_SNAP_PERMILLE      (30U)
+
+/**
+ * @enum sci_autobaud_mode_e
+ * @brief What the host sends for the rate to be measured.
+ */
+typedef enum sci_autobaud_mode_e {
+    SCI_AUTOBAUD_MODE_SYNC = 0,     /** A 0x55 sync character, its five falling edges span eight bits; a leading break is skipped */
+    SCI_AUTOBAUD_MODE_START_BIT,    /** Any character with bit 0 set, the first low pulse is one bit wide */
+    NUM_OF_SCI_AUTOBAUD_MODE        /** Number of modes */
+} sci_autobaud_mode_t;
+
+/**
+ * @struct sci_autobaud_result_s
+ * @brief Outcome of one detection.
+ */
+typedef struct sci_autobaud_result_s {
+    uint32_t baudrate;  /** Rate programmed, snapped to a standard rate when close enough, in bit/s */
+    uint32_t measured;  /** Rate measured on the RX pin in bit/s */
+    uint32_t bit_cycles;/** Measured bit time in cycle counter ticks */
+    uint32_t brs;       /** BRS word programmed */
+} sci_autobaud_result_t;
+
+/**
+ * @brief Detect the host baud rate on the RX pin and switch to it.
+ *
+ * Samples RX_IN of PIO_2 against the cycle counter until the character
+ * selected by mode has been seen, then waits for the line to return high
+ * and applies the rate with sciSwitchBaudrate(). Error flags and bytes the
+ * receiver collected at the old rate are discarded, so the next character
+ * is received at the new rate.
+ *
+ * Polls without yielding; an interrupt taken during the measurement
+ * stretches an edge. Sync mode rejects uneven edge spacing and keeps
+ * measuring, start-bit mode cannot tell.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] mode What the host sends. @see sci_autobaud_mode_t
+ * @param[in] deadline Cycle counter deadline from sciCycleDeadline().
+ * @param[out] result Pointer to store the outcome. @see sci_autobaud_result_t
+ * @return true if a rate was detected and applied, false otherwise.
+ */
+bool sciAutobaudDetect(volatile tms570_reg* sci_lin_reg, sci_autobaud_mode_t mode, uint32_t deadline, sci_autobaud_result_t* result);
+
+#endif // SCI_AUTOBAUD_H
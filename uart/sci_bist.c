@@ -0,0 +1,241 @@
+#include "sci_bist.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_stats.h"
+#include "sci_cycle.h"
+#include "uart_config.h"
+
+/** @brief PRBS-9 seed, any non-zero 9-bit value. */
+#define SCI_BIST_PRBS_SEED      (0x1FFU)
+
+/** @brief Frame times without progress before a loopback is declared stalled. */
+#define SCI_BIST_STALL_FRAMES   (4U)
+
+/** @brief Bits budgeted per frame: start, 8 data, parity and two stop bits. */
+#define SCI_BIST_FRAME_BITS     (12U)
+
+/** @brief Most bytes sent while one error class is injected. */
+#define SCI_BIST_INJECT_BYTES   (2U)
+
+/* Injection of one error class, indexed by sci_bist_error_class_t. */
+static const struct sci_bist_injection_s {
+    bool     (*inject)(volatile tms570_reg* sci_lin_reg, uint8_t enable);  /* NULL: provoked by traffic alone */
+    uint32_t flag;      /* FLR flag, write-1-to-clear */
+    uint32_t enable;    /* SET_INT / CLEAR_INT bit */
+    uint8_t  vector;    /* Vector offset counted by the dispatcher */
+    uint8_t  bytes;     /* Bytes sent while injecting */
+} s_sciBistInjection[NUM_OF_SCI_BIST_ERROR] = {
+    { sci_set_pen_enable,
+      MAKE_MASK(TMS570_SCI_FLR_PE_OFFSET, TMS570_SCI_FLR_PE_BIT_LEN),
+      MAKE_MASK(TMS570_SCI_SET_INT_SET_PE_INT_OFFSET, TMS570_SCI_SET_INT_SET_PE_INT_BIT_LEN),
+      SCI_INT_VECTOR_PE, 1U },
+    { sci_set_fen_enable,
+      MAKE_MASK(TMS570_SCI_FLR_FE_OFFSET, TMS570_SCI_FLR_FE_BIT_LEN),
+      MAKE_MASK(TMS570_SCI_SET_INT_SET_FE_INT_OFFSET, TMS570_SCI_SET_INT_SET_FE_INT_BIT_LEN),
+      SCI_INT_VECTOR_FE, 1U },
+    { sci_set_brkdt_enable,
+      MAKE_MASK(TMS570_SCI_FLR_BRKDT_OFFSET, TMS570_SCI_FLR_BRKDT_BIT_LEN),
+      MAKE_MASK(TMS570_SCI_SET_INT_SET_BRKDT_INT_OFFSET, TMS570_SCI_SET_INT_SET_BRKDT_INT_BIT_LEN),
+      SCI_INT_VECTOR_BRKDT, 1U },
+    // The first byte waits in RD, the second one overruns it
+    { NULL,
+      MAKE_MASK(TMS570_SCI_FLR_OE_OFFSET, TMS570_SCI_FLR_OE_BIT_LEN),
+      MAKE_MASK(TMS570_SCI_SET_INT_SET_OE_INT_OFFSET, TMS570_SCI_SET_INT_SET_OE_INT_BIT_LEN),
+      SCI_INT_VECTOR_OE, 2U },
+};
+
+static const uint8_t s_sciBistInjectBytes[SCI_BIST_INJECT_BYTES] = { 0x55U, 0x55U };
+
+/* x^9 + x^5 + 1, eight steps per byte, MSB first. */
+static uint8_t sci_bist_prbs9(uint16_t* state){
+    uint8_t byte = 0U;
+
+    for (uint32_t bit = 0U; bit < 8U; bit++){
+        uint16_t out = (uint16_t)(((*state >> 8) ^ (*state >> 4)) & 1U);
+        *state = (uint16_t)(((*state << 1) | out) & 0x1FFU);
+        byte = (uint8_t)((byte << 1) | out);
+    }
+    return (byte);
+}
+
+/* One bit is 16 * (P + 1) + M VCLK cycles. */
+static uint32_t sci_bist_frame_cycles(uint32_t brs){
+    uint32_t p = GET_BITS(brs, TMS570_SCI_BRS_PRESCALER_P_OFFSET, TMS570_SCI_BRS_PRESCALER_P_BIT_LEN);
+    uint32_t m = GET_BITS(brs, TMS570_SCI_BRS_M_OFFSET, TMS570_SCI_BRS_M_BIT_LEN);
+    uint32_t ticks = (16U * (p + 1U)) + m;
+    return (uint32_t)(((uint64_t)ticks * SCI_BIST_FRAME_BITS * GCLK_FREQ) / VCLK_FREQ);
+}
+
+/* GCR1 and BRS are only rewritten while SWnRST holds the state machines in reset. */
+static bool sci_bist_configure(volatile tms570_reg* sci_lin_reg, uint32_t gcr1, uint32_t brs, uint32_t deadline){
+    uint32_t swnrst = MAKE_MASK(TMS570_SCI_GCR1_SWnRST_OFFSET, TMS570_SCI_GCR1_SWnRST_BIT_LEN);
+
+    while (GET_BITS(sci_lin_reg[TMS570_SCI_FLR], TMS570_SCI_FLR_TX_EMPTY_OFFSET, TMS570_SCI_FLR_TX_EMPTY_BIT_LEN) == 0U){
+        if (sciCycleExpired(deadline)){
+            return (false);
+        }
+    }
+
+    bool result = tms570_update_register(&sci_lin_reg[TMS570_SCI_GCR1], gcr1 & ~swnrst, TMS570_SCI_GCR1_MASK);
+    result = tms570_update_register(&sci_lin_reg[TMS570_SCI_BRS], brs, TMS570_SCI_BRS_MASK) && result;
+    return (tms570_update_register(&sci_lin_reg[TMS570_SCI_GCR1], gcr1, TMS570_SCI_GCR1_MASK) && result);
+}
+
+static void sci_bist_drain(volatile tms570_reg* sci_lin_reg){
+    uint8_t byte;
+
+    while (sciTryReceiveByte(sci_lin_reg, &byte)){
+    }
+}
+
+// Writes run ahead of reads by the TX double buffer only, RD is drained as soon as RX_RDY rises
+static void sci_bist_prbs(volatile tms570_reg* sci_lin_reg, uint16_t length, uint32_t frame_cycles, uint32_t budget, sci_bist_baud_result_t* baud){
+    uint16_t tx_state = SCI_BIST_PRBS_SEED;
+    uint16_t rx_state = SCI_BIST_PRBS_SEED;
+    uint8_t  next = sci_bist_prbs9(&tx_state);
+    uint32_t sent = 0U;
+    uint32_t start = sciCycleNow();
+    uint32_t stall = start + (SCI_BIST_STALL_FRAMES * frame_cycles);
+
+    while ((baud->bytes < length) && !sciCycleExpired(stall) && !sciCycleExpired(budget)){
+        if ((sent < length) && sciTrySendByte(sci_lin_reg, next)){
+            sent++;
+            next = sci_bist_prbs9(&tx_state);
+        }
+
+        uint8_t byte;
+        if (sciTryReceiveByte(sci_lin_reg, &byte)){
+            baud->bit_errors += (uint32_t)__builtin_popcount((uint32_t)(byte ^ sci_bist_prbs9(&rx_state)));
+            baud->bytes++;
+            stall = sciCycleNow() + (SCI_BIST_STALL_FRAMES * frame_cycles);
+        }
+    }
+
+    baud->cycles = sciCycleNow() - start;
+    baud->bytes_per_s = (baud->cycles == 0U) ? 0U : (uint32_t)(((uint64_t)baud->bytes * GCLK_FREQ) / baud->cycles);
+}
+
+// The vector read in the ISR clears the flag, so a dispatched vector also counts as flagged
+static void sci_bist_inject(volatile tms570_reg* sci_lin_reg, sci_bist_error_class_t error_class, uint32_t frame_cycles, uint32_t budget, sci_bist_result_t* result){
+    const struct sci_bist_injection_s* injection = &s_sciBistInjection[error_class];
+    sci_stats_t stats;
+
+    if (!sciStatsSnapshot(sci_lin_reg, &stats)){
+        return;
+    }
+    uint32_t before = stats.vector[injection->vector];
+
+    if ((injection->inject != NULL) && !injection->inject(sci_lin_reg, 1U)){
+        return;
+    }
+
+    // A break holds RX low for ten bits after the stop bit, wait it out before the next class
+    uint32_t deadline = sciCycleNow() + (SCI_BIST_STALL_FRAMES * frame_cycles);
+    uint32_t sent;
+    (void)sciSendDeadline(sci_lin_reg, injection->bytes, s_sciBistInjectBytes, deadline, &sent);
+    while (!sciCycleExpired(deadline) && !sciCycleExpired(budget)){
+        if ((sci_lin_reg[TMS570_SCI_FLR] & injection->flag) != 0U){
+            result->flagged |= (uint8_t)(1U << error_class);
+        }
+        if (((result->isr_fired & (1U << error_class)) == 0U) && sciStatsSnapshot(sci_lin_reg, &stats) &&
+            (stats.vector[injection->vector] != before)){
+            result->flagged |= (uint8_t)(1U << error_class);
+            result->isr_fired |= (uint8_t)(1U << error_class);
+        }
+    }
+
+    if (injection->inject != NULL){
+        (void)injection->inject(sci_lin_reg, 0U);
+    }
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_FLR], injection->flag);
+    sci_bist_drain(sci_lin_reg);
+}
+
+bool sciBistRun(volatile tms570_reg* sci_lin_reg, const sci_bist_config_t* config, sci_bist_result_t* result){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (config == NULL) || (result == NULL) || (config->baud == NULL) ||
+        (config->num_of_baud == 0U) || (config->num_of_baud > SCI_BIST_MAX_BAUD) || (config->bytes_per_baud == 0U)){
+        return (false);
+    }
+    for (uint8_t entry = 0U; entry < config->num_of_baud; entry++){
+        uint32_t brs;
+        if (!sciBaudrateToBrs(config->baud[entry], true, &brs)){
+            return (false);
+        }
+    }
+
+    uint32_t start = sciCycleNow();
+    uint32_t budget = sciCycleDeadline(config->budget_us);
+    uint32_t error_enable = 0U;
+    uint32_t error_flag = 0U;
+
+    for (uint32_t error_class = 0U; error_class < NUM_OF_SCI_BIST_ERROR; error_class++){
+        error_enable |= s_sciBistInjection[error_class].enable;
+        error_flag |= s_sciBistInjection[error_class].flag;
+    }
+
+    result->flagged = 0U;
+    result->isr_fired = 0U;
+    for (uint8_t entry = 0U; entry < SCI_BIST_MAX_BAUD; entry++){
+        result->baud[entry].baud = (entry < config->num_of_baud) ? config->baud[entry] : 0U;
+        result->baud[entry].bytes = 0U;
+        result->baud[entry].bit_errors = 0U;
+        result->baud[entry].cycles = 0U;
+        result->baud[entry].bytes_per_s = 0U;
+    }
+
+    tms570_reg gcr1 = sci_lin_reg[TMS570_SCI_GCR1] & TMS570_SCI_GCR1_MASK;
+    tms570_reg brs = sci_lin_reg[TMS570_SCI_BRS] & TMS570_SCI_BRS_MASK;
+    tms570_reg iodftctrl = sci_lin_reg[TMS570_IODFTCTRL] & TMS570_IODFTCTRL_MASK;
+    tms570_reg int_enable = sci_lin_reg[TMS570_SCI_SET_INT] & TMS570_SCI_SET_INT_MASK;
+
+    // TX and RX interrupts would take the loopback bytes away from the polled test
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_CLEAR_INT], TMS570_SCI_CLEAR_INT_MASK);
+
+    bool passed = sci_set_iodftctrl_iodftena(sci_lin_reg, 0xAU) && sci_set_iodftctrl_lpb_ena(sci_lin_reg, config->analog ? 1U : 0U);
+    uint32_t frame_cycles = 0U;
+
+    for (uint8_t entry = 0U; passed && (entry < config->num_of_baud); entry++){
+        uint32_t baud_brs = 0U;
+
+        (void)sciBaudrateToBrs(config->baud[entry], true, &baud_brs);
+        frame_cycles = sci_bist_frame_cycles(baud_brs);
+        passed = sci_bist_configure(sci_lin_reg, gcr1, baud_brs, budget);
+        if (passed){
+            sci_bist_drain(sci_lin_reg);
+            sci_bist_prbs(sci_lin_reg, config->bytes_per_baud, frame_cycles, budget, &result->baud[entry]);
+            passed = (result->baud[entry].bytes == config->bytes_per_baud) && (result->baud[entry].bit_errors == 0U);
+        }
+    }
+
+    // Parity injection needs parity checking, enabled for the injection phase only
+    if (passed){
+        uint32_t parity = MAKE_MASK(TMS570_SCI_GCR1_PARITY_ENA_OFFSET, TMS570_SCI_GCR1_PARITY_ENA_BIT_LEN);
+        passed = sci_bist_configure(sci_lin_reg, gcr1 | parity, sci_lin_reg[TMS570_SCI_BRS] & TMS570_SCI_BRS_MASK, budget);
+    }
+    if (passed){
+        tms570_write_register(&sci_lin_reg[TMS570_SCI_FLR], error_flag);
+        tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], error_enable);
+        for (uint32_t error_class = 0U; error_class < NUM_OF_SCI_BIST_ERROR; error_class++){
+            sci_bist_inject(sci_lin_reg, (sci_bist_error_class_t)error_class, frame_cycles, budget, result);
+        }
+        passed = (result->isr_fired == MASK_N(NUM_OF_SCI_BIST_ERROR));
+    }
+
+    // Restore even after a timeout; the last frame gets the stall window to leave the shifter
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_CLEAR_INT], TMS570_SCI_CLEAR_INT_MASK);
+    if (!sci_bist_configure(sci_lin_reg, gcr1, brs, sciCycleNow() + (SCI_BIST_STALL_FRAMES * frame_cycles))){
+        passed = false;
+    }
+    if (!tms570_update_register(&sci_lin_reg[TMS570_IODFTCTRL], iodftctrl, TMS570_IODFTCTRL_MASK)){
+        passed = false;
+    }
+    sci_bist_drain(sci_lin_reg);
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_FLR], error_flag);
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], int_enable);
+
+    result->cycles = sciCycleNow() - start;
+    result->passed = passed;
+    return (passed);
+}
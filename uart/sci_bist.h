@@ -0,0 +1,79 @@
+#ifndef SCI_BIST_H
+#define SCI_BIST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Most baud rates one self-test run can cover. */
+#define SCI_BIST_MAX_BAUD       (8U)
+
+/**
+ * @enum sci_bist_error_class_e
+ * @brief Receive error classes injected by the self-test.
+ */
+typedef enum sci_bist_error_class_e {
+    SCI_BIST_ERROR_PE = 0,      /** Parity error, injected with IODFTCTRL PEN */
+    SCI_BIST_ERROR_FE,          /** Framing error, injected with IODFTCTRL FEN */
+    SCI_BIST_ERROR_BRKDT,       /** Break detect, injected with IODFTCTRL BRKDT_ENA */
+    SCI_BIST_ERROR_OE,          /** Overrun error, provoked by leaving RD unread */
+    NUM_OF_SCI_BIST_ERROR       /** Number of error classes */
+} sci_bist_error_class_t;
+
+/**
+ * @struct sci_bist_config_s
+ * @brief Self-test parameters.
+ */
+typedef struct sci_bist_config_s {
+    const uint32_t* baud;           /** Baud rates to test, in order */
+    uint8_t         num_of_baud;    /** Entries in baud, 1 - SCI_BIST_MAX_BAUD */
+    uint16_t        bytes_per_baud; /** PRBS bytes pushed at each baud rate */
+    bool            analog;         /** true loops back through the TX pin, false inside the module */
+    uint32_t        budget_us;      /** Time allowed for the whole run */
+} sci_bist_config_t;
+
+/**
+ * @struct sci_bist_baud_result_s
+ * @brief PRBS result at one baud rate.
+ */
+typedef struct sci_bist_baud_result_s {
+    uint32_t baud;          /** Baud rate tested */
+    uint32_t bytes;         /** Bytes received back */
+    uint32_t bit_errors;    /** Received bits differing from the PRBS */
+    uint32_t cycles;        /** Cycles from the first write to the last byte */
+    uint32_t bytes_per_s;   /** Achieved throughput */
+} sci_bist_baud_result_t;
+
+/**
+ * @struct sci_bist_result_s
+ * @brief Result of one self-test run.
+ */
+typedef struct sci_bist_result_s {
+    sci_bist_baud_result_t baud[SCI_BIST_MAX_BAUD]; /** One entry per configured baud rate */
+    uint8_t                flagged;                 /** Bit n set if error class n raised its FLR flag */
+    uint8_t                isr_fired;               /** Bit n set if error class n was dispatched by sciIsrDispatch() */
+    uint32_t               cycles;                  /** Duration of the run */
+    bool                   passed;                  /** true if every byte came back intact and every ISR fired */
+} sci_bist_result_t;
+
+/**
+ * @brief Run the loopback self-test of an SCI/LIN instance.
+ *
+ * Pushes a PRBS-9 pattern through the loopback at each configured baud rate,
+ * then injects every error class at the last one and checks that the
+ * dispatcher serviced its vector. The instance must be in SCI mode with
+ * asynchronous timing; sciIsrInit() must have run and its interrupt lines
+ * must be enabled in the VIM, or no ISR is seen to fire.
+ *
+ * Runs polled with the TX and RX interrupts masked. GCR1, BRS, IODFTCTRL
+ * and the interrupt enables are restored before returning, so call it
+ * before the instance carries traffic.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] config Test parameters. @see sci_bist_config_t
+ * @param[out] result Pointer to store the result. @see sci_bist_result_t
+ * @return true if the test ran and passed, false otherwise.
+ */
+bool sciBistRun(volatile tms570_reg* sci_lin_reg, const sci_bist_config_t* config, sci_bist_result_t* result);
+
+#endif // SCI_BIST_H
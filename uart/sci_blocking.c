@@ -0,0 +1,148 @@
+#include "sci_blocking.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_ring.h"
+#include "sci_os.h"
+#include "sci_cycle.h"
+
+static volatile struct g_sciBlocking
+{
+    uint32_t wanted[NUM_OF_SCI_OS_EVENT];   /* Level that wakes the waiter, 0: nobody waits; indexed by sci_os_event_t */
+    bool     attached[NUM_OF_SCI_OS_EVENT]; /* The ring level callback is installed */
+} g_sciBlocking_t[SCI_LIN_NUM_OF_INSTANCES];
+
+/* TX waits for free space, RX for readable bytes. */
+static uint32_t sci_blocking_level(const sci_ring_t* ring, sci_os_event_t event){
+    return (event == SCI_OS_EVENT_TX) ? sciRingFree(ring) : sciRingUsed(ring);
+}
+
+static uint32_t sci_blocking_remaining(uint32_t timeout_us, uint32_t start){
+    if (timeout_us == SCI_OS_WAIT_FOREVER){
+        return (timeout_us);
+    }
+    uint32_t elapsed = (sciCycleNow() - start) / SCI_CYCLE_PER_US;
+    return (elapsed >= timeout_us) ? 0U : (timeout_us - elapsed);
+}
+
+// The threshold is armed before the last level check, so an interrupt landing in between still signals
+static bool sci_blocking_wait(uint32_t index, sci_os_event_t event, const sci_ring_t* ring, uint32_t wanted, uint32_t timeout_us, uint32_t start){
+    g_sciBlocking_t[index].wanted[event] = wanted;
+    if (sci_blocking_level(ring, event) >= wanted){
+        g_sciBlocking_t[index].wanted[event] = 0U;
+        return (true);
+    }
+
+    uint32_t remaining = sci_blocking_remaining(timeout_us, start);
+    bool     signalled = (remaining != 0U) && sciOsWait(index, event, remaining);
+    g_sciBlocking_t[index].wanted[event] = 0U;
+    return (signalled);
+}
+
+/* Runs in the TX or RX interrupt: one compare per call, the task is woken once per wait. */
+static void sci_blocking_notify(volatile tms570_reg* sci_lin_reg, sci_os_event_t event, uint32_t level){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return;
+    }
+
+    uint32_t wanted = g_sciBlocking_t[index].wanted[event];
+    if ((wanted != 0U) && (level >= wanted)){
+        g_sciBlocking_t[index].wanted[event] = 0U;
+        sciOsSignal(index, event);
+    }
+}
+
+static void sci_blocking_tx_notify(volatile tms570_reg* sci_lin_reg, uint32_t level){
+    sci_blocking_notify(sci_lin_reg, SCI_OS_EVENT_TX, level);
+}
+
+static void sci_blocking_rx_notify(volatile tms570_reg* sci_lin_reg, uint32_t level){
+    sci_blocking_notify(sci_lin_reg, SCI_OS_EVENT_RX, level);
+}
+
+bool sciBlockingInit(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    for (uint32_t event = 0U; event < NUM_OF_SCI_OS_EVENT; event++){
+        g_sciBlocking_t[index].wanted[event] = 0U;
+    }
+    g_sciBlocking_t[index].attached[SCI_OS_EVENT_TX] = sciTxRingSetNotify(sci_lin_reg, sci_blocking_tx_notify);
+    g_sciBlocking_t[index].attached[SCI_OS_EVENT_RX] = sciRxRingSetNotify(sci_lin_reg, sci_blocking_rx_notify);
+    return (g_sciBlocking_t[index].attached[SCI_OS_EVENT_TX] || g_sciBlocking_t[index].attached[SCI_OS_EVENT_RX]);
+}
+
+bool sciBlockingWrite(volatile tms570_reg* sci_lin_reg, const uint8_t* data, uint32_t length, uint32_t timeout_us, uint32_t* written){
+    uint32_t    index = sciGetInstanceIndex(sci_lin_reg);
+    uint32_t    start = sciCycleNow();
+    sci_ring_t* ring = sciTxRingGet(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (ring == NULL) || !g_sciBlocking_t[index].attached[SCI_OS_EVENT_TX] ||
+        (data == NULL) || (written == NULL)){
+        return (false);
+    }
+
+    // Waking at half a ring instead of every free byte keeps the task switches per ring to two
+    uint32_t half = (ring->size > 1U) ? (ring->size / 2U) : 1U;
+
+    *written = 0U;
+    while (*written < length){
+        *written += sciTxRingWrite(sci_lin_reg, &data[*written], length - *written);
+        if (*written == length){
+            break;
+        }
+
+        uint32_t rest = length - *written;
+        if (!sci_blocking_wait(index, SCI_OS_EVENT_TX, ring, (rest < half) ? rest : half, timeout_us, start)){
+            return (false);
+        }
+    }
+    return (true);
+}
+
+bool sciBlockingFlush(volatile tms570_reg* sci_lin_reg, uint32_t timeout_us){
+    uint32_t    index = sciGetInstanceIndex(sci_lin_reg);
+    uint32_t    start = sciCycleNow();
+    sci_ring_t* ring = sciTxRingGet(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (ring == NULL) || !g_sciBlocking_t[index].attached[SCI_OS_EVENT_TX]){
+        return (false);
+    }
+
+    // A stale signal from an earlier write wakes early, the level is checked again
+    while (sciRingFree(ring) != ring->size){
+        if (!sci_blocking_wait(index, SCI_OS_EVENT_TX, ring, ring->size, timeout_us, start)){
+            return (false);
+        }
+    }
+    return (true);
+}
+
+bool sciBlockingRead(volatile tms570_reg* sci_lin_reg, uint8_t* data, uint32_t length, uint32_t timeout_us, uint32_t* read){
+    uint32_t    index = sciGetInstanceIndex(sci_lin_reg);
+    uint32_t    start = sciCycleNow();
+    sci_ring_t* ring = sciRxRingGet(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (ring == NULL) || !g_sciBlocking_t[index].attached[SCI_OS_EVENT_RX] ||
+        (data == NULL) || (read == NULL)){
+        return (false);
+    }
+
+    *read = 0U;
+    while (*read < length){
+        *read += sciRxRingRead(sci_lin_reg, &data[*read], length - *read);
+        if (*read == length){
+            break;
+        }
+
+        uint32_t rest = length - *read;
+        if (!sci_blocking_wait(index, SCI_OS_EVENT_RX, ring, (rest < ring->size) ? rest : ring->size, timeout_us, start)){
+            return (false);
+        }
+    }
+    return (true);
+}
@@ -0,0 +1,62 @@
+#ifndef SCI_BLOCKING_H
+#define SCI_BLOCKING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/**
+ * @brief Attach blocking I/O to an SCI/LIN instance.
+ *
+ * Installs the level callbacks of the TX and RX rings, which must be
+ * attached first with sciTxRingInit() and sciRxRingInit(); an instance
+ * with only one ring gets only that direction. sciOsInit() must have run.
+ * One task per direction: the rings have a single producer and consumer.
+ * Timeouts are tracked on the cycle counter and must stay below half its
+ * period, unless SCI_OS_WAIT_FOREVER.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if at least one direction was attached, false otherwise.
+ */
+bool sciBlockingInit(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Queue bytes on the TX ring, sleeping while it is full.
+ *
+ * The caller sleeps on SCI_OS_EVENT_TX until the TX interrupt has freed
+ * room for the rest of the data, or half the ring, whichever is less.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] data Bytes to send.
+ * @param[in] length Number of bytes to send.
+ * @param[in] timeout_us Time allowed in microseconds, SCI_OS_WAIT_FOREVER to wait without limit.
+ * @param[out] written Pointer to store the number of bytes queued.
+ * @return true if all bytes were queued in time, false otherwise.
+ */
+bool sciBlockingWrite(volatile tms570_reg* sci_lin_reg, const uint8_t* data, uint32_t length, uint32_t timeout_us, uint32_t* written);
+
+/**
+ * @brief Sleep until the TX ring has been handed to the transmitter completely.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] timeout_us Time allowed in microseconds, SCI_OS_WAIT_FOREVER to wait without limit.
+ * @return true if the ring drained in time, false otherwise.
+ */
+bool sciBlockingFlush(volatile tms570_reg* sci_lin_reg, uint32_t timeout_us);
+
+/**
+ * @brief Read bytes from the RX ring, sleeping until enough have arrived.
+ *
+ * The caller sleeps on SCI_OS_EVENT_RX; the RX interrupt wakes it once the
+ * ring holds the rest of the request, or is full.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] data Buffer for the bytes.
+ * @param[in] length Number of bytes to read.
+ * @param[in] timeout_us Time allowed in microseconds, SCI_OS_WAIT_FOREVER to wait without limit.
+ * @param[out] read Pointer to store the number of bytes read.
+ * @return true if length bytes were read in time, false otherwise.
+ */
+bool sciBlockingRead(volatile tms570_reg* sci_lin_reg, uint8_t* data, uint32_t length, uint32_t timeout_us, uint32_t* read);
+
+#endif // SCI_BLOCKING_H
@@ -0,0 +1,131 @@
+#include "sci_crc.h"
+
+#if (SCI_CRC_TABLE == SCI_CRC_TABLE_NIBBLE)
+
+static const uint16_t s_sciCrc16Nibble[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+};
+
+static const uint16_t s_sciCrc16ModbusNibble[16] = {
+    0x0000U, 0xCC01U, 0xD801U, 0x1400U, 0xF001U, 0x3C00U, 0x2800U, 0xE401U,
+    0xA001U, 0x6C00U, 0x7800U, 0xB401U, 0x5000U, 0x9C01U, 0x8801U, 0x4400U,
+};
+
+static const uint32_t s_sciCrc32Nibble[16] = {
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+uint16_t sciCrc16Update(uint16_t crc, const uint8_t* data, uint32_t length){
+    for (uint32_t i = 0U; i < length; i++){
+        crc = (uint16_t)((crc << 4) ^ s_sciCrc16Nibble[(crc >> 12) ^ (data[i] >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ s_sciCrc16Nibble[(crc >> 12) ^ (data[i] & 0x0FU)]);
+    }
+    return (crc);
+}
+
+uint16_t sciCrc16ModbusUpdate(uint16_t crc, const uint8_t* data, uint32_t length){
+    for (uint32_t i = 0U; i < length; i++){
+        crc = (uint16_t)((crc >> 4) ^ s_sciCrc16ModbusNibble[(crc ^ data[i]) & 0x0FU]);
+        crc = (uint16_t)((crc >> 4) ^ s_sciCrc16ModbusNibble[(crc ^ (data[i] >> 4)) & 0x0FU]);
+    }
+    return (crc);
+}
+
+uint32_t sciCrc32Update(uint32_t crc, const uint8_t* data, uint32_t length){
+    crc = ~crc;
+    for (uint32_t i = 0U; i < length; i++){
+        crc = (crc >> 4) ^ s_sciCrc32Nibble[(crc ^ data[i]) & 0x0FU];
+        crc = (crc >> 4) ^ s_sciCrc32Nibble[(crc ^ (data[i] >> 4)) & 0x0FU];
+    }
+    return (~crc);
+}
+
+#else
+
+#define SCI_CRC_SLICES      (SCI_CRC_TABLE)
+
+/* Const, so the tables live in flash and no update can run on unbuilt tables. */
+#include "sci_crc_tables.h"
+
+uint16_t sciCrc16Update(uint16_t crc, const uint8_t* data, uint32_t length){
+    const uint8_t* p = data;
+
+#if (SCI_CRC_SLICES >= 4)
+    // The CRC only overlaps the first two bytes of each group, the rest index their tables directly
+    while (length >= SCI_CRC_SLICES){
+        uint32_t acc = s_sciCrc16Table[SCI_CRC_SLICES - 1U][p[0] ^ (crc >> 8)] ^
+                       s_sciCrc16Table[SCI_CRC_SLICES - 2U][p[1] ^ (crc & 0xFFU)];
+        for (uint32_t i = 2U; i < SCI_CRC_SLICES; i++){
+            acc ^= s_sciCrc16Table[SCI_CRC_SLICES - 1U - i][p[i]];
+        }
+        crc = (uint16_t)acc;
+        p += SCI_CRC_SLICES;
+        length -= SCI_CRC_SLICES;
+    }
+#endif
+
+    while (length > 0U){
+        crc = (uint16_t)((crc << 8) ^ s_sciCrc16Table[0][(crc >> 8) ^ *p]);
+        p++;
+        length--;
+    }
+    return (crc);
+}
+
+uint16_t sciCrc16ModbusUpdate(uint16_t crc, const uint8_t* data, uint32_t length){
+    const uint8_t* p = data;
+
+#if (SCI_CRC_SLICES >= 4)
+    while (length >= SCI_CRC_SLICES){
+        uint32_t acc = s_sciCrc16ModbusTable[SCI_CRC_SLICES - 1U][p[0] ^ (crc & 0xFFU)] ^
+                       s_sciCrc16ModbusTable[SCI_CRC_SLICES - 2U][p[1] ^ (crc >> 8)];
+        for (uint32_t i = 2U; i < SCI_CRC_SLICES; i++){
+            acc ^= s_sciCrc16ModbusTable[SCI_CRC_SLICES - 1U - i][p[i]];
+        }
+        crc = (uint16_t)acc;
+        p += SCI_CRC_SLICES;
+        length -= SCI_CRC_SLICES;
+    }
+#endif
+
+    while (length > 0U){
+        crc = (uint16_t)((crc >> 8) ^ s_sciCrc16ModbusTable[0][(crc ^ *p) & 0xFFU]);
+        p++;
+        length--;
+    }
+    return (crc);
+}
+
+uint32_t sciCrc32Update(uint32_t crc, const uint8_t* data, uint32_t length){
+    const uint8_t* p = data;
+
+    crc = ~crc;
+
+#if (SCI_CRC_SLICES >= 4)
+    // Bytes are assembled little-endian explicitly, so the result does not depend on the core's byte order
+    while (length >= SCI_CRC_SLICES){
+        uint32_t word = crc ^ ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+        uint32_t acc = s_sciCrc32Table[SCI_CRC_SLICES - 1U][word & 0xFFU] ^
+                       s_sciCrc32Table[SCI_CRC_SLICES - 2U][(word >> 8) & 0xFFU] ^
+                       s_sciCrc32Table[SCI_CRC_SLICES - 3U][(word >> 16) & 0xFFU] ^
+                       s_sciCrc32Table[SCI_CRC_SLICES - 4U][word >> 24];
+        for (uint32_t i = 4U; i < SCI_CRC_SLICES; i++){
+            acc ^= s_sciCrc32Table[SCI_CRC_SLICES - 1U - i][p[i]];
+        }
+        crc = acc;
+        p += SCI_CRC_SLICES;
+        length -= SCI_CRC_SLICES;
+    }
+#endif
+
+    while (length > 0U){
+        crc = (crc >> 8) ^ s_sciCrc32Table[0][(crc ^ *p) & 0xFFU];
+        p++;
+        length--;
+    }
+    return (~crc);
+}
+
+#endif
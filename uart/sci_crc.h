@@ -0,0 +1,67 @@
+#ifndef SCI_CRC_H
+#define SCI_CRC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Table variants selectable with SCI_CRC_TABLE. */
+#define SCI_CRC_TABLE_NIBBLE    (0)     /* 16-entry const tables, 128 bytes of flash, two lookups per byte */
+#define SCI_CRC_TABLE_BYTE      (1)     /* 256-entry const tables, 2 KiB of flash, one lookup per byte */
+#define SCI_CRC_TABLE_SLICE4    (4)     /* 4 x 256-entry const tables, 8 KiB of flash, four bytes per step */
+#define SCI_CRC_TABLE_SLICE8    (8)     /* 8 x 256-entry const tables, 16 KiB of flash, eight bytes per step */
+
+#ifndef SCI_CRC_TABLE
+#define SCI_CRC_TABLE           SCI_CRC_TABLE_SLICE4
+#endif
+
+/** @brief Initial value of CRC-16/CCITT-FALSE (poly 0x1021, no reflection, no final XOR). */
+#define SCI_CRC16_CCITT_INIT    (0xFFFFU)
+
+/** @brief Initial value of CRC-16/XMODEM, the same polynomial starting from zero. */
+#define SCI_CRC16_XMODEM_INIT   (0x0000U)
+
+/** @brief Initial value of CRC-16/MODBUS (poly 0x8005 reflected, no final XOR). */
+#define SCI_CRC16_MODBUS_INIT   (0xFFFFU)
+
+/** @brief Initial value of sciCrc32Update() for a new message. */
+#define SCI_CRC32_INIT          (0x00000000U)
+
+/**
+ * @brief Continue a CRC-16 (poly 0x1021, MSB first) over more bytes.
+ *
+ * Start with SCI_CRC16_CCITT_INIT or SCI_CRC16_XMODEM_INIT and feed the
+ * message in any number of chunks, e.g. one per RX chunk.
+ *
+ * @param[in] crc CRC of the bytes so far.
+ * @param[in] data Next bytes.
+ * @param[in] length Number of bytes.
+ * @return CRC including data.
+ */
+uint16_t sciCrc16Update(uint16_t crc, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Continue a CRC-16/MODBUS (poly 0x8005, LSB first) over more bytes.
+ *
+ * Start with SCI_CRC16_MODBUS_INIT. The result goes on the wire low byte first.
+ *
+ * @param[in] crc CRC of the bytes so far.
+ * @param[in] data Next bytes.
+ * @param[in] length Number of bytes.
+ * @return CRC including data.
+ */
+uint16_t sciCrc16ModbusUpdate(uint16_t crc, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Continue a CRC-32 (IEEE 802.3, reflected) over more bytes.
+ *
+ * Start with SCI_CRC32_INIT; every intermediate result is already the final
+ * CRC of the bytes so far, as with zlib crc32().
+ *
+ * @param[in] crc CRC of the bytes so far.
+ * @param[in] data Next bytes.
+ * @param[in] length Number of bytes.
+ * @return CRC including data.
+ */
+uint32_t sciCrc32Update(uint32_t crc, const uint8_t* data, uint32_t length);
+
+#endif // SCI_CRC_H
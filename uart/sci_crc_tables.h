@@ -0,0 +1,881 @@
+/* Generated by tools/sci_crc_tables.py, do not edit. */
+#ifndef SCI_CRC_TABLES_H
+#define SCI_CRC_TABLES_H
+
+#include <stdint.h>
+
+#if (SCI_CRC_SLICES < 1) || (SCI_CRC_SLICES > 8)
+#error "SCI_CRC_SLICES must be 1 to 8"
+#endif
+
+/* CRC-16, poly 0x1021, MSB first. */
+static const uint16_t s_sciCrc16Table[SCI_CRC_SLICES][256] = {
+    {
+        0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+        0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+        0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+        0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+        0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+        0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+        0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+        0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+        0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+        0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+        0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+        0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+        0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+        0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+        0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+        0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+        0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+        0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+        0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+        0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+        0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+        0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+        0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+        0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+        0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+        0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+        0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+        0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+        0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+        0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+        0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+        0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U,
+    },
+#if (SCI_CRC_SLICES > 1)
+    {
+        0x0000U, 0x3331U, 0x6662U, 0x5553U, 0xCCC4U, 0xFFF5U, 0xAAA6U, 0x9997U,
+        0x89A9U, 0xBA98U, 0xEFCBU, 0xDCFAU, 0x456DU, 0x765CU, 0x230FU, 0x103EU,
+        0x0373U, 0x3042U, 0x6511U, 0x5620U, 0xCFB7U, 0xFC86U, 0xA9D5U, 0x9AE4U,
+        0x8ADAU, 0xB9EBU, 0xECB8U, 0xDF89U, 0x461EU, 0x752FU, 0x207CU, 0x134DU,
+        0x06E6U, 0x35D7U, 0x6084U, 0x53B5U, 0xCA22U, 0xF913U, 0xAC40U, 0x9F71U,
+        0x8F4FU, 0xBC7EU, 0xE92DU, 0xDA1CU, 0x438BU, 0x70BAU, 0x25E9U, 0x16D8U,
+        0x0595U, 0x36A4U, 0x63F7U, 0x50C6U, 0xC951U, 0xFA60U, 0xAF33U, 0x9C02U,
+        0x8C3CU, 0xBF0DU, 0xEA5EU, 0xD96FU, 0x40F8U, 0x73C9U, 0x269AU, 0x15ABU,
+        0x0DCCU, 0x3EFDU, 0x6BAEU, 0x589FU, 0xC108U, 0xF239U, 0xA76AU, 0x945BU,
+        0x8465U, 0xB754U, 0xE207U, 0xD136U, 0x48A1U, 0x7B90U, 0x2EC3U, 0x1DF2U,
+        0x0EBFU, 0x3D8EU, 0x68DDU, 0x5BECU, 0xC27BU, 0xF14AU, 0xA419U, 0x9728U,
+        0x8716U, 0xB427U, 0xE174U, 0xD245U, 0x4BD2U, 0x78E3U, 0x2DB0U, 0x1E81U,
+        0x0B2AU, 0x381BU, 0x6D48U, 0x5E79U, 0xC7EEU, 0xF4DFU, 0xA18CU, 0x92BDU,
+        0x8283U, 0xB1B2U, 0xE4E1U, 0xD7D0U, 0x4E47U, 0x7D76U, 0x2825U, 0x1B14U,
+        0x0859U, 0x3B68U, 0x6E3BU, 0x5D0AU, 0xC49DU, 0xF7ACU, 0xA2FFU, 0x91CEU,
+        0x81F0U, 0xB2C1U, 0xE792U, 0xD4A3U, 0x4D34U, 0x7E05U, 0x2B56U, 0x1867U,
+        0x1B98U, 0x28A9U, 0x7DFAU, 0x4ECBU, 0xD75CU, 0xE46DU, 0xB13EU, 0x820FU,
+        0x9231U, 0xA100U, 0xF453U, 0xC762U, 0x5EF5U, 0x6DC4U, 0x3897U, 0x0BA6U,
+        0x18EBU, 0x2BDAU, 0x7E89U, 0x4DB8U, 0xD42FU, 0xE71EU, 0xB24DU, 0x817CU,
+        0x9142U, 0xA273U, 0xF720U, 0xC411U, 0x5D86U, 0x6EB7U, 0x3BE4U, 0x08D5U,
+        0x1D7EU, 0x2E4FU, 0x7B1CU, 0x482DU, 0xD1BAU, 0xE28BU, 0xB7D8U, 0x84E9U,
+        0x94D7U, 0xA7E6U, 0xF2B5U, 0xC184U, 0x5813U, 0x6B22U, 0x3E71U, 0x0D40U,
+        0x1E0DU, 0x2D3CU, 0x786FU, 0x4B5EU, 0xD2C9U, 0xE1F8U, 0xB4ABU, 0x879AU,
+        0x97A4U, 0xA495U, 0xF1C6U, 0xC2F7U, 0x5B60U, 0x6851U, 0x3D02U, 0x0E33U,
+        0x1654U, 0x2565U, 0x7036U, 0x4307U, 0xDA90U, 0xE9A1U, 0xBCF2U, 0x8FC3U,
+        0x9FFDU, 0xACCCU, 0xF99FU, 0xCAAEU, 0x5339U, 0x6008U, 0x355BU, 0x066AU,
+        0x1527U, 0x2616U, 0x7345U, 0x4074U, 0xD9E3U, 0xEAD2U, 0xBF81U, 0x8CB0U,
+        0x9C8EU, 0xAFBFU, 0xFAECU, 0xC9DDU, 0x504AU, 0x637BU, 0x3628U, 0x0519U,
+        0x10B2U, 0x2383U, 0x76D0U, 0x45E1U, 0xDC76U, 0xEF47U, 0xBA14U, 0x8925U,
+        0x991BU, 0xAA2AU, 0xFF79U, 0xCC48U, 0x55DFU, 0x66EEU, 0x33BDU, 0x008CU,
+        0x13C1U, 0x20F0U, 0x75A3U, 0x4692U, 0xDF05U, 0xEC34U, 0xB967U, 0x8A56U,
+        0x9A68U, 0xA959U, 0xFC0AU, 0xCF3BU, 0x56ACU, 0x659DU, 0x30CEU, 0x03FFU,
+    },
+#endif
+#if (SCI_CRC_SLICES > 2)
+    {
+        0x0000U, 0x3730U, 0x6E60U, 0x5950U, 0xDCC0U, 0xEBF0U, 0xB2A0U, 0x8590U,
+        0xA9A1U, 0x9E91U, 0xC7C1U, 0xF0F1U, 0x7561U, 0x4251U, 0x1B01U, 0x2C31U,
+        0x4363U, 0x7453U, 0x2D03U, 0x1A33U, 0x9FA3U, 0xA893U, 0xF1C3U, 0xC6F3U,
+        0xEAC2U, 0xDDF2U, 0x84A2U, 0xB392U, 0x3602U, 0x0132U, 0x5862U, 0x6F52U,
+        0x86C6U, 0xB1F6U, 0xE8A6U, 0xDF96U, 0x5A06U, 0x6D36U, 0x3466U, 0x0356U,
+        0x2F67U, 0x1857U, 0x4107U, 0x7637U, 0xF3A7U, 0xC497U, 0x9DC7U, 0xAAF7U,
+        0xC5A5U, 0xF295U, 0xABC5U, 0x9CF5U, 0x1965U, 0x2E55U, 0x7705U, 0x4035U,
+        0x6C04U, 0x5B34U, 0x0264U, 0x3554U, 0xB0C4U, 0x87F4U, 0xDEA4U, 0xE994U,
+        0x1DADU, 0x2A9DU, 0x73CDU, 0x44FDU, 0xC16DU, 0xF65DU, 0xAF0DU, 0x983DU,
+        0xB40CU, 0x833CU, 0xDA6CU, 0xED5CU, 0x68CCU, 0x5FFCU, 0x06ACU, 0x319CU,
+        0x5ECEU, 0x69FEU, 0x30AEU, 0x079EU, 0x820EU, 0xB53EU, 0xEC6EU, 0xDB5EU,
+        0xF76FU, 0xC05FU, 0x990FU, 0xAE3FU, 0x2BAFU, 0x1C9FU, 0x45CFU, 0x72FFU,
+        0x9B6BU, 0xAC5BU, 0xF50BU, 0xC23BU, 0x47ABU, 0x709BU, 0x29CBU, 0x1EFBU,
+        0x32CAU, 0x05FAU, 0x5CAAU, 0x6B9AU, 0xEE0AU, 0xD93AU, 0x806AU, 0xB75AU,
+        0xD808U, 0xEF38U, 0xB668U, 0x8158U, 0x04C8U, 0x33F8U, 0x6AA8U, 0x5D98U,
+        0x71A9U, 0x4699U, 0x1FC9U, 0x28F9U, 0xAD69U, 0x9A59U, 0xC309U, 0xF439U,
+        0x3B5AU, 0x0C6AU, 0x553AU, 0x620AU, 0xE79AU, 0xD0AAU, 0x89FAU, 0xBECAU,
+        0x92FBU, 0xA5CBU, 0xFC9BU, 0xCBABU, 0x4E3BU, 0x790BU, 0x205BU, 0x176BU,
+        0x7839U, 0x4F09U, 0x1659U, 0x2169U, 0xA4F9U, 0x93C9U, 0xCA99U, 0xFDA9U,
+        0xD198U, 0xE6A8U, 0xBFF8U, 0x88C8U, 0x0D58U, 0x3A68U, 0x6338U, 0x5408U,
+        0xBD9CU, 0x8AACU, 0xD3FCU, 0xE4CCU, 0x615CU, 0x566CU, 0x0F3CU, 0x380CU,
+        0x143DU, 0x230DU, 0x7A5DU, 0x4D6DU, 0xC8FDU, 0xFFCDU, 0xA69DU, 0x91ADU,
+        0xFEFFU, 0xC9CFU, 0x909FU, 0xA7AFU, 0x223FU, 0x150FU, 0x4C5FU, 0x7B6FU,
+        0x575EU, 0x606EU, 0x393EU, 0x0E0EU, 0x8B9EU, 0xBCAEU, 0xE5FEU, 0xD2CEU,
+        0x26F7U, 0x11C7U, 0x4897U, 0x7FA7U, 0xFA37U, 0xCD07U, 0x9457U, 0xA367U,
+        0x8F56U, 0xB866U, 0xE136U, 0xD606U, 0x5396U, 0x64A6U, 0x3DF6U, 0x0AC6U,
+        0x6594U, 0x52A4U, 0x0BF4U, 0x3CC4U, 0xB954U, 0x8E64U, 0xD734U, 0xE004U,
+        0xCC35U, 0xFB05U, 0xA255U, 0x9565U, 0x10F5U, 0x27C5U, 0x7E95U, 0x49A5U,
+        0xA031U, 0x9701U, 0xCE51U, 0xF961U, 0x7CF1U, 0x4BC1U, 0x1291U, 0x25A1U,
+        0x0990U, 0x3EA0U, 0x67F0U, 0x50C0U, 0xD550U, 0xE260U, 0xBB30U, 0x8C00U,
+        0xE352U, 0xD462U, 0x8D32U, 0xBA02U, 0x3F92U, 0x08A2U, 0x51F2U, 0x66C2U,
+        0x4AF3U, 0x7DC3U, 0x2493U, 0x13A3U, 0x9633U, 0xA103U, 0xF853U, 0xCF63U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 3)
+    {
+        0x0000U, 0x76B4U, 0xED68U, 0x9BDCU, 0xCAF1U, 0xBC45U, 0x2799U, 0x512DU,
+        0x85C3U, 0xF377U, 0x68ABU, 0x1E1FU, 0x4F32U, 0x3986U, 0xA25AU, 0xD4EEU,
+        0x1BA7U, 0x6D13U, 0xF6CFU, 0x807BU, 0xD156U, 0xA7E2U, 0x3C3EU, 0x4A8AU,
+        0x9E64U, 0xE8D0U, 0x730CU, 0x05B8U, 0x5495U, 0x2221U, 0xB9FDU, 0xCF49U,
+        0x374EU, 0x41FAU, 0xDA26U, 0xAC92U, 0xFDBFU, 0x8B0BU, 0x10D7U, 0x6663U,
+        0xB28DU, 0xC439U, 0x5FE5U, 0x2951U, 0x787CU, 0x0EC8U, 0x9514U, 0xE3A0U,
+        0x2CE9U, 0x5A5DU, 0xC181U, 0xB735U, 0xE618U, 0x90ACU, 0x0B70U, 0x7DC4U,
+        0xA92AU, 0xDF9EU, 0x4442U, 0x32F6U, 0x63DBU, 0x156FU, 0x8EB3U, 0xF807U,
+        0x6E9CU, 0x1828U, 0x83F4U, 0xF540U, 0xA46DU, 0xD2D9U, 0x4905U, 0x3FB1U,
+        0xEB5FU, 0x9DEBU, 0x0637U, 0x7083U, 0x21AEU, 0x571AU, 0xCCC6U, 0xBA72U,
+        0x753BU, 0x038FU, 0x9853U, 0xEEE7U, 0xBFCAU, 0xC97EU, 0x52A2U, 0x2416U,
+        0xF0F8U, 0x864CU, 0x1D90U, 0x6B24U, 0x3A09U, 0x4CBDU, 0xD761U, 0xA1D5U,
+        0x59D2U, 0x2F66U, 0xB4BAU, 0xC20EU, 0x9323U, 0xE597U, 0x7E4BU, 0x08FFU,
+        0xDC11U, 0xAAA5U, 0x3179U, 0x47CDU, 0x16E0U, 0x6054U, 0xFB88U, 0x8D3CU,
+        0x4275U, 0x34C1U, 0xAF1DU, 0xD9A9U, 0x8884U, 0xFE30U, 0x65ECU, 0x1358U,
+        0xC7B6U, 0xB102U, 0x2ADEU, 0x5C6AU, 0x0D47U, 0x7BF3U, 0xE02FU, 0x969BU,
+        0xDD38U, 0xAB8CU, 0x3050U, 0x46E4U, 0x17C9U, 0x617DU, 0xFAA1U, 0x8C15U,
+        0x58FBU, 0x2E4FU, 0xB593U, 0xC327U, 0x920AU, 0xE4BEU, 0x7F62U, 0x09D6U,
+        0xC69FU, 0xB02BU, 0x2BF7U, 0x5D43U, 0x0C6EU, 0x7ADAU, 0xE106U, 0x97B2U,
+        0x435CU, 0x35E8U, 0xAE34U, 0xD880U, 0x89ADU, 0xFF19U, 0x64C5U, 0x1271U,
+        0xEA76U, 0x9CC2U, 0x071EU, 0x71AAU, 0x2087U, 0x5633U, 0xCDEFU, 0xBB5BU,
+        0x6FB5U, 0x1901U, 0x82DDU, 0xF469U, 0xA544U, 0xD3F0U, 0x482CU, 0x3E98U,
+        0xF1D1U, 0x8765U, 0x1CB9U, 0x6A0DU, 0x3B20U, 0x4D94U, 0xD648U, 0xA0FCU,
+        0x7412U, 0x02A6U, 0x997AU, 0xEFCEU, 0xBEE3U, 0xC857U, 0x538BU, 0x253FU,
+        0xB3A4U, 0xC510U, 0x5ECCU, 0x2878U, 0x7955U, 0x0FE1U, 0x943DU, 0xE289U,
+        0x3667U, 0x40D3U, 0xDB0FU, 0xADBBU, 0xFC96U, 0x8A22U, 0x11FEU, 0x674AU,
+        0xA803U, 0xDEB7U, 0x456BU, 0x33DFU, 0x62F2U, 0x1446U, 0x8F9AU, 0xF92EU,
+        0x2DC0U, 0x5B74U, 0xC0A8U, 0xB61CU, 0xE731U, 0x9185U, 0x0A59U, 0x7CEDU,
+        0x84EAU, 0xF25EU, 0x6982U, 0x1F36U, 0x4E1BU, 0x38AFU, 0xA373U, 0xD5C7U,
+        0x0129U, 0x779DU, 0xEC41U, 0x9AF5U, 0xCBD8U, 0xBD6CU, 0x26B0U, 0x5004U,
+        0x9F4DU, 0xE9F9U, 0x7225U, 0x0491U, 0x55BCU, 0x2308U, 0xB8D4U, 0xCE60U,
+        0x1A8EU, 0x6C3AU, 0xF7E6U, 0x8152U, 0xD07FU, 0xA6CBU, 0x3D17U, 0x4BA3U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 4)
+    {
+        0x0000U, 0xAA51U, 0x4483U, 0xEED2U, 0x8906U, 0x2357U, 0xCD85U, 0x67D4U,
+        0x022DU, 0xA87CU, 0x46AEU, 0xECFFU, 0x8B2BU, 0x217AU, 0xCFA8U, 0x65F9U,
+        0x045AU, 0xAE0BU, 0x40D9U, 0xEA88U, 0x8D5CU, 0x270DU, 0xC9DFU, 0x638EU,
+        0x0677U, 0xAC26U, 0x42F4U, 0xE8A5U, 0x8F71U, 0x2520U, 0xCBF2U, 0x61A3U,
+        0x08B4U, 0xA2E5U, 0x4C37U, 0xE666U, 0x81B2U, 0x2BE3U, 0xC531U, 0x6F60U,
+        0x0A99U, 0xA0C8U, 0x4E1AU, 0xE44BU, 0x839FU, 0x29CEU, 0xC71CU, 0x6D4DU,
+        0x0CEEU, 0xA6BFU, 0x486DU, 0xE23CU, 0x85E8U, 0x2FB9U, 0xC16BU, 0x6B3AU,
+        0x0EC3U, 0xA492U, 0x4A40U, 0xE011U, 0x87C5U, 0x2D94U, 0xC346U, 0x6917U,
+        0x1168U, 0xBB39U, 0x55EBU, 0xFFBAU, 0x986EU, 0x323FU, 0xDCEDU, 0x76BCU,
+        0x1345U, 0xB914U, 0x57C6U, 0xFD97U, 0x9A43U, 0x3012U, 0xDEC0U, 0x7491U,
+        0x1532U, 0xBF63U, 0x51B1U, 0xFBE0U, 0x9C34U, 0x3665U, 0xD8B7U, 0x72E6U,
+        0x171FU, 0xBD4EU, 0x539CU, 0xF9CDU, 0x9E19U, 0x3448U, 0xDA9AU, 0x70CBU,
+        0x19DCU, 0xB38DU, 0x5D5FU, 0xF70EU, 0x90DAU, 0x3A8BU, 0xD459U, 0x7E08U,
+        0x1BF1U, 0xB1A0U, 0x5F72U, 0xF523U, 0x92F7U, 0x38A6U, 0xD674U, 0x7C25U,
+        0x1D86U, 0xB7D7U, 0x5905U, 0xF354U, 0x9480U, 0x3ED1U, 0xD003U, 0x7A52U,
+        0x1FABU, 0xB5FAU, 0x5B28U, 0xF179U, 0x96ADU, 0x3CFCU, 0xD22EU, 0x787FU,
+        0x22D0U, 0x8881U, 0x6653U, 0xCC02U, 0xABD6U, 0x0187U, 0xEF55U, 0x4504U,
+        0x20FDU, 0x8AACU, 0x647EU, 0xCE2FU, 0xA9FBU, 0x03AAU, 0xED78U, 0x4729U,
+        0x268AU, 0x8CDBU, 0x6209U, 0xC858U, 0xAF8CU, 0x05DDU, 0xEB0FU, 0x415EU,
+        0x24A7U, 0x8EF6U, 0x6024U, 0xCA75U, 0xADA1U, 0x07F0U, 0xE922U, 0x4373U,
+        0x2A64U, 0x8035U, 0x6EE7U, 0xC4B6U, 0xA362U, 0x0933U, 0xE7E1U, 0x4DB0U,
+        0x2849U, 0x8218U, 0x6CCAU, 0xC69BU, 0xA14FU, 0x0B1EU, 0xE5CCU, 0x4F9DU,
+        0x2E3EU, 0x846FU, 0x6ABDU, 0xC0ECU, 0xA738U, 0x0D69U, 0xE3BBU, 0x49EAU,
+        0x2C13U, 0x8642U, 0x6890U, 0xC2C1U, 0xA515U, 0x0F44U, 0xE196U, 0x4BC7U,
+        0x33B8U, 0x99E9U, 0x773BU, 0xDD6AU, 0xBABEU, 0x10EFU, 0xFE3DU, 0x546CU,
+        0x3195U, 0x9BC4U, 0x7516U, 0xDF47U, 0xB893U, 0x12C2U, 0xFC10U, 0x5641U,
+        0x37E2U, 0x9DB3U, 0x7361U, 0xD930U, 0xBEE4U, 0x14B5U, 0xFA67U, 0x5036U,
+        0x35CFU, 0x9F9EU, 0x714CU, 0xDB1DU, 0xBCC9U, 0x1698U, 0xF84AU, 0x521BU,
+        0x3B0CU, 0x915DU, 0x7F8FU, 0xD5DEU, 0xB20AU, 0x185BU, 0xF689U, 0x5CD8U,
+        0x3921U, 0x9370U, 0x7DA2U, 0xD7F3U, 0xB027U, 0x1A76U, 0xF4A4U, 0x5EF5U,
+        0x3F56U, 0x9507U, 0x7BD5U, 0xD184U, 0xB650U, 0x1C01U, 0xF2D3U, 0x5882U,
+        0x3D7BU, 0x972AU, 0x79F8U, 0xD3A9U, 0xB47DU, 0x1E2CU, 0xF0FEU, 0x5AAFU,
+    },
+#endif
+#if (SCI_CRC_SLICES > 5)
+    {
+        0x0000U, 0x45A0U, 0x8B40U, 0xCEE0U, 0x06A1U, 0x4301U, 0x8DE1U, 0xC841U,
+        0x0D42U, 0x48E2U, 0x8602U, 0xC3A2U, 0x0BE3U, 0x4E43U, 0x80A3U, 0xC503U,
+        0x1A84U, 0x5F24U, 0x91C4U, 0xD464U, 0x1C25U, 0x5985U, 0x9765U, 0xD2C5U,
+        0x17C6U, 0x5266U, 0x9C86U, 0xD926U, 0x1167U, 0x54C7U, 0x9A27U, 0xDF87U,
+        0x3508U, 0x70A8U, 0xBE48U, 0xFBE8U, 0x33A9U, 0x7609U, 0xB8E9U, 0xFD49U,
+        0x384AU, 0x7DEAU, 0xB30AU, 0xF6AAU, 0x3EEBU, 0x7B4BU, 0xB5ABU, 0xF00BU,
+        0x2F8CU, 0x6A2CU, 0xA4CCU, 0xE16CU, 0x292DU, 0x6C8DU, 0xA26DU, 0xE7CDU,
+        0x22CEU, 0x676EU, 0xA98EU, 0xEC2EU, 0x246FU, 0x61CFU, 0xAF2FU, 0xEA8FU,
+        0x6A10U, 0x2FB0U, 0xE150U, 0xA4F0U, 0x6CB1U, 0x2911U, 0xE7F1U, 0xA251U,
+        0x6752U, 0x22F2U, 0xEC12U, 0xA9B2U, 0x61F3U, 0x2453U, 0xEAB3U, 0xAF13U,
+        0x7094U, 0x3534U, 0xFBD4U, 0xBE74U, 0x7635U, 0x3395U, 0xFD75U, 0xB8D5U,
+        0x7DD6U, 0x3876U, 0xF696U, 0xB336U, 0x7B77U, 0x3ED7U, 0xF037U, 0xB597U,
+        0x5F18U, 0x1AB8U, 0xD458U, 0x91F8U, 0x59B9U, 0x1C19U, 0xD2F9U, 0x9759U,
+        0x525AU, 0x17FAU, 0xD91AU, 0x9CBAU, 0x54FBU, 0x115BU, 0xDFBBU, 0x9A1BU,
+        0x459CU, 0x003CU, 0xCEDCU, 0x8B7CU, 0x433DU, 0x069DU, 0xC87DU, 0x8DDDU,
+        0x48DEU, 0x0D7EU, 0xC39EU, 0x863EU, 0x4E7FU, 0x0BDFU, 0xC53FU, 0x809FU,
+        0xD420U, 0x9180U, 0x5F60U, 0x1AC0U, 0xD281U, 0x9721U, 0x59C1U, 0x1C61U,
+        0xD962U, 0x9CC2U, 0x5222U, 0x1782U, 0xDFC3U, 0x9A63U, 0x5483U, 0x1123U,
+        0xCEA4U, 0x8B04U, 0x45E4U, 0x0044U, 0xC805U, 0x8DA5U, 0x4345U, 0x06E5U,
+        0xC3E6U, 0x8646U, 0x48A6U, 0x0D06U, 0xC547U, 0x80E7U, 0x4E07U, 0x0BA7U,
+        0xE128U, 0xA488U, 0x6A68U, 0x2FC8U, 0xE789U, 0xA229U, 0x6CC9U, 0x2969U,
+        0xEC6AU, 0xA9CAU, 0x672AU, 0x228AU, 0xEACBU, 0xAF6BU, 0x618BU, 0x242BU,
+        0xFBACU, 0xBE0CU, 0x70ECU, 0x354CU, 0xFD0DU, 0xB8ADU, 0x764DU, 0x33EDU,
+        0xF6EEU, 0xB34EU, 0x7DAEU, 0x380EU, 0xF04FU, 0xB5EFU, 0x7B0FU, 0x3EAFU,
+        0xBE30U, 0xFB90U, 0x3570U, 0x70D0U, 0xB891U, 0xFD31U, 0x33D1U, 0x7671U,
+        0xB372U, 0xF6D2U, 0x3832U, 0x7D92U, 0xB5D3U, 0xF073U, 0x3E93U, 0x7B33U,
+        0xA4B4U, 0xE114U, 0x2FF4U, 0x6A54U, 0xA215U, 0xE7B5U, 0x2955U, 0x6CF5U,
+        0xA9F6U, 0xEC56U, 0x22B6U, 0x6716U, 0xAF57U, 0xEAF7U, 0x2417U, 0x61B7U,
+        0x8B38U, 0xCE98U, 0x0078U, 0x45D8U, 0x8D99U, 0xC839U, 0x06D9U, 0x4379U,
+        0x867AU, 0xC3DAU, 0x0D3AU, 0x489AU, 0x80DBU, 0xC57BU, 0x0B9BU, 0x4E3BU,
+        0x91BCU, 0xD41CU, 0x1AFCU, 0x5F5CU, 0x971DU, 0xD2BDU, 0x1C5DU, 0x59FDU,
+        0x9CFEU, 0xD95EU, 0x17BEU, 0x521EU, 0x9A5FU, 0xDFFFU, 0x111FU, 0x54BFU,
+    },
+#endif
+#if (SCI_CRC_SLICES > 6)
+    {
+        0x0000U, 0xB861U, 0x60E3U, 0xD882U, 0xC1C6U, 0x79A7U, 0xA125U, 0x1944U,
+        0x93ADU, 0x2BCCU, 0xF34EU, 0x4B2FU, 0x526BU, 0xEA0AU, 0x3288U, 0x8AE9U,
+        0x377BU, 0x8F1AU, 0x5798U, 0xEFF9U, 0xF6BDU, 0x4EDCU, 0x965EU, 0x2E3FU,
+        0xA4D6U, 0x1CB7U, 0xC435U, 0x7C54U, 0x6510U, 0xDD71U, 0x05F3U, 0xBD92U,
+        0x6EF6U, 0xD697U, 0x0E15U, 0xB674U, 0xAF30U, 0x1751U, 0xCFD3U, 0x77B2U,
+        0xFD5BU, 0x453AU, 0x9DB8U, 0x25D9U, 0x3C9DU, 0x84FCU, 0x5C7EU, 0xE41FU,
+        0x598DU, 0xE1ECU, 0x396EU, 0x810FU, 0x984BU, 0x202AU, 0xF8A8U, 0x40C9U,
+        0xCA20U, 0x7241U, 0xAAC3U, 0x12A2U, 0x0BE6U, 0xB387U, 0x6B05U, 0xD364U,
+        0xDDECU, 0x658DU, 0xBD0FU, 0x056EU, 0x1C2AU, 0xA44BU, 0x7CC9U, 0xC4A8U,
+        0x4E41U, 0xF620U, 0x2EA2U, 0x96C3U, 0x8F87U, 0x37E6U, 0xEF64U, 0x5705U,
+        0xEA97U, 0x52F6U, 0x8A74U, 0x3215U, 0x2B51U, 0x9330U, 0x4BB2U, 0xF3D3U,
+        0x793AU, 0xC15BU, 0x19D9U, 0xA1B8U, 0xB8FCU, 0x009DU, 0xD81FU, 0x607EU,
+        0xB31AU, 0x0B7BU, 0xD3F9U, 0x6B98U, 0x72DCU, 0xCABDU, 0x123FU, 0xAA5EU,
+        0x20B7U, 0x98D6U, 0x4054U, 0xF835U, 0xE171U, 0x5910U, 0x8192U, 0x39F3U,
+        0x8461U, 0x3C00U, 0xE482U, 0x5CE3U, 0x45A7U, 0xFDC6U, 0x2544U, 0x9D25U,
+        0x17CCU, 0xAFADU, 0x772FU, 0xCF4EU, 0xD60AU, 0x6E6BU, 0xB6E9U, 0x0E88U,
+        0xABF9U, 0x1398U, 0xCB1AU, 0x737BU, 0x6A3FU, 0xD25EU, 0x0ADCU, 0xB2BDU,
+        0x3854U, 0x8035U, 0x58B7U, 0xE0D6U, 0xF992U, 0x41F3U, 0x9971U, 0x2110U,
+        0x9C82U, 0x24E3U, 0xFC61U, 0x4400U, 0x5D44U, 0xE525U, 0x3DA7U, 0x85C6U,
+        0x0F2FU, 0xB74EU, 0x6FCCU, 0xD7ADU, 0xCEE9U, 0x7688U, 0xAE0AU, 0x166BU,
+        0xC50FU, 0x7D6EU, 0xA5ECU, 0x1D8DU, 0x04C9U, 0xBCA8U, 0x642AU, 0xDC4BU,
+        0x56A2U, 0xEEC3U, 0x3641U, 0x8E20U, 0x9764U, 0x2F05U, 0xF787U, 0x4FE6U,
+        0xF274U, 0x4A15U, 0x9297U, 0x2AF6U, 0x33B2U, 0x8BD3U, 0x5351U, 0xEB30U,
+        0x61D9U, 0xD9B8U, 0x013AU, 0xB95BU, 0xA01FU, 0x187EU, 0xC0FCU, 0x789DU,
+        0x7615U, 0xCE74U, 0x16F6U, 0xAE97U, 0xB7D3U, 0x0FB2U, 0xD730U, 0x6F51U,
+        0xE5B8U, 0x5DD9U, 0x855BU, 0x3D3AU, 0x247EU, 0x9C1FU, 0x449DU, 0xFCFCU,
+        0x416EU, 0xF90FU, 0x218DU, 0x99ECU, 0x80A8U, 0x38C9U, 0xE04BU, 0x582AU,
+        0xD2C3U, 0x6AA2U, 0xB220U, 0x0A41U, 0x1305U, 0xAB64U, 0x73E6U, 0xCB87U,
+        0x18E3U, 0xA082U, 0x7800U, 0xC061U, 0xD925U, 0x6144U, 0xB9C6U, 0x01A7U,
+        0x8B4EU, 0x332FU, 0xEBADU, 0x53CCU, 0x4A88U, 0xF2E9U, 0x2A6BU, 0x920AU,
+        0x2F98U, 0x97F9U, 0x4F7BU, 0xF71AU, 0xEE5EU, 0x563FU, 0x8EBDU, 0x36DCU,
+        0xBC35U, 0x0454U, 0xDCD6U, 0x64B7U, 0x7DF3U, 0xC592U, 0x1D10U, 0xA571U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 7)
+    {
+        0x0000U, 0x47D3U, 0x8FA6U, 0xC875U, 0x0F6DU, 0x48BEU, 0x80CBU, 0xC718U,
+        0x1EDAU, 0x5909U, 0x917CU, 0xD6AFU, 0x11B7U, 0x5664U, 0x9E11U, 0xD9C2U,
+        0x3DB4U, 0x7A67U, 0xB212U, 0xF5C1U, 0x32D9U, 0x750AU, 0xBD7FU, 0xFAACU,
+        0x236EU, 0x64BDU, 0xACC8U, 0xEB1BU, 0x2C03U, 0x6BD0U, 0xA3A5U, 0xE476U,
+        0x7B68U, 0x3CBBU, 0xF4CEU, 0xB31DU, 0x7405U, 0x33D6U, 0xFBA3U, 0xBC70U,
+        0x65B2U, 0x2261U, 0xEA14U, 0xADC7U, 0x6ADFU, 0x2D0CU, 0xE579U, 0xA2AAU,
+        0x46DCU, 0x010FU, 0xC97AU, 0x8EA9U, 0x49B1U, 0x0E62U, 0xC617U, 0x81C4U,
+        0x5806U, 0x1FD5U, 0xD7A0U, 0x9073U, 0x576BU, 0x10B8U, 0xD8CDU, 0x9F1EU,
+        0xF6D0U, 0xB103U, 0x7976U, 0x3EA5U, 0xF9BDU, 0xBE6EU, 0x761BU, 0x31C8U,
+        0xE80AU, 0xAFD9U, 0x67ACU, 0x207FU, 0xE767U, 0xA0B4U, 0x68C1U, 0x2F12U,
+        0xCB64U, 0x8CB7U, 0x44C2U, 0x0311U, 0xC409U, 0x83DAU, 0x4BAFU, 0x0C7CU,
+        0xD5BEU, 0x926DU, 0x5A18U, 0x1DCBU, 0xDAD3U, 0x9D00U, 0x5575U, 0x12A6U,
+        0x8DB8U, 0xCA6BU, 0x021EU, 0x45CDU, 0x82D5U, 0xC506U, 0x0D73U, 0x4AA0U,
+        0x9362U, 0xD4B1U, 0x1CC4U, 0x5B17U, 0x9C0FU, 0xDBDCU, 0x13A9U, 0x547AU,
+        0xB00CU, 0xF7DFU, 0x3FAAU, 0x7879U, 0xBF61U, 0xF8B2U, 0x30C7U, 0x7714U,
+        0xAED6U, 0xE905U, 0x2170U, 0x66A3U, 0xA1BBU, 0xE668U, 0x2E1DU, 0x69CEU,
+        0xFD81U, 0xBA52U, 0x7227U, 0x35F4U, 0xF2ECU, 0xB53FU, 0x7D4AU, 0x3A99U,
+        0xE35BU, 0xA488U, 0x6CFDU, 0x2B2EU, 0xEC36U, 0xABE5U, 0x6390U, 0x2443U,
+        0xC035U, 0x87E6U, 0x4F93U, 0x0840U, 0xCF58U, 0x888BU, 0x40FEU, 0x072DU,
+        0xDEEFU, 0x993CU, 0x5149U, 0x169AU, 0xD182U, 0x9651U, 0x5E24U, 0x19F7U,
+        0x86E9U, 0xC13AU, 0x094FU, 0x4E9CU, 0x8984U, 0xCE57U, 0x0622U, 0x41F1U,
+        0x9833U, 0xDFE0U, 0x1795U, 0x5046U, 0x975EU, 0xD08DU, 0x18F8U, 0x5F2BU,
+        0xBB5DU, 0xFC8EU, 0x34FBU, 0x7328U, 0xB430U, 0xF3E3U, 0x3B96U, 0x7C45U,
+        0xA587U, 0xE254U, 0x2A21U, 0x6DF2U, 0xAAEAU, 0xED39U, 0x254CU, 0x629FU,
+        0x0B51U, 0x4C82U, 0x84F7U, 0xC324U, 0x043CU, 0x43EFU, 0x8B9AU, 0xCC49U,
+        0x158BU, 0x5258U, 0x9A2DU, 0xDDFEU, 0x1AE6U, 0x5D35U, 0x9540U, 0xD293U,
+        0x36E5U, 0x7136U, 0xB943U, 0xFE90U, 0x3988U, 0x7E5BU, 0xB62EU, 0xF1FDU,
+        0x283FU, 0x6FECU, 0xA799U, 0xE04AU, 0x2752U, 0x6081U, 0xA8F4U, 0xEF27U,
+        0x7039U, 0x37EAU, 0xFF9FU, 0xB84CU, 0x7F54U, 0x3887U, 0xF0F2U, 0xB721U,
+        0x6EE3U, 0x2930U, 0xE145U, 0xA696U, 0x618EU, 0x265DU, 0xEE28U, 0xA9FBU,
+        0x4D8DU, 0x0A5EU, 0xC22BU, 0x85F8U, 0x42E0U, 0x0533U, 0xCD46U, 0x8A95U,
+        0x5357U, 0x1484U, 0xDCF1U, 0x9B22U, 0x5C3AU, 0x1BE9U, 0xD39CU, 0x944FU,
+    },
+#endif
+};
+
+/* CRC-16/MODBUS, poly 0x8005 reflected. */
+static const uint16_t s_sciCrc16ModbusTable[SCI_CRC_SLICES][256] = {
+    {
+        0x0000U, 0xC0C1U, 0xC181U, 0x0140U, 0xC301U, 0x03C0U, 0x0280U, 0xC241U,
+        0xC601U, 0x06C0U, 0x0780U, 0xC741U, 0x0500U, 0xC5C1U, 0xC481U, 0x0440U,
+        0xCC01U, 0x0CC0U, 0x0D80U, 0xCD41U, 0x0F00U, 0xCFC1U, 0xCE81U, 0x0E40U,
+        0x0A00U, 0xCAC1U, 0xCB81U, 0x0B40U, 0xC901U, 0x09C0U, 0x0880U, 0xC841U,
+        0xD801U, 0x18C0U, 0x1980U, 0xD941U, 0x1B00U, 0xDBC1U, 0xDA81U, 0x1A40U,
+        0x1E00U, 0xDEC1U, 0xDF81U, 0x1F40U, 0xDD01U, 0x1DC0U, 0x1C80U, 0xDC41U,
+        0x1400U, 0xD4C1U, 0xD581U, 0x1540U, 0xD701U, 0x17C0U, 0x1680U, 0xD641U,
+        0xD201U, 0x12C0U, 0x1380U, 0xD341U, 0x1100U, 0xD1C1U, 0xD081U, 0x1040U,
+        0xF001U, 0x30C0U, 0x3180U, 0xF141U, 0x3300U, 0xF3C1U, 0xF281U, 0x3240U,
+        0x3600U, 0xF6C1U, 0xF781U, 0x3740U, 0xF501U, 0x35C0U, 0x3480U, 0xF441U,
+        0x3C00U, 0xFCC1U, 0xFD81U, 0x3D40U, 0xFF01U, 0x3FC0U, 0x3E80U, 0xFE41U,
+        0xFA01U, 0x3AC0U, 0x3B80U, 0xFB41U, 0x3900U, 0xF9C1U, 0xF881U, 0x3840U,
+        0x2800U, 0xE8C1U, 0xE981U, 0x2940U, 0xEB01U, 0x2BC0U, 0x2A80U, 0xEA41U,
+        0xEE01U, 0x2EC0U, 0x2F80U, 0xEF41U, 0x2D00U, 0xEDC1U, 0xEC81U, 0x2C40U,
+        0xE401U, 0x24C0U, 0x2580U, 0xE541U, 0x2700U, 0xE7C1U, 0xE681U, 0x2640U,
+        0x2200U, 0xE2C1U, 0xE381U, 0x2340U, 0xE101U, 0x21C0U, 0x2080U, 0xE041U,
+        0xA001U, 0x60C0U, 0x6180U, 0xA141U, 0x6300U, 0xA3C1U, 0xA281U, 0x6240U,
+        0x6600U, 0xA6C1U, 0xA781U, 0x6740U, 0xA501U, 0x65C0U, 0x6480U, 0xA441U,
+        0x6C00U, 0xACC1U, 0xAD81U, 0x6D40U, 0xAF01U, 0x6FC0U, 0x6E80U, 0xAE41U,
+        0xAA01U, 0x6AC0U, 0x6B80U, 0xAB41U, 0x6900U, 0xA9C1U, 0xA881U, 0x6840U,
+        0x7800U, 0xB8C1U, 0xB981U, 0x7940U, 0xBB01U, 0x7BC0U, 0x7A80U, 0xBA41U,
+        0xBE01U, 0x7EC0U, 0x7F80U, 0xBF41U, 0x7D00U, 0xBDC1U, 0xBC81U, 0x7C40U,
+        0xB401U, 0x74C0U, 0x7580U, 0xB541U, 0x7700U, 0xB7C1U, 0xB681U, 0x7640U,
+        0x7200U, 0xB2C1U, 0xB381U, 0x7340U, 0xB101U, 0x71C0U, 0x7080U, 0xB041U,
+        0x5000U, 0x90C1U, 0x9181U, 0x5140U, 0x9301U, 0x53C0U, 0x5280U, 0x9241U,
+        0x9601U, 0x56C0U, 0x5780U, 0x9741U, 0x5500U, 0x95C1U, 0x9481U, 0x5440U,
+        0x9C01U, 0x5CC0U, 0x5D80U, 0x9D41U, 0x5F00U, 0x9FC1U, 0x9E81U, 0x5E40U,
+        0x5A00U, 0x9AC1U, 0x9B81U, 0x5B40U, 0x9901U, 0x59C0U, 0x5880U, 0x9841U,
+        0x8801U, 0x48C0U, 0x4980U, 0x8941U, 0x4B00U, 0x8BC1U, 0x8A81U, 0x4A40U,
+        0x4E00U, 0x8EC1U, 0x8F81U, 0x4F40U, 0x8D01U, 0x4DC0U, 0x4C80U, 0x8C41U,
+        0x4400U, 0x84C1U, 0x8581U, 0x4540U, 0x8701U, 0x47C0U, 0x4680U, 0x8641U,
+        0x8201U, 0x42C0U, 0x4380U, 0x8341U, 0x4100U, 0x81C1U, 0x8081U, 0x4040U,
+    },
+#if (SCI_CRC_SLICES > 1)
+    {
+        0x0000U, 0x9001U, 0x6001U, 0xF000U, 0xC002U, 0x5003U, 0xA003U, 0x3002U,
+        0xC007U, 0x5006U, 0xA006U, 0x3007U, 0x0005U, 0x9004U, 0x6004U, 0xF005U,
+        0xC00DU, 0x500CU, 0xA00CU, 0x300DU, 0x000FU, 0x900EU, 0x600EU, 0xF00FU,
+        0x000AU, 0x900BU, 0x600BU, 0xF00AU, 0xC008U, 0x5009U, 0xA009U, 0x3008U,
+        0xC019U, 0x5018U, 0xA018U, 0x3019U, 0x001BU, 0x901AU, 0x601AU, 0xF01BU,
+        0x001EU, 0x901FU, 0x601FU, 0xF01EU, 0xC01CU, 0x501DU, 0xA01DU, 0x301CU,
+        0x0014U, 0x9015U, 0x6015U, 0xF014U, 0xC016U, 0x5017U, 0xA017U, 0x3016U,
+        0xC013U, 0x5012U, 0xA012U, 0x3013U, 0x0011U, 0x9010U, 0x6010U, 0xF011U,
+        0xC031U, 0x5030U, 0xA030U, 0x3031U, 0x0033U, 0x9032U, 0x6032U, 0xF033U,
+        0x0036U, 0x9037U, 0x6037U, 0xF036U, 0xC034U, 0x5035U, 0xA035U, 0x3034U,
+        0x003CU, 0x903DU, 0x603DU, 0xF03CU, 0xC03EU, 0x503FU, 0xA03FU, 0x303EU,
+        0xC03BU, 0x503AU, 0xA03AU, 0x303BU, 0x0039U, 0x9038U, 0x6038U, 0xF039U,
+        0x0028U, 0x9029U, 0x6029U, 0xF028U, 0xC02AU, 0x502BU, 0xA02BU, 0x302AU,
+        0xC02FU, 0x502EU, 0xA02EU, 0x302FU, 0x002DU, 0x902CU, 0x602CU, 0xF02DU,
+        0xC025U, 0x5024U, 0xA024U, 0x3025U, 0x0027U, 0x9026U, 0x6026U, 0xF027U,
+        0x0022U, 0x9023U, 0x6023U, 0xF022U, 0xC020U, 0x5021U, 0xA021U, 0x3020U,
+        0xC061U, 0x5060U, 0xA060U, 0x3061U, 0x0063U, 0x9062U, 0x6062U, 0xF063U,
+        0x0066U, 0x9067U, 0x6067U, 0xF066U, 0xC064U, 0x5065U, 0xA065U, 0x3064U,
+        0x006CU, 0x906DU, 0x606DU, 0xF06CU, 0xC06EU, 0x506FU, 0xA06FU, 0x306EU,
+        0xC06BU, 0x506AU, 0xA06AU, 0x306BU, 0x0069U, 0x9068U, 0x6068U, 0xF069U,
+        0x0078U, 0x9079U, 0x6079U, 0xF078U, 0xC07AU, 0x507BU, 0xA07BU, 0x307AU,
+        0xC07FU, 0x507EU, 0xA07EU, 0x307FU, 0x007DU, 0x907CU, 0x607CU, 0xF07DU,
+        0xC075U, 0x5074U, 0xA074U, 0x3075U, 0x0077U, 0x9076U, 0x6076U, 0xF077U,
+        0x0072U, 0x9073U, 0x6073U, 0xF072U, 0xC070U, 0x5071U, 0xA071U, 0x3070U,
+        0x0050U, 0x9051U, 0x6051U, 0xF050U, 0xC052U, 0x5053U, 0xA053U, 0x3052U,
+        0xC057U, 0x5056U, 0xA056U, 0x3057U, 0x0055U, 0x9054U, 0x6054U, 0xF055U,
+        0xC05DU, 0x505CU, 0xA05CU, 0x305DU, 0x005FU, 0x905EU, 0x605EU, 0xF05FU,
+        0x005AU, 0x905BU, 0x605BU, 0xF05AU, 0xC058U, 0x5059U, 0xA059U, 0x3058U,
+        0xC049U, 0x5048U, 0xA048U, 0x3049U, 0x004BU, 0x904AU, 0x604AU, 0xF04BU,
+        0x004EU, 0x904FU, 0x604FU, 0xF04EU, 0xC04CU, 0x504DU, 0xA04DU, 0x304CU,
+        0x0044U, 0x9045U, 0x6045U, 0xF044U, 0xC046U, 0x5047U, 0xA047U, 0x3046U,
+        0xC043U, 0x5042U, 0xA042U, 0x3043U, 0x0041U, 0x9040U, 0x6040U, 0xF041U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 2)
+    {
+        0x0000U, 0xC051U, 0xC0A1U, 0x00F0U, 0xC141U, 0x0110U, 0x01E0U, 0xC1B1U,
+        0xC281U, 0x02D0U, 0x0220U, 0xC271U, 0x03C0U, 0xC391U, 0xC361U, 0x0330U,
+        0xC501U, 0x0550U, 0x05A0U, 0xC5F1U, 0x0440U, 0xC411U, 0xC4E1U, 0x04B0U,
+        0x0780U, 0xC7D1U, 0xC721U, 0x0770U, 0xC6C1U, 0x0690U, 0x0660U, 0xC631U,
+        0xCA01U, 0x0A50U, 0x0AA0U, 0xCAF1U, 0x0B40U, 0xCB11U, 0xCBE1U, 0x0BB0U,
+        0x0880U, 0xC8D1U, 0xC821U, 0x0870U, 0xC9C1U, 0x0990U, 0x0960U, 0xC931U,
+        0x0F00U, 0xCF51U, 0xCFA1U, 0x0FF0U, 0xCE41U, 0x0E10U, 0x0EE0U, 0xCEB1U,
+        0xCD81U, 0x0DD0U, 0x0D20U, 0xCD71U, 0x0CC0U, 0xCC91U, 0xCC61U, 0x0C30U,
+        0xD401U, 0x1450U, 0x14A0U, 0xD4F1U, 0x1540U, 0xD511U, 0xD5E1U, 0x15B0U,
+        0x1680U, 0xD6D1U, 0xD621U, 0x1670U, 0xD7C1U, 0x1790U, 0x1760U, 0xD731U,
+        0x1100U, 0xD151U, 0xD1A1U, 0x11F0U, 0xD041U, 0x1010U, 0x10E0U, 0xD0B1U,
+        0xD381U, 0x13D0U, 0x1320U, 0xD371U, 0x12C0U, 0xD291U, 0xD261U, 0x1230U,
+        0x1E00U, 0xDE51U, 0xDEA1U, 0x1EF0U, 0xDF41U, 0x1F10U, 0x1FE0U, 0xDFB1U,
+        0xDC81U, 0x1CD0U, 0x1C20U, 0xDC71U, 0x1DC0U, 0xDD91U, 0xDD61U, 0x1D30U,
+        0xDB01U, 0x1B50U, 0x1BA0U, 0xDBF1U, 0x1A40U, 0xDA11U, 0xDAE1U, 0x1AB0U,
+        0x1980U, 0xD9D1U, 0xD921U, 0x1970U, 0xD8C1U, 0x1890U, 0x1860U, 0xD831U,
+        0xE801U, 0x2850U, 0x28A0U, 0xE8F1U, 0x2940U, 0xE911U, 0xE9E1U, 0x29B0U,
+        0x2A80U, 0xEAD1U, 0xEA21U, 0x2A70U, 0xEBC1U, 0x2B90U, 0x2B60U, 0xEB31U,
+        0x2D00U, 0xED51U, 0xEDA1U, 0x2DF0U, 0xEC41U, 0x2C10U, 0x2CE0U, 0xECB1U,
+        0xEF81U, 0x2FD0U, 0x2F20U, 0xEF71U, 0x2EC0U, 0xEE91U, 0xEE61U, 0x2E30U,
+        0x2200U, 0xE251U, 0xE2A1U, 0x22F0U, 0xE341U, 0x2310U, 0x23E0U, 0xE3B1U,
+        0xE081U, 0x20D0U, 0x2020U, 0xE071U, 0x21C0U, 0xE191U, 0xE161U, 0x2130U,
+        0xE701U, 0x2750U, 0x27A0U, 0xE7F1U, 0x2640U, 0xE611U, 0xE6E1U, 0x26B0U,
+        0x2580U, 0xE5D1U, 0xE521U, 0x2570U, 0xE4C1U, 0x2490U, 0x2460U, 0xE431U,
+        0x3C00U, 0xFC51U, 0xFCA1U, 0x3CF0U, 0xFD41U, 0x3D10U, 0x3DE0U, 0xFDB1U,
+        0xFE81U, 0x3ED0U, 0x3E20U, 0xFE71U, 0x3FC0U, 0xFF91U, 0xFF61U, 0x3F30U,
+        0xF901U, 0x3950U, 0x39A0U, 0xF9F1U, 0x3840U, 0xF811U, 0xF8E1U, 0x38B0U,
+        0x3B80U, 0xFBD1U, 0xFB21U, 0x3B70U, 0xFAC1U, 0x3A90U, 0x3A60U, 0xFA31U,
+        0xF601U, 0x3650U, 0x36A0U, 0xF6F1U, 0x3740U, 0xF711U, 0xF7E1U, 0x37B0U,
+        0x3480U, 0xF4D1U, 0xF421U, 0x3470U, 0xF5C1U, 0x3590U, 0x3560U, 0xF531U,
+        0x3300U, 0xF351U, 0xF3A1U, 0x33F0U, 0xF241U, 0x3210U, 0x32E0U, 0xF2B1U,
+        0xF181U, 0x31D0U, 0x3120U, 0xF171U, 0x30C0U, 0xF091U, 0xF061U, 0x3030U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 3)
+    {
+        0x0000U, 0xFC01U, 0xB801U, 0x4400U, 0x3001U, 0xCC00U, 0x8800U, 0x7401U,
+        0x6002U, 0x9C03U, 0xD803U, 0x2402U, 0x5003U, 0xAC02U, 0xE802U, 0x1403U,
+        0xC004U, 0x3C05U, 0x7805U, 0x8404U, 0xF005U, 0x0C04U, 0x4804U, 0xB405U,
+        0xA006U, 0x5C07U, 0x1807U, 0xE406U, 0x9007U, 0x6C06U, 0x2806U, 0xD407U,
+        0xC00BU, 0x3C0AU, 0x780AU, 0x840BU, 0xF00AU, 0x0C0BU, 0x480BU, 0xB40AU,
+        0xA009U, 0x5C08U, 0x1808U, 0xE409U, 0x9008U, 0x6C09U, 0x2809U, 0xD408U,
+        0x000FU, 0xFC0EU, 0xB80EU, 0x440FU, 0x300EU, 0xCC0FU, 0x880FU, 0x740EU,
+        0x600DU, 0x9C0CU, 0xD80CU, 0x240DU, 0x500CU, 0xAC0DU, 0xE80DU, 0x140CU,
+        0xC015U, 0x3C14U, 0x7814U, 0x8415U, 0xF014U, 0x0C15U, 0x4815U, 0xB414U,
+        0xA017U, 0x5C16U, 0x1816U, 0xE417U, 0x9016U, 0x6C17U, 0x2817U, 0xD416U,
+        0x0011U, 0xFC10U, 0xB810U, 0x4411U, 0x3010U, 0xCC11U, 0x8811U, 0x7410U,
+        0x6013U, 0x9C12U, 0xD812U, 0x2413U, 0x5012U, 0xAC13U, 0xE813U, 0x1412U,
+        0x001EU, 0xFC1FU, 0xB81FU, 0x441EU, 0x301FU, 0xCC1EU, 0x881EU, 0x741FU,
+        0x601CU, 0x9C1DU, 0xD81DU, 0x241CU, 0x501DU, 0xAC1CU, 0xE81CU, 0x141DU,
+        0xC01AU, 0x3C1BU, 0x781BU, 0x841AU, 0xF01BU, 0x0C1AU, 0x481AU, 0xB41BU,
+        0xA018U, 0x5C19U, 0x1819U, 0xE418U, 0x9019U, 0x6C18U, 0x2818U, 0xD419U,
+        0xC029U, 0x3C28U, 0x7828U, 0x8429U, 0xF028U, 0x0C29U, 0x4829U, 0xB428U,
+        0xA02BU, 0x5C2AU, 0x182AU, 0xE42BU, 0x902AU, 0x6C2BU, 0x282BU, 0xD42AU,
+        0x002DU, 0xFC2CU, 0xB82CU, 0x442DU, 0x302CU, 0xCC2DU, 0x882DU, 0x742CU,
+        0x602FU, 0x9C2EU, 0xD82EU, 0x242FU, 0x502EU, 0xAC2FU, 0xE82FU, 0x142EU,
+        0x0022U, 0xFC23U, 0xB823U, 0x4422U, 0x3023U, 0xCC22U, 0x8822U, 0x7423U,
+        0x6020U, 0x9C21U, 0xD821U, 0x2420U, 0x5021U, 0xAC20U, 0xE820U, 0x1421U,
+        0xC026U, 0x3C27U, 0x7827U, 0x8426U, 0xF027U, 0x0C26U, 0x4826U, 0xB427U,
+        0xA024U, 0x5C25U, 0x1825U, 0xE424U, 0x9025U, 0x6C24U, 0x2824U, 0xD425U,
+        0x003CU, 0xFC3DU, 0xB83DU, 0x443CU, 0x303DU, 0xCC3CU, 0x883CU, 0x743DU,
+        0x603EU, 0x9C3FU, 0xD83FU, 0x243EU, 0x503FU, 0xAC3EU, 0xE83EU, 0x143FU,
+        0xC038U, 0x3C39U, 0x7839U, 0x8438U, 0xF039U, 0x0C38U, 0x4838U, 0xB439U,
+        0xA03AU, 0x5C3BU, 0x183BU, 0xE43AU, 0x903BU, 0x6C3AU, 0x283AU, 0xD43BU,
+        0xC037U, 0x3C36U, 0x7836U, 0x8437U, 0xF036U, 0x0C37U, 0x4837U, 0xB436U,
+        0xA035U, 0x5C34U, 0x1834U, 0xE435U, 0x9034U, 0x6C35U, 0x2835U, 0xD434U,
+        0x0033U, 0xFC32U, 0xB832U, 0x4433U, 0x3032U, 0xCC33U, 0x8833U, 0x7432U,
+        0x6031U, 0x9C30U, 0xD830U, 0x2431U, 0x5030U, 0xAC31U, 0xE831U, 0x1430U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 4)
+    {
+        0x0000U, 0xC03DU, 0xC079U, 0x0044U, 0xC0F1U, 0x00CCU, 0x0088U, 0xC0B5U,
+        0xC1E1U, 0x01DCU, 0x0198U, 0xC1A5U, 0x0110U, 0xC12DU, 0xC169U, 0x0154U,
+        0xC3C1U, 0x03FCU, 0x03B8U, 0xC385U, 0x0330U, 0xC30DU, 0xC349U, 0x0374U,
+        0x0220U, 0xC21DU, 0xC259U, 0x0264U, 0xC2D1U, 0x02ECU, 0x02A8U, 0xC295U,
+        0xC781U, 0x07BCU, 0x07F8U, 0xC7C5U, 0x0770U, 0xC74DU, 0xC709U, 0x0734U,
+        0x0660U, 0xC65DU, 0xC619U, 0x0624U, 0xC691U, 0x06ACU, 0x06E8U, 0xC6D5U,
+        0x0440U, 0xC47DU, 0xC439U, 0x0404U, 0xC4B1U, 0x048CU, 0x04C8U, 0xC4F5U,
+        0xC5A1U, 0x059CU, 0x05D8U, 0xC5E5U, 0x0550U, 0xC56DU, 0xC529U, 0x0514U,
+        0xCF01U, 0x0F3CU, 0x0F78U, 0xCF45U, 0x0FF0U, 0xCFCDU, 0xCF89U, 0x0FB4U,
+        0x0EE0U, 0xCEDDU, 0xCE99U, 0x0EA4U, 0xCE11U, 0x0E2CU, 0x0E68U, 0xCE55U,
+        0x0CC0U, 0xCCFDU, 0xCCB9U, 0x0C84U, 0xCC31U, 0x0C0CU, 0x0C48U, 0xCC75U,
+        0xCD21U, 0x0D1CU, 0x0D58U, 0xCD65U, 0x0DD0U, 0xCDEDU, 0xCDA9U, 0x0D94U,
+        0x0880U, 0xC8BDU, 0xC8F9U, 0x08C4U, 0xC871U, 0x084CU, 0x0808U, 0xC835U,
+        0xC961U, 0x095CU, 0x0918U, 0xC925U, 0x0990U, 0xC9ADU, 0xC9E9U, 0x09D4U,
+        0xCB41U, 0x0B7CU, 0x0B38U, 0xCB05U, 0x0BB0U, 0xCB8DU, 0xCBC9U, 0x0BF4U,
+        0x0AA0U, 0xCA9DU, 0xCAD9U, 0x0AE4U, 0xCA51U, 0x0A6CU, 0x0A28U, 0xCA15U,
+        0xDE01U, 0x1E3CU, 0x1E78U, 0xDE45U, 0x1EF0U, 0xDECDU, 0xDE89U, 0x1EB4U,
+        0x1FE0U, 0xDFDDU, 0xDF99U, 0x1FA4U, 0xDF11U, 0x1F2CU, 0x1F68U, 0xDF55U,
+        0x1DC0U, 0xDDFDU, 0xDDB9U, 0x1D84U, 0xDD31U, 0x1D0CU, 0x1D48U, 0xDD75U,
+        0xDC21U, 0x1C1CU, 0x1C58U, 0xDC65U, 0x1CD0U, 0xDCEDU, 0xDCA9U, 0x1C94U,
+        0x1980U, 0xD9BDU, 0xD9F9U, 0x19C4U, 0xD971U, 0x194CU, 0x1908U, 0xD935U,
+        0xD861U, 0x185CU, 0x1818U, 0xD825U, 0x1890U, 0xD8ADU, 0xD8E9U, 0x18D4U,
+        0xDA41U, 0x1A7CU, 0x1A38U, 0xDA05U, 0x1AB0U, 0xDA8DU, 0xDAC9U, 0x1AF4U,
+        0x1BA0U, 0xDB9DU, 0xDBD9U, 0x1BE4U, 0xDB51U, 0x1B6CU, 0x1B28U, 0xDB15U,
+        0x1100U, 0xD13DU, 0xD179U, 0x1144U, 0xD1F1U, 0x11CCU, 0x1188U, 0xD1B5U,
+        0xD0E1U, 0x10DCU, 0x1098U, 0xD0A5U, 0x1010U, 0xD02DU, 0xD069U, 0x1054U,
+        0xD2C1U, 0x12FCU, 0x12B8U, 0xD285U, 0x1230U, 0xD20DU, 0xD249U, 0x1274U,
+        0x1320U, 0xD31DU, 0xD359U, 0x1364U, 0xD3D1U, 0x13ECU, 0x13A8U, 0xD395U,
+        0xD681U, 0x16BCU, 0x16F8U, 0xD6C5U, 0x1670U, 0xD64DU, 0xD609U, 0x1634U,
+        0x1760U, 0xD75DU, 0xD719U, 0x1724U, 0xD791U, 0x17ACU, 0x17E8U, 0xD7D5U,
+        0x1540U, 0xD57DU, 0xD539U, 0x1504U, 0xD5B1U, 0x158CU, 0x15C8U, 0xD5F5U,
+        0xD4A1U, 0x149CU, 0x14D8U, 0xD4E5U, 0x1450U, 0xD46DU, 0xD429U, 0x1414U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 5)
+    {
+        0x0000U, 0xD101U, 0xE201U, 0x3300U, 0x8401U, 0x5500U, 0x6600U, 0xB701U,
+        0x4801U, 0x9900U, 0xAA00U, 0x7B01U, 0xCC00U, 0x1D01U, 0x2E01U, 0xFF00U,
+        0x9002U, 0x4103U, 0x7203U, 0xA302U, 0x1403U, 0xC502U, 0xF602U, 0x2703U,
+        0xD803U, 0x0902U, 0x3A02U, 0xEB03U, 0x5C02U, 0x8D03U, 0xBE03U, 0x6F02U,
+        0x6007U, 0xB106U, 0x8206U, 0x5307U, 0xE406U, 0x3507U, 0x0607U, 0xD706U,
+        0x2806U, 0xF907U, 0xCA07U, 0x1B06U, 0xAC07U, 0x7D06U, 0x4E06U, 0x9F07U,
+        0xF005U, 0x2104U, 0x1204U, 0xC305U, 0x7404U, 0xA505U, 0x9605U, 0x4704U,
+        0xB804U, 0x6905U, 0x5A05U, 0x8B04U, 0x3C05U, 0xED04U, 0xDE04U, 0x0F05U,
+        0xC00EU, 0x110FU, 0x220FU, 0xF30EU, 0x440FU, 0x950EU, 0xA60EU, 0x770FU,
+        0x880FU, 0x590EU, 0x6A0EU, 0xBB0FU, 0x0C0EU, 0xDD0FU, 0xEE0FU, 0x3F0EU,
+        0x500CU, 0x810DU, 0xB20DU, 0x630CU, 0xD40DU, 0x050CU, 0x360CU, 0xE70DU,
+        0x180DU, 0xC90CU, 0xFA0CU, 0x2B0DU, 0x9C0CU, 0x4D0DU, 0x7E0DU, 0xAF0CU,
+        0xA009U, 0x7108U, 0x4208U, 0x9309U, 0x2408U, 0xF509U, 0xC609U, 0x1708U,
+        0xE808U, 0x3909U, 0x0A09U, 0xDB08U, 0x6C09U, 0xBD08U, 0x8E08U, 0x5F09U,
+        0x300BU, 0xE10AU, 0xD20AU, 0x030BU, 0xB40AU, 0x650BU, 0x560BU, 0x870AU,
+        0x780AU, 0xA90BU, 0x9A0BU, 0x4B0AU, 0xFC0BU, 0x2D0AU, 0x1E0AU, 0xCF0BU,
+        0xC01FU, 0x111EU, 0x221EU, 0xF31FU, 0x441EU, 0x951FU, 0xA61FU, 0x771EU,
+        0x881EU, 0x591FU, 0x6A1FU, 0xBB1EU, 0x0C1FU, 0xDD1EU, 0xEE1EU, 0x3F1FU,
+        0x501DU, 0x811CU, 0xB21CU, 0x631DU, 0xD41CU, 0x051DU, 0x361DU, 0xE71CU,
+        0x181CU, 0xC91DU, 0xFA1DU, 0x2B1CU, 0x9C1DU, 0x4D1CU, 0x7E1CU, 0xAF1DU,
+        0xA018U, 0x7119U, 0x4219U, 0x9318U, 0x2419U, 0xF518U, 0xC618U, 0x1719U,
+        0xE819U, 0x3918U, 0x0A18U, 0xDB19U, 0x6C18U, 0xBD19U, 0x8E19U, 0x5F18U,
+        0x301AU, 0xE11BU, 0xD21BU, 0x031AU, 0xB41BU, 0x651AU, 0x561AU, 0x871BU,
+        0x781BU, 0xA91AU, 0x9A1AU, 0x4B1BU, 0xFC1AU, 0x2D1BU, 0x1E1BU, 0xCF1AU,
+        0x0011U, 0xD110U, 0xE210U, 0x3311U, 0x8410U, 0x5511U, 0x6611U, 0xB710U,
+        0x4810U, 0x9911U, 0xAA11U, 0x7B10U, 0xCC11U, 0x1D10U, 0x2E10U, 0xFF11U,
+        0x9013U, 0x4112U, 0x7212U, 0xA313U, 0x1412U, 0xC513U, 0xF613U, 0x2712U,
+        0xD812U, 0x0913U, 0x3A13U, 0xEB12U, 0x5C13U, 0x8D12U, 0xBE12U, 0x6F13U,
+        0x6016U, 0xB117U, 0x8217U, 0x5316U, 0xE417U, 0x3516U, 0x0616U, 0xD717U,
+        0x2817U, 0xF916U, 0xCA16U, 0x1B17U, 0xAC16U, 0x7D17U, 0x4E17U, 0x9F16U,
+        0xF014U, 0x2115U, 0x1215U, 0xC314U, 0x7415U, 0xA514U, 0x9614U, 0x4715U,
+        0xB815U, 0x6914U, 0x5A14U, 0x8B15U, 0x3C14U, 0xED15U, 0xDE15U, 0x0F14U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 6)
+    {
+        0x0000U, 0xC010U, 0xC023U, 0x0033U, 0xC045U, 0x0055U, 0x0066U, 0xC076U,
+        0xC089U, 0x0099U, 0x00AAU, 0xC0BAU, 0x00CCU, 0xC0DCU, 0xC0EFU, 0x00FFU,
+        0xC111U, 0x0101U, 0x0132U, 0xC122U, 0x0154U, 0xC144U, 0xC177U, 0x0167U,
+        0x0198U, 0xC188U, 0xC1BBU, 0x01ABU, 0xC1DDU, 0x01CDU, 0x01FEU, 0xC1EEU,
+        0xC221U, 0x0231U, 0x0202U, 0xC212U, 0x0264U, 0xC274U, 0xC247U, 0x0257U,
+        0x02A8U, 0xC2B8U, 0xC28BU, 0x029BU, 0xC2EDU, 0x02FDU, 0x02CEU, 0xC2DEU,
+        0x0330U, 0xC320U, 0xC313U, 0x0303U, 0xC375U, 0x0365U, 0x0356U, 0xC346U,
+        0xC3B9U, 0x03A9U, 0x039AU, 0xC38AU, 0x03FCU, 0xC3ECU, 0xC3DFU, 0x03CFU,
+        0xC441U, 0x0451U, 0x0462U, 0xC472U, 0x0404U, 0xC414U, 0xC427U, 0x0437U,
+        0x04C8U, 0xC4D8U, 0xC4EBU, 0x04FBU, 0xC48DU, 0x049DU, 0x04AEU, 0xC4BEU,
+        0x0550U, 0xC540U, 0xC573U, 0x0563U, 0xC515U, 0x0505U, 0x0536U, 0xC526U,
+        0xC5D9U, 0x05C9U, 0x05FAU, 0xC5EAU, 0x059CU, 0xC58CU, 0xC5BFU, 0x05AFU,
+        0x0660U, 0xC670U, 0xC643U, 0x0653U, 0xC625U, 0x0635U, 0x0606U, 0xC616U,
+        0xC6E9U, 0x06F9U, 0x06CAU, 0xC6DAU, 0x06ACU, 0xC6BCU, 0xC68FU, 0x069FU,
+        0xC771U, 0x0761U, 0x0752U, 0xC742U, 0x0734U, 0xC724U, 0xC717U, 0x0707U,
+        0x07F8U, 0xC7E8U, 0xC7DBU, 0x07CBU, 0xC7BDU, 0x07ADU, 0x079EU, 0xC78EU,
+        0xC881U, 0x0891U, 0x08A2U, 0xC8B2U, 0x08C4U, 0xC8D4U, 0xC8E7U, 0x08F7U,
+        0x0808U, 0xC818U, 0xC82BU, 0x083BU, 0xC84DU, 0x085DU, 0x086EU, 0xC87EU,
+        0x0990U, 0xC980U, 0xC9B3U, 0x09A3U, 0xC9D5U, 0x09C5U, 0x09F6U, 0xC9E6U,
+        0xC919U, 0x0909U, 0x093AU, 0xC92AU, 0x095CU, 0xC94CU, 0xC97FU, 0x096FU,
+        0x0AA0U, 0xCAB0U, 0xCA83U, 0x0A93U, 0xCAE5U, 0x0AF5U, 0x0AC6U, 0xCAD6U,
+        0xCA29U, 0x0A39U, 0x0A0AU, 0xCA1AU, 0x0A6CU, 0xCA7CU, 0xCA4FU, 0x0A5FU,
+        0xCBB1U, 0x0BA1U, 0x0B92U, 0xCB82U, 0x0BF4U, 0xCBE4U, 0xCBD7U, 0x0BC7U,
+        0x0B38U, 0xCB28U, 0xCB1BU, 0x0B0BU, 0xCB7DU, 0x0B6DU, 0x0B5EU, 0xCB4EU,
+        0x0CC0U, 0xCCD0U, 0xCCE3U, 0x0CF3U, 0xCC85U, 0x0C95U, 0x0CA6U, 0xCCB6U,
+        0xCC49U, 0x0C59U, 0x0C6AU, 0xCC7AU, 0x0C0CU, 0xCC1CU, 0xCC2FU, 0x0C3FU,
+        0xCDD1U, 0x0DC1U, 0x0DF2U, 0xCDE2U, 0x0D94U, 0xCD84U, 0xCDB7U, 0x0DA7U,
+        0x0D58U, 0xCD48U, 0xCD7BU, 0x0D6BU, 0xCD1DU, 0x0D0DU, 0x0D3EU, 0xCD2EU,
+        0xCEE1U, 0x0EF1U, 0x0EC2U, 0xCED2U, 0x0EA4U, 0xCEB4U, 0xCE87U, 0x0E97U,
+        0x0E68U, 0xCE78U, 0xCE4BU, 0x0E5BU, 0xCE2DU, 0x0E3DU, 0x0E0EU, 0xCE1EU,
+        0x0FF0U, 0xCFE0U, 0xCFD3U, 0x0FC3U, 0xCFB5U, 0x0FA5U, 0x0F96U, 0xCF86U,
+        0xCF79U, 0x0F69U, 0x0F5AU, 0xCF4AU, 0x0F3CU, 0xCF2CU, 0xCF1FU, 0x0F0FU,
+    },
+#endif
+#if (SCI_CRC_SLICES > 7)
+    {
+        0x0000U, 0xCCC1U, 0xD981U, 0x1540U, 0xF301U, 0x3FC0U, 0x2A80U, 0xE641U,
+        0xA601U, 0x6AC0U, 0x7F80U, 0xB341U, 0x5500U, 0x99C1U, 0x8C81U, 0x4040U,
+        0x0C01U, 0xC0C0U, 0xD580U, 0x1941U, 0xFF00U, 0x33C1U, 0x2681U, 0xEA40U,
+        0xAA00U, 0x66C1U, 0x7381U, 0xBF40U, 0x5901U, 0x95C0U, 0x8080U, 0x4C41U,
+        0x1802U, 0xD4C3U, 0xC183U, 0x0D42U, 0xEB03U, 0x27C2U, 0x3282U, 0xFE43U,
+        0xBE03U, 0x72C2U, 0x6782U, 0xAB43U, 0x4D02U, 0x81C3U, 0x9483U, 0x5842U,
+        0x1403U, 0xD8C2U, 0xCD82U, 0x0143U, 0xE702U, 0x2BC3U, 0x3E83U, 0xF242U,
+        0xB202U, 0x7EC3U, 0x6B83U, 0xA742U, 0x4103U, 0x8DC2U, 0x9882U, 0x5443U,
+        0x3004U, 0xFCC5U, 0xE985U, 0x2544U, 0xC305U, 0x0FC4U, 0x1A84U, 0xD645U,
+        0x9605U, 0x5AC4U, 0x4F84U, 0x8345U, 0x6504U, 0xA9C5U, 0xBC85U, 0x7044U,
+        0x3C05U, 0xF0C4U, 0xE584U, 0x2945U, 0xCF04U, 0x03C5U, 0x1685U, 0xDA44U,
+        0x9A04U, 0x56C5U, 0x4385U, 0x8F44U, 0x6905U, 0xA5C4U, 0xB084U, 0x7C45U,
+        0x2806U, 0xE4C7U, 0xF187U, 0x3D46U, 0xDB07U, 0x17C6U, 0x0286U, 0xCE47U,
+        0x8E07U, 0x42C6U, 0x5786U, 0x9B47U, 0x7D06U, 0xB1C7U, 0xA487U, 0x6846U,
+        0x2407U, 0xE8C6U, 0xFD86U, 0x3147U, 0xD706U, 0x1BC7U, 0x0E87U, 0xC246U,
+        0x8206U, 0x4EC7U, 0x5B87U, 0x9746U, 0x7107U, 0xBDC6U, 0xA886U, 0x6447U,
+        0x6008U, 0xACC9U, 0xB989U, 0x7548U, 0x9309U, 0x5FC8U, 0x4A88U, 0x8649U,
+        0xC609U, 0x0AC8U, 0x1F88U, 0xD349U, 0x3508U, 0xF9C9U, 0xEC89U, 0x2048U,
+        0x6C09U, 0xA0C8U, 0xB588U, 0x7949U, 0x9F08U, 0x53C9U, 0x4689U, 0x8A48U,
+        0xCA08U, 0x06C9U, 0x1389U, 0xDF48U, 0x3909U, 0xF5C8U, 0xE088U, 0x2C49U,
+        0x780AU, 0xB4CBU, 0xA18BU, 0x6D4AU, 0x8B0BU, 0x47CAU, 0x528AU, 0x9E4BU,
+        0xDE0BU, 0x12CAU, 0x078AU, 0xCB4BU, 0x2D0AU, 0xE1CBU, 0xF48BU, 0x384AU,
+        0x740BU, 0xB8CAU, 0xAD8AU, 0x614BU, 0x870AU, 0x4BCBU, 0x5E8BU, 0x924AU,
+        0xD20AU, 0x1ECBU, 0x0B8BU, 0xC74AU, 0x210BU, 0xEDCAU, 0xF88AU, 0x344BU,
+        0x500CU, 0x9CCDU, 0x898DU, 0x454CU, 0xA30DU, 0x6FCCU, 0x7A8CU, 0xB64DU,
+        0xF60DU, 0x3ACCU, 0x2F8CU, 0xE34DU, 0x050CU, 0xC9CDU, 0xDC8DU, 0x104CU,
+        0x5C0DU, 0x90CCU, 0x858CU, 0x494DU, 0xAF0CU, 0x63CDU, 0x768DU, 0xBA4CU,
+        0xFA0CU, 0x36CDU, 0x238DU, 0xEF4CU, 0x090DU, 0xC5CCU, 0xD08CU, 0x1C4DU,
+        0x480EU, 0x84CFU, 0x918FU, 0x5D4EU, 0xBB0FU, 0x77CEU, 0x628EU, 0xAE4FU,
+        0xEE0FU, 0x22CEU, 0x378EU, 0xFB4FU, 0x1D0EU, 0xD1CFU, 0xC48FU, 0x084EU,
+        0x440FU, 0x88CEU, 0x9D8EU, 0x514FU, 0xB70EU, 0x7BCFU, 0x6E8FU, 0xA24EU,
+        0xE20EU, 0x2ECFU, 0x3B8FU, 0xF74EU, 0x110FU, 0xDDCEU, 0xC88EU, 0x044FU,
+    },
+#endif
+};
+
+/* CRC-32, IEEE 802.3 reflected. */
+static const uint32_t s_sciCrc32Table[SCI_CRC_SLICES][256] = {
+    {
+        0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU, 0x076DC419U, 0x706AF48FU, 0xE963A535U, 0x9E6495A3U,
+        0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U, 0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U,
+        0x1DB71064U, 0x6AB020F2U, 0xF3B97148U, 0x84BE41DEU, 0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+        0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU, 0x14015C4FU, 0x63066CD9U, 0xFA0F3D63U, 0x8D080DF5U,
+        0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U, 0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU,
+        0x35B5A8FAU, 0x42B2986CU, 0xDBBBC9D6U, 0xACBCF940U, 0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+        0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U, 0x21B4F4B5U, 0x56B3C423U, 0xCFBA9599U, 0xB8BDA50FU,
+        0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U, 0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU,
+        0x76DC4190U, 0x01DB7106U, 0x98D220BCU, 0xEFD5102AU, 0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+        0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U, 0x7F6A0DBBU, 0x086D3D2DU, 0x91646C97U, 0xE6635C01U,
+        0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU, 0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U,
+        0x65B0D9C6U, 0x12B7E950U, 0x8BBEB8EAU, 0xFCB9887CU, 0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+        0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U, 0x4ADFA541U, 0x3DD895D7U, 0xA4D1C46DU, 0xD3D6F4FBU,
+        0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U, 0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U,
+        0x5005713CU, 0x270241AAU, 0xBE0B1010U, 0xC90C2086U, 0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+        0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U, 0x59B33D17U, 0x2EB40D81U, 0xB7BD5C3BU, 0xC0BA6CADU,
+        0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU, 0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U,
+        0xE3630B12U, 0x94643B84U, 0x0D6D6A3EU, 0x7A6A5AA8U, 0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+        0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU, 0xF762575DU, 0x806567CBU, 0x196C3671U, 0x6E6B06E7U,
+        0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU, 0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U,
+        0xD6D6A3E8U, 0xA1D1937EU, 0x38D8C2C4U, 0x4FDFF252U, 0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+        0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U, 0xDF60EFC3U, 0xA867DF55U, 0x316E8EEFU, 0x4669BE79U,
+        0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U, 0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU,
+        0xC5BA3BBEU, 0xB2BD0B28U, 0x2BB45A92U, 0x5CB36A04U, 0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+        0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU, 0x9C0906A9U, 0xEB0E363FU, 0x72076785U, 0x05005713U,
+        0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U, 0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U,
+        0x86D3D2D4U, 0xF1D4E242U, 0x68DDB3F8U, 0x1FDA836EU, 0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+        0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU, 0x8F659EFFU, 0xF862AE69U, 0x616BFFD3U, 0x166CCF45U,
+        0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U, 0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU,
+        0xAED16A4AU, 0xD9D65ADCU, 0x40DF0B66U, 0x37D83BF0U, 0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+        0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U, 0xBAD03605U, 0xCDD70693U, 0x54DE5729U, 0x23D967BFU,
+        0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U, 0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU,
+    },
+#if (SCI_CRC_SLICES > 1)
+    {
+        0x00000000U, 0x191B3141U, 0x32366282U, 0x2B2D53C3U, 0x646CC504U, 0x7D77F445U, 0x565AA786U, 0x4F4196C7U,
+        0xC8D98A08U, 0xD1C2BB49U, 0xFAEFE88AU, 0xE3F4D9CBU, 0xACB54F0CU, 0xB5AE7E4DU, 0x9E832D8EU, 0x87981CCFU,
+        0x4AC21251U, 0x53D92310U, 0x78F470D3U, 0x61EF4192U, 0x2EAED755U, 0x37B5E614U, 0x1C98B5D7U, 0x05838496U,
+        0x821B9859U, 0x9B00A918U, 0xB02DFADBU, 0xA936CB9AU, 0xE6775D5DU, 0xFF6C6C1CU, 0xD4413FDFU, 0xCD5A0E9EU,
+        0x958424A2U, 0x8C9F15E3U, 0xA7B24620U, 0xBEA97761U, 0xF1E8E1A6U, 0xE8F3D0E7U, 0xC3DE8324U, 0xDAC5B265U,
+        0x5D5DAEAAU, 0x44469FEBU, 0x6F6BCC28U, 0x7670FD69U, 0x39316BAEU, 0x202A5AEFU, 0x0B07092CU, 0x121C386DU,
+        0xDF4636F3U, 0xC65D07B2U, 0xED705471U, 0xF46B6530U, 0xBB2AF3F7U, 0xA231C2B6U, 0x891C9175U, 0x9007A034U,
+        0x179FBCFBU, 0x0E848DBAU, 0x25A9DE79U, 0x3CB2EF38U, 0x73F379FFU, 0x6AE848BEU, 0x41C51B7DU, 0x58DE2A3CU,
+        0xF0794F05U, 0xE9627E44U, 0xC24F2D87U, 0xDB541CC6U, 0x94158A01U, 0x8D0EBB40U, 0xA623E883U, 0xBF38D9C2U,
+        0x38A0C50DU, 0x21BBF44CU, 0x0A96A78FU, 0x138D96CEU, 0x5CCC0009U, 0x45D73148U, 0x6EFA628BU, 0x77E153CAU,
+        0xBABB5D54U, 0xA3A06C15U, 0x888D3FD6U, 0x91960E97U, 0xDED79850U, 0xC7CCA911U, 0xECE1FAD2U, 0xF5FACB93U,
+        0x7262D75CU, 0x6B79E61DU, 0x4054B5DEU, 0x594F849FU, 0x160E1258U, 0x0F152319U, 0x243870DAU, 0x3D23419BU,
+        0x65FD6BA7U, 0x7CE65AE6U, 0x57CB0925U, 0x4ED03864U, 0x0191AEA3U, 0x188A9FE2U, 0x33A7CC21U, 0x2ABCFD60U,
+        0xAD24E1AFU, 0xB43FD0EEU, 0x9F12832DU, 0x8609B26CU, 0xC94824ABU, 0xD05315EAU, 0xFB7E4629U, 0xE2657768U,
+        0x2F3F79F6U, 0x362448B7U, 0x1D091B74U, 0x04122A35U, 0x4B53BCF2U, 0x52488DB3U, 0x7965DE70U, 0x607EEF31U,
+        0xE7E6F3FEU, 0xFEFDC2BFU, 0xD5D0917CU, 0xCCCBA03DU, 0x838A36FAU, 0x9A9107BBU, 0xB1BC5478U, 0xA8A76539U,
+        0x3B83984BU, 0x2298A90AU, 0x09B5FAC9U, 0x10AECB88U, 0x5FEF5D4FU, 0x46F46C0EU, 0x6DD93FCDU, 0x74C20E8CU,
+        0xF35A1243U, 0xEA412302U, 0xC16C70C1U, 0xD8774180U, 0x9736D747U, 0x8E2DE606U, 0xA500B5C5U, 0xBC1B8484U,
+        0x71418A1AU, 0x685ABB5BU, 0x4377E898U, 0x5A6CD9D9U, 0x152D4F1EU, 0x0C367E5FU, 0x271B2D9CU, 0x3E001CDDU,
+        0xB9980012U, 0xA0833153U, 0x8BAE6290U, 0x92B553D1U, 0xDDF4C516U, 0xC4EFF457U, 0xEFC2A794U, 0xF6D996D5U,
+        0xAE07BCE9U, 0xB71C8DA8U, 0x9C31DE6BU, 0x852AEF2AU, 0xCA6B79EDU, 0xD37048ACU, 0xF85D1B6FU, 0xE1462A2EU,
+        0x66DE36E1U, 0x7FC507A0U, 0x54E85463U, 0x4DF36522U, 0x02B2F3E5U, 0x1BA9C2A4U, 0x30849167U, 0x299FA026U,
+        0xE4C5AEB8U, 0xFDDE9FF9U, 0xD6F3CC3AU, 0xCFE8FD7BU, 0x80A96BBCU, 0x99B25AFDU, 0xB29F093EU, 0xAB84387FU,
+        0x2C1C24B0U, 0x350715F1U, 0x1E2A4632U, 0x07317773U, 0x4870E1B4U, 0x516BD0F5U, 0x7A468336U, 0x635DB277U,
+        0xCBFAD74EU, 0xD2E1E60FU, 0xF9CCB5CCU, 0xE0D7848DU, 0xAF96124AU, 0xB68D230BU, 0x9DA070C8U, 0x84BB4189U,
+        0x03235D46U, 0x1A386C07U, 0x31153FC4U, 0x280E0E85U, 0x674F9842U, 0x7E54A903U, 0x5579FAC0U, 0x4C62CB81U,
+        0x8138C51FU, 0x9823F45EU, 0xB30EA79DU, 0xAA1596DCU, 0xE554001BU, 0xFC4F315AU, 0xD7626299U, 0xCE7953D8U,
+        0x49E14F17U, 0x50FA7E56U, 0x7BD72D95U, 0x62CC1CD4U, 0x2D8D8A13U, 0x3496BB52U, 0x1FBBE891U, 0x06A0D9D0U,
+        0x5E7EF3ECU, 0x4765C2ADU, 0x6C48916EU, 0x7553A02FU, 0x3A1236E8U, 0x230907A9U, 0x0824546AU, 0x113F652BU,
+        0x96A779E4U, 0x8FBC48A5U, 0xA4911B66U, 0xBD8A2A27U, 0xF2CBBCE0U, 0xEBD08DA1U, 0xC0FDDE62U, 0xD9E6EF23U,
+        0x14BCE1BDU, 0x0DA7D0FCU, 0x268A833FU, 0x3F91B27EU, 0x70D024B9U, 0x69CB15F8U, 0x42E6463BU, 0x5BFD777AU,
+        0xDC656BB5U, 0xC57E5AF4U, 0xEE530937U, 0xF7483876U, 0xB809AEB1U, 0xA1129FF0U, 0x8A3FCC33U, 0x9324FD72U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 2)
+    {
+        0x00000000U, 0x01C26A37U, 0x0384D46EU, 0x0246BE59U, 0x0709A8DCU, 0x06CBC2EBU, 0x048D7CB2U, 0x054F1685U,
+        0x0E1351B8U, 0x0FD13B8FU, 0x0D9785D6U, 0x0C55EFE1U, 0x091AF964U, 0x08D89353U, 0x0A9E2D0AU, 0x0B5C473DU,
+        0x1C26A370U, 0x1DE4C947U, 0x1FA2771EU, 0x1E601D29U, 0x1B2F0BACU, 0x1AED619BU, 0x18ABDFC2U, 0x1969B5F5U,
+        0x1235F2C8U, 0x13F798FFU, 0x11B126A6U, 0x10734C91U, 0x153C5A14U, 0x14FE3023U, 0x16B88E7AU, 0x177AE44DU,
+        0x384D46E0U, 0x398F2CD7U, 0x3BC9928EU, 0x3A0BF8B9U, 0x3F44EE3CU, 0x3E86840BU, 0x3CC03A52U, 0x3D025065U,
+        0x365E1758U, 0x379C7D6FU, 0x35DAC336U, 0x3418A901U, 0x3157BF84U, 0x3095D5B3U, 0x32D36BEAU, 0x331101DDU,
+        0x246BE590U, 0x25A98FA7U, 0x27EF31FEU, 0x262D5BC9U, 0x23624D4CU, 0x22A0277BU, 0x20E69922U, 0x2124F315U,
+        0x2A78B428U, 0x2BBADE1FU, 0x29FC6046U, 0x283E0A71U, 0x2D711CF4U, 0x2CB376C3U, 0x2EF5C89AU, 0x2F37A2ADU,
+        0x709A8DC0U, 0x7158E7F7U, 0x731E59AEU, 0x72DC3399U, 0x7793251CU, 0x76514F2BU, 0x7417F172U, 0x75D59B45U,
+        0x7E89DC78U, 0x7F4BB64FU, 0x7D0D0816U, 0x7CCF6221U, 0x798074A4U, 0x78421E93U, 0x7A04A0CAU, 0x7BC6CAFDU,
+        0x6CBC2EB0U, 0x6D7E4487U, 0x6F38FADEU, 0x6EFA90E9U, 0x6BB5866CU, 0x6A77EC5BU, 0x68315202U, 0x69F33835U,
+        0x62AF7F08U, 0x636D153FU, 0x612BAB66U, 0x60E9C151U, 0x65A6D7D4U, 0x6464BDE3U, 0x662203BAU, 0x67E0698DU,
+        0x48D7CB20U, 0x4915A117U, 0x4B531F4EU, 0x4A917579U, 0x4FDE63FCU, 0x4E1C09CBU, 0x4C5AB792U, 0x4D98DDA5U,
+        0x46C49A98U, 0x4706F0AFU, 0x45404EF6U, 0x448224C1U, 0x41CD3244U, 0x400F5873U, 0x4249E62AU, 0x438B8C1DU,
+        0x54F16850U, 0x55330267U, 0x5775BC3EU, 0x56B7D609U, 0x53F8C08CU, 0x523AAABBU, 0x507C14E2U, 0x51BE7ED5U,
+        0x5AE239E8U, 0x5B2053DFU, 0x5966ED86U, 0x58A487B1U, 0x5DEB9134U, 0x5C29FB03U, 0x5E6F455AU, 0x5FAD2F6DU,
+        0xE1351B80U, 0xE0F771B7U, 0xE2B1CFEEU, 0xE373A5D9U, 0xE63CB35CU, 0xE7FED96BU, 0xE5B86732U, 0xE47A0D05U,
+        0xEF264A38U, 0xEEE4200FU, 0xECA29E56U, 0xED60F461U, 0xE82FE2E4U, 0xE9ED88D3U, 0xEBAB368AU, 0xEA695CBDU,
+        0xFD13B8F0U, 0xFCD1D2C7U, 0xFE976C9EU, 0xFF5506A9U, 0xFA1A102CU, 0xFBD87A1BU, 0xF99EC442U, 0xF85CAE75U,
+        0xF300E948U, 0xF2C2837FU, 0xF0843D26U, 0xF1465711U, 0xF4094194U, 0xF5CB2BA3U, 0xF78D95FAU, 0xF64FFFCDU,
+        0xD9785D60U, 0xD8BA3757U, 0xDAFC890EU, 0xDB3EE339U, 0xDE71F5BCU, 0xDFB39F8BU, 0xDDF521D2U, 0xDC374BE5U,
+        0xD76B0CD8U, 0xD6A966EFU, 0xD4EFD8B6U, 0xD52DB281U, 0xD062A404U, 0xD1A0CE33U, 0xD3E6706AU, 0xD2241A5DU,
+        0xC55EFE10U, 0xC49C9427U, 0xC6DA2A7EU, 0xC7184049U, 0xC25756CCU, 0xC3953CFBU, 0xC1D382A2U, 0xC011E895U,
+        0xCB4DAFA8U, 0xCA8FC59FU, 0xC8C97BC6U, 0xC90B11F1U, 0xCC440774U, 0xCD866D43U, 0xCFC0D31AU, 0xCE02B92DU,
+        0x91AF9640U, 0x906DFC77U, 0x922B422EU, 0x93E92819U, 0x96A63E9CU, 0x976454ABU, 0x9522EAF2U, 0x94E080C5U,
+        0x9FBCC7F8U, 0x9E7EADCFU, 0x9C381396U, 0x9DFA79A1U, 0x98B56F24U, 0x99770513U, 0x9B31BB4AU, 0x9AF3D17DU,
+        0x8D893530U, 0x8C4B5F07U, 0x8E0DE15EU, 0x8FCF8B69U, 0x8A809DECU, 0x8B42F7DBU, 0x89044982U, 0x88C623B5U,
+        0x839A6488U, 0x82580EBFU, 0x801EB0E6U, 0x81DCDAD1U, 0x8493CC54U, 0x8551A663U, 0x8717183AU, 0x86D5720DU,
+        0xA9E2D0A0U, 0xA820BA97U, 0xAA6604CEU, 0xABA46EF9U, 0xAEEB787CU, 0xAF29124BU, 0xAD6FAC12U, 0xACADC625U,
+        0xA7F18118U, 0xA633EB2FU, 0xA4755576U, 0xA5B73F41U, 0xA0F829C4U, 0xA13A43F3U, 0xA37CFDAAU, 0xA2BE979DU,
+        0xB5C473D0U, 0xB40619E7U, 0xB640A7BEU, 0xB782CD89U, 0xB2CDDB0CU, 0xB30FB13BU, 0xB1490F62U, 0xB08B6555U,
+        0xBBD72268U, 0xBA15485FU, 0xB853F606U, 0xB9919C31U, 0xBCDE8AB4U, 0xBD1CE083U, 0xBF5A5EDAU, 0xBE9834EDU,
+    },
+#endif
+#if (SCI_CRC_SLICES > 3)
+    {
+        0x00000000U, 0xB8BC6765U, 0xAA09C88BU, 0x12B5AFEEU, 0x8F629757U, 0x37DEF032U, 0x256B5FDCU, 0x9DD738B9U,
+        0xC5B428EFU, 0x7D084F8AU, 0x6FBDE064U, 0xD7018701U, 0x4AD6BFB8U, 0xF26AD8DDU, 0xE0DF7733U, 0x58631056U,
+        0x5019579FU, 0xE8A530FAU, 0xFA109F14U, 0x42ACF871U, 0xDF7BC0C8U, 0x67C7A7ADU, 0x75720843U, 0xCDCE6F26U,
+        0x95AD7F70U, 0x2D111815U, 0x3FA4B7FBU, 0x8718D09EU, 0x1ACFE827U, 0xA2738F42U, 0xB0C620ACU, 0x087A47C9U,
+        0xA032AF3EU, 0x188EC85BU, 0x0A3B67B5U, 0xB28700D0U, 0x2F503869U, 0x97EC5F0CU, 0x8559F0E2U, 0x3DE59787U,
+        0x658687D1U, 0xDD3AE0B4U, 0xCF8F4F5AU, 0x7733283FU, 0xEAE41086U, 0x525877E3U, 0x40EDD80DU, 0xF851BF68U,
+        0xF02BF8A1U, 0x48979FC4U, 0x5A22302AU, 0xE29E574FU, 0x7F496FF6U, 0xC7F50893U, 0xD540A77DU, 0x6DFCC018U,
+        0x359FD04EU, 0x8D23B72BU, 0x9F9618C5U, 0x272A7FA0U, 0xBAFD4719U, 0x0241207CU, 0x10F48F92U, 0xA848E8F7U,
+        0x9B14583DU, 0x23A83F58U, 0x311D90B6U, 0x89A1F7D3U, 0x1476CF6AU, 0xACCAA80FU, 0xBE7F07E1U, 0x06C36084U,
+        0x5EA070D2U, 0xE61C17B7U, 0xF4A9B859U, 0x4C15DF3CU, 0xD1C2E785U, 0x697E80E0U, 0x7BCB2F0EU, 0xC377486BU,
+        0xCB0D0FA2U, 0x73B168C7U, 0x6104C729U, 0xD9B8A04CU, 0x446F98F5U, 0xFCD3FF90U, 0xEE66507EU, 0x56DA371BU,
+        0x0EB9274DU, 0xB6054028U, 0xA4B0EFC6U, 0x1C0C88A3U, 0x81DBB01AU, 0x3967D77FU, 0x2BD27891U, 0x936E1FF4U,
+        0x3B26F703U, 0x839A9066U, 0x912F3F88U, 0x299358EDU, 0xB4446054U, 0x0CF80731U, 0x1E4DA8DFU, 0xA6F1CFBAU,
+        0xFE92DFECU, 0x462EB889U, 0x549B1767U, 0xEC277002U, 0x71F048BBU, 0xC94C2FDEU, 0xDBF98030U, 0x6345E755U,
+        0x6B3FA09CU, 0xD383C7F9U, 0xC1366817U, 0x798A0F72U, 0xE45D37CBU, 0x5CE150AEU, 0x4E54FF40U, 0xF6E89825U,
+        0xAE8B8873U, 0x1637EF16U, 0x048240F8U, 0xBC3E279DU, 0x21E91F24U, 0x99557841U, 0x8BE0D7AFU, 0x335CB0CAU,
+        0xED59B63BU, 0x55E5D15EU, 0x47507EB0U, 0xFFEC19D5U, 0x623B216CU, 0xDA874609U, 0xC832E9E7U, 0x708E8E82U,
+        0x28ED9ED4U, 0x9051F9B1U, 0x82E4565FU, 0x3A58313AU, 0xA78F0983U, 0x1F336EE6U, 0x0D86C108U, 0xB53AA66DU,
+        0xBD40E1A4U, 0x05FC86C1U, 0x1749292FU, 0xAFF54E4AU, 0x322276F3U, 0x8A9E1196U, 0x982BBE78U, 0x2097D91DU,
+        0x78F4C94BU, 0xC048AE2EU, 0xD2FD01C0U, 0x6A4166A5U, 0xF7965E1CU, 0x4F2A3979U, 0x5D9F9697U, 0xE523F1F2U,
+        0x4D6B1905U, 0xF5D77E60U, 0xE762D18EU, 0x5FDEB6EBU, 0xC2098E52U, 0x7AB5E937U, 0x680046D9U, 0xD0BC21BCU,
+        0x88DF31EAU, 0x3063568FU, 0x22D6F961U, 0x9A6A9E04U, 0x07BDA6BDU, 0xBF01C1D8U, 0xADB46E36U, 0x15080953U,
+        0x1D724E9AU, 0xA5CE29FFU, 0xB77B8611U, 0x0FC7E174U, 0x9210D9CDU, 0x2AACBEA8U, 0x38191146U, 0x80A57623U,
+        0xD8C66675U, 0x607A0110U, 0x72CFAEFEU, 0xCA73C99BU, 0x57A4F122U, 0xEF189647U, 0xFDAD39A9U, 0x45115ECCU,
+        0x764DEE06U, 0xCEF18963U, 0xDC44268DU, 0x64F841E8U, 0xF92F7951U, 0x41931E34U, 0x5326B1DAU, 0xEB9AD6BFU,
+        0xB3F9C6E9U, 0x0B45A18CU, 0x19F00E62U, 0xA14C6907U, 0x3C9B51BEU, 0x842736DBU, 0x96929935U, 0x2E2EFE50U,
+        0x2654B999U, 0x9EE8DEFCU, 0x8C5D7112U, 0x34E11677U, 0xA9362ECEU, 0x118A49ABU, 0x033FE645U, 0xBB838120U,
+        0xE3E09176U, 0x5B5CF613U, 0x49E959FDU, 0xF1553E98U, 0x6C820621U, 0xD43E6144U, 0xC68BCEAAU, 0x7E37A9CFU,
+        0xD67F4138U, 0x6EC3265DU, 0x7C7689B3U, 0xC4CAEED6U, 0x591DD66FU, 0xE1A1B10AU, 0xF3141EE4U, 0x4BA87981U,
+        0x13CB69D7U, 0xAB770EB2U, 0xB9C2A15CU, 0x017EC639U, 0x9CA9FE80U, 0x241599E5U, 0x36A0360BU, 0x8E1C516EU,
+        0x866616A7U, 0x3EDA71C2U, 0x2C6FDE2CU, 0x94D3B949U, 0x090481F0U, 0xB1B8E695U, 0xA30D497BU, 0x1BB12E1EU,
+        0x43D23E48U, 0xFB6E592DU, 0xE9DBF6C3U, 0x516791A6U, 0xCCB0A91FU, 0x740CCE7AU, 0x66B96194U, 0xDE0506F1U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 4)
+    {
+        0x00000000U, 0x3D6029B0U, 0x7AC05360U, 0x47A07AD0U, 0xF580A6C0U, 0xC8E08F70U, 0x8F40F5A0U, 0xB220DC10U,
+        0x30704BC1U, 0x0D106271U, 0x4AB018A1U, 0x77D03111U, 0xC5F0ED01U, 0xF890C4B1U, 0xBF30BE61U, 0x825097D1U,
+        0x60E09782U, 0x5D80BE32U, 0x1A20C4E2U, 0x2740ED52U, 0x95603142U, 0xA80018F2U, 0xEFA06222U, 0xD2C04B92U,
+        0x5090DC43U, 0x6DF0F5F3U, 0x2A508F23U, 0x1730A693U, 0xA5107A83U, 0x98705333U, 0xDFD029E3U, 0xE2B00053U,
+        0xC1C12F04U, 0xFCA106B4U, 0xBB017C64U, 0x866155D4U, 0x344189C4U, 0x0921A074U, 0x4E81DAA4U, 0x73E1F314U,
+        0xF1B164C5U, 0xCCD14D75U, 0x8B7137A5U, 0xB6111E15U, 0x0431C205U, 0x3951EBB5U, 0x7EF19165U, 0x4391B8D5U,
+        0xA121B886U, 0x9C419136U, 0xDBE1EBE6U, 0xE681C256U, 0x54A11E46U, 0x69C137F6U, 0x2E614D26U, 0x13016496U,
+        0x9151F347U, 0xAC31DAF7U, 0xEB91A027U, 0xD6F18997U, 0x64D15587U, 0x59B17C37U, 0x1E1106E7U, 0x23712F57U,
+        0x58F35849U, 0x659371F9U, 0x22330B29U, 0x1F532299U, 0xAD73FE89U, 0x9013D739U, 0xD7B3ADE9U, 0xEAD38459U,
+        0x68831388U, 0x55E33A38U, 0x124340E8U, 0x2F236958U, 0x9D03B548U, 0xA0639CF8U, 0xE7C3E628U, 0xDAA3CF98U,
+        0x3813CFCBU, 0x0573E67BU, 0x42D39CABU, 0x7FB3B51BU, 0xCD93690BU, 0xF0F340BBU, 0xB7533A6BU, 0x8A3313DBU,
+        0x0863840AU, 0x3503ADBAU, 0x72A3D76AU, 0x4FC3FEDAU, 0xFDE322CAU, 0xC0830B7AU, 0x872371AAU, 0xBA43581AU,
+        0x9932774DU, 0xA4525EFDU, 0xE3F2242DU, 0xDE920D9DU, 0x6CB2D18DU, 0x51D2F83DU, 0x167282EDU, 0x2B12AB5DU,
+        0xA9423C8CU, 0x9422153CU, 0xD3826FECU, 0xEEE2465CU, 0x5CC29A4CU, 0x61A2B3FCU, 0x2602C92CU, 0x1B62E09CU,
+        0xF9D2E0CFU, 0xC4B2C97FU, 0x8312B3AFU, 0xBE729A1FU, 0x0C52460FU, 0x31326FBFU, 0x7692156FU, 0x4BF23CDFU,
+        0xC9A2AB0EU, 0xF4C282BEU, 0xB362F86EU, 0x8E02D1DEU, 0x3C220DCEU, 0x0142247EU, 0x46E25EAEU, 0x7B82771EU,
+        0xB1E6B092U, 0x8C869922U, 0xCB26E3F2U, 0xF646CA42U, 0x44661652U, 0x79063FE2U, 0x3EA64532U, 0x03C66C82U,
+        0x8196FB53U, 0xBCF6D2E3U, 0xFB56A833U, 0xC6368183U, 0x74165D93U, 0x49767423U, 0x0ED60EF3U, 0x33B62743U,
+        0xD1062710U, 0xEC660EA0U, 0xABC67470U, 0x96A65DC0U, 0x248681D0U, 0x19E6A860U, 0x5E46D2B0U, 0x6326FB00U,
+        0xE1766CD1U, 0xDC164561U, 0x9BB63FB1U, 0xA6D61601U, 0x14F6CA11U, 0x2996E3A1U, 0x6E369971U, 0x5356B0C1U,
+        0x70279F96U, 0x4D47B626U, 0x0AE7CCF6U, 0x3787E546U, 0x85A73956U, 0xB8C710E6U, 0xFF676A36U, 0xC2074386U,
+        0x4057D457U, 0x7D37FDE7U, 0x3A978737U, 0x07F7AE87U, 0xB5D77297U, 0x88B75B27U, 0xCF1721F7U, 0xF2770847U,
+        0x10C70814U, 0x2DA721A4U, 0x6A075B74U, 0x576772C4U, 0xE547AED4U, 0xD8278764U, 0x9F87FDB4U, 0xA2E7D404U,
+        0x20B743D5U, 0x1DD76A65U, 0x5A7710B5U, 0x67173905U, 0xD537E515U, 0xE857CCA5U, 0xAFF7B675U, 0x92979FC5U,
+        0xE915E8DBU, 0xD475C16BU, 0x93D5BBBBU, 0xAEB5920BU, 0x1C954E1BU, 0x21F567ABU, 0x66551D7BU, 0x5B3534CBU,
+        0xD965A31AU, 0xE4058AAAU, 0xA3A5F07AU, 0x9EC5D9CAU, 0x2CE505DAU, 0x11852C6AU, 0x562556BAU, 0x6B457F0AU,
+        0x89F57F59U, 0xB49556E9U, 0xF3352C39U, 0xCE550589U, 0x7C75D999U, 0x4115F029U, 0x06B58AF9U, 0x3BD5A349U,
+        0xB9853498U, 0x84E51D28U, 0xC34567F8U, 0xFE254E48U, 0x4C059258U, 0x7165BBE8U, 0x36C5C138U, 0x0BA5E888U,
+        0x28D4C7DFU, 0x15B4EE6FU, 0x521494BFU, 0x6F74BD0FU, 0xDD54611FU, 0xE03448AFU, 0xA794327FU, 0x9AF41BCFU,
+        0x18A48C1EU, 0x25C4A5AEU, 0x6264DF7EU, 0x5F04F6CEU, 0xED242ADEU, 0xD044036EU, 0x97E479BEU, 0xAA84500EU,
+        0x4834505DU, 0x755479EDU, 0x32F4033DU, 0x0F942A8DU, 0xBDB4F69DU, 0x80D4DF2DU, 0xC774A5FDU, 0xFA148C4DU,
+        0x78441B9CU, 0x4524322CU, 0x028448FCU, 0x3FE4614CU, 0x8DC4BD5CU, 0xB0A494ECU, 0xF704EE3CU, 0xCA64C78CU,
+    },
+#endif
+#if (SCI_CRC_SLICES > 5)
+    {
+        0x00000000U, 0xCB5CD3A5U, 0x4DC8A10BU, 0x869472AEU, 0x9B914216U, 0x50CD91B3U, 0xD659E31DU, 0x1D0530B8U,
+        0xEC53826DU, 0x270F51C8U, 0xA19B2366U, 0x6AC7F0C3U, 0x77C2C07BU, 0xBC9E13DEU, 0x3A0A6170U, 0xF156B2D5U,
+        0x03D6029BU, 0xC88AD13EU, 0x4E1EA390U, 0x85427035U, 0x9847408DU, 0x531B9328U, 0xD58FE186U, 0x1ED33223U,
+        0xEF8580F6U, 0x24D95353U, 0xA24D21FDU, 0x6911F258U, 0x7414C2E0U, 0xBF481145U, 0x39DC63EBU, 0xF280B04EU,
+        0x07AC0536U, 0xCCF0D693U, 0x4A64A43DU, 0x81387798U, 0x9C3D4720U, 0x57619485U, 0xD1F5E62BU, 0x1AA9358EU,
+        0xEBFF875BU, 0x20A354FEU, 0xA6372650U, 0x6D6BF5F5U, 0x706EC54DU, 0xBB3216E8U, 0x3DA66446U, 0xF6FAB7E3U,
+        0x047A07ADU, 0xCF26D408U, 0x49B2A6A6U, 0x82EE7503U, 0x9FEB45BBU, 0x54B7961EU, 0xD223E4B0U, 0x197F3715U,
+        0xE82985C0U, 0x23755665U, 0xA5E124CBU, 0x6EBDF76EU, 0x73B8C7D6U, 0xB8E41473U, 0x3E7066DDU, 0xF52CB578U,
+        0x0F580A6CU, 0xC404D9C9U, 0x4290AB67U, 0x89CC78C2U, 0x94C9487AU, 0x5F959BDFU, 0xD901E971U, 0x125D3AD4U,
+        0xE30B8801U, 0x28575BA4U, 0xAEC3290AU, 0x659FFAAFU, 0x789ACA17U, 0xB3C619B2U, 0x35526B1CU, 0xFE0EB8B9U,
+        0x0C8E08F7U, 0xC7D2DB52U, 0x4146A9FCU, 0x8A1A7A59U, 0x971F4AE1U, 0x5C439944U, 0xDAD7EBEAU, 0x118B384FU,
+        0xE0DD8A9AU, 0x2B81593FU, 0xAD152B91U, 0x6649F834U, 0x7B4CC88CU, 0xB0101B29U, 0x36846987U, 0xFDD8BA22U,
+        0x08F40F5AU, 0xC3A8DCFFU, 0x453CAE51U, 0x8E607DF4U, 0x93654D4CU, 0x58399EE9U, 0xDEADEC47U, 0x15F13FE2U,
+        0xE4A78D37U, 0x2FFB5E92U, 0xA96F2C3CU, 0x6233FF99U, 0x7F36CF21U, 0xB46A1C84U, 0x32FE6E2AU, 0xF9A2BD8FU,
+        0x0B220DC1U, 0xC07EDE64U, 0x46EAACCAU, 0x8DB67F6FU, 0x90B34FD7U, 0x5BEF9C72U, 0xDD7BEEDCU, 0x16273D79U,
+        0xE7718FACU, 0x2C2D5C09U, 0xAAB92EA7U, 0x61E5FD02U, 0x7CE0CDBAU, 0xB7BC1E1FU, 0x31286CB1U, 0xFA74BF14U,
+        0x1EB014D8U, 0xD5ECC77DU, 0x5378B5D3U, 0x98246676U, 0x852156CEU, 0x4E7D856BU, 0xC8E9F7C5U, 0x03B52460U,
+        0xF2E396B5U, 0x39BF4510U, 0xBF2B37BEU, 0x7477E41BU, 0x6972D4A3U, 0xA22E0706U, 0x24BA75A8U, 0xEFE6A60DU,
+        0x1D661643U, 0xD63AC5E6U, 0x50AEB748U, 0x9BF264EDU, 0x86F75455U, 0x4DAB87F0U, 0xCB3FF55EU, 0x006326FBU,
+        0xF135942EU, 0x3A69478BU, 0xBCFD3525U, 0x77A1E680U, 0x6AA4D638U, 0xA1F8059DU, 0x276C7733U, 0xEC30A496U,
+        0x191C11EEU, 0xD240C24BU, 0x54D4B0E5U, 0x9F886340U, 0x828D53F8U, 0x49D1805DU, 0xCF45F2F3U, 0x04192156U,
+        0xF54F9383U, 0x3E134026U, 0xB8873288U, 0x73DBE12DU, 0x6EDED195U, 0xA5820230U, 0x2316709EU, 0xE84AA33BU,
+        0x1ACA1375U, 0xD196C0D0U, 0x5702B27EU, 0x9C5E61DBU, 0x815B5163U, 0x4A0782C6U, 0xCC93F068U, 0x07CF23CDU,
+        0xF6999118U, 0x3DC542BDU, 0xBB513013U, 0x700DE3B6U, 0x6D08D30EU, 0xA65400ABU, 0x20C07205U, 0xEB9CA1A0U,
+        0x11E81EB4U, 0xDAB4CD11U, 0x5C20BFBFU, 0x977C6C1AU, 0x8A795CA2U, 0x41258F07U, 0xC7B1FDA9U, 0x0CED2E0CU,
+        0xFDBB9CD9U, 0x36E74F7CU, 0xB0733DD2U, 0x7B2FEE77U, 0x662ADECFU, 0xAD760D6AU, 0x2BE27FC4U, 0xE0BEAC61U,
+        0x123E1C2FU, 0xD962CF8AU, 0x5FF6BD24U, 0x94AA6E81U, 0x89AF5E39U, 0x42F38D9CU, 0xC467FF32U, 0x0F3B2C97U,
+        0xFE6D9E42U, 0x35314DE7U, 0xB3A53F49U, 0x78F9ECECU, 0x65FCDC54U, 0xAEA00FF1U, 0x28347D5FU, 0xE368AEFAU,
+        0x16441B82U, 0xDD18C827U, 0x5B8CBA89U, 0x90D0692CU, 0x8DD55994U, 0x46898A31U, 0xC01DF89FU, 0x0B412B3AU,
+        0xFA1799EFU, 0x314B4A4AU, 0xB7DF38E4U, 0x7C83EB41U, 0x6186DBF9U, 0xAADA085CU, 0x2C4E7AF2U, 0xE712A957U,
+        0x15921919U, 0xDECECABCU, 0x585AB812U, 0x93066BB7U, 0x8E035B0FU, 0x455F88AAU, 0xC3CBFA04U, 0x089729A1U,
+        0xF9C19B74U, 0x329D48D1U, 0xB4093A7FU, 0x7F55E9DAU, 0x6250D962U, 0xA90C0AC7U, 0x2F987869U, 0xE4C4ABCCU,
+    },
+#endif
+#if (SCI_CRC_SLICES > 6)
+    {
+        0x00000000U, 0xA6770BB4U, 0x979F1129U, 0x31E81A9DU, 0xF44F2413U, 0x52382FA7U, 0x63D0353AU, 0xC5A73E8EU,
+        0x33EF4E67U, 0x959845D3U, 0xA4705F4EU, 0x020754FAU, 0xC7A06A74U, 0x61D761C0U, 0x503F7B5DU, 0xF64870E9U,
+        0x67DE9CCEU, 0xC1A9977AU, 0xF0418DE7U, 0x56368653U, 0x9391B8DDU, 0x35E6B369U, 0x040EA9F4U, 0xA279A240U,
+        0x5431D2A9U, 0xF246D91DU, 0xC3AEC380U, 0x65D9C834U, 0xA07EF6BAU, 0x0609FD0EU, 0x37E1E793U, 0x9196EC27U,
+        0xCFBD399CU, 0x69CA3228U, 0x582228B5U, 0xFE552301U, 0x3BF21D8FU, 0x9D85163BU, 0xAC6D0CA6U, 0x0A1A0712U,
+        0xFC5277FBU, 0x5A257C4FU, 0x6BCD66D2U, 0xCDBA6D66U, 0x081D53E8U, 0xAE6A585CU, 0x9F8242C1U, 0x39F54975U,
+        0xA863A552U, 0x0E14AEE6U, 0x3FFCB47BU, 0x998BBFCFU, 0x5C2C8141U, 0xFA5B8AF5U, 0xCBB39068U, 0x6DC49BDCU,
+        0x9B8CEB35U, 0x3DFBE081U, 0x0C13FA1CU, 0xAA64F1A8U, 0x6FC3CF26U, 0xC9B4C492U, 0xF85CDE0FU, 0x5E2BD5BBU,
+        0x440B7579U, 0xE27C7ECDU, 0xD3946450U, 0x75E36FE4U, 0xB044516AU, 0x16335ADEU, 0x27DB4043U, 0x81AC4BF7U,
+        0x77E43B1EU, 0xD19330AAU, 0xE07B2A37U, 0x460C2183U, 0x83AB1F0DU, 0x25DC14B9U, 0x14340E24U, 0xB2430590U,
+        0x23D5E9B7U, 0x85A2E203U, 0xB44AF89EU, 0x123DF32AU, 0xD79ACDA4U, 0x71EDC610U, 0x4005DC8DU, 0xE672D739U,
+        0x103AA7D0U, 0xB64DAC64U, 0x87A5B6F9U, 0x21D2BD4DU, 0xE47583C3U, 0x42028877U, 0x73EA92EAU, 0xD59D995EU,
+        0x8BB64CE5U, 0x2DC14751U, 0x1C295DCCU, 0xBA5E5678U, 0x7FF968F6U, 0xD98E6342U, 0xE86679DFU, 0x4E11726BU,
+        0xB8590282U, 0x1E2E0936U, 0x2FC613ABU, 0x89B1181FU, 0x4C162691U, 0xEA612D25U, 0xDB8937B8U, 0x7DFE3C0CU,
+        0xEC68D02BU, 0x4A1FDB9FU, 0x7BF7C102U, 0xDD80CAB6U, 0x1827F438U, 0xBE50FF8CU, 0x8FB8E511U, 0x29CFEEA5U,
+        0xDF879E4CU, 0x79F095F8U, 0x48188F65U, 0xEE6F84D1U, 0x2BC8BA5FU, 0x8DBFB1EBU, 0xBC57AB76U, 0x1A20A0C2U,
+        0x8816EAF2U, 0x2E61E146U, 0x1F89FBDBU, 0xB9FEF06FU, 0x7C59CEE1U, 0xDA2EC555U, 0xEBC6DFC8U, 0x4DB1D47CU,
+        0xBBF9A495U, 0x1D8EAF21U, 0x2C66B5BCU, 0x8A11BE08U, 0x4FB68086U, 0xE9C18B32U, 0xD82991AFU, 0x7E5E9A1BU,
+        0xEFC8763CU, 0x49BF7D88U, 0x78576715U, 0xDE206CA1U, 0x1B87522FU, 0xBDF0599BU, 0x8C184306U, 0x2A6F48B2U,
+        0xDC27385BU, 0x7A5033EFU, 0x4BB82972U, 0xEDCF22C6U, 0x28681C48U, 0x8E1F17FCU, 0xBFF70D61U, 0x198006D5U,
+        0x47ABD36EU, 0xE1DCD8DAU, 0xD034C247U, 0x7643C9F3U, 0xB3E4F77DU, 0x1593FCC9U, 0x247BE654U, 0x820CEDE0U,
+        0x74449D09U, 0xD23396BDU, 0xE3DB8C20U, 0x45AC8794U, 0x800BB91AU, 0x267CB2AEU, 0x1794A833U, 0xB1E3A387U,
+        0x20754FA0U, 0x86024414U, 0xB7EA5E89U, 0x119D553DU, 0xD43A6BB3U, 0x724D6007U, 0x43A57A9AU, 0xE5D2712EU,
+        0x139A01C7U, 0xB5ED0A73U, 0x840510EEU, 0x22721B5AU, 0xE7D525D4U, 0x41A22E60U, 0x704A34FDU, 0xD63D3F49U,
+        0xCC1D9F8BU, 0x6A6A943FU, 0x5B828EA2U, 0xFDF58516U, 0x3852BB98U, 0x9E25B02CU, 0xAFCDAAB1U, 0x09BAA105U,
+        0xFFF2D1ECU, 0x5985DA58U, 0x686DC0C5U, 0xCE1ACB71U, 0x0BBDF5FFU, 0xADCAFE4BU, 0x9C22E4D6U, 0x3A55EF62U,
+        0xABC30345U, 0x0DB408F1U, 0x3C5C126CU, 0x9A2B19D8U, 0x5F8C2756U, 0xF9FB2CE2U, 0xC813367FU, 0x6E643DCBU,
+        0x982C4D22U, 0x3E5B4696U, 0x0FB35C0BU, 0xA9C457BFU, 0x6C636931U, 0xCA146285U, 0xFBFC7818U, 0x5D8B73ACU,
+        0x03A0A617U, 0xA5D7ADA3U, 0x943FB73EU, 0x3248BC8AU, 0xF7EF8204U, 0x519889B0U, 0x6070932DU, 0xC6079899U,
+        0x304FE870U, 0x9638E3C4U, 0xA7D0F959U, 0x01A7F2EDU, 0xC400CC63U, 0x6277C7D7U, 0x539FDD4AU, 0xF5E8D6FEU,
+        0x647E3AD9U, 0xC209316DU, 0xF3E12BF0U, 0x55962044U, 0x90311ECAU, 0x3646157EU, 0x07AE0FE3U, 0xA1D90457U,
+        0x579174BEU, 0xF1E67F0AU, 0xC00E6597U, 0x66796E23U, 0xA3DE50ADU, 0x05A95B19U, 0x34414184U, 0x92364A30U,
+    },
+#endif
+#if (SCI_CRC_SLICES > 7)
+    {
+        0x00000000U, 0xCCAA009EU, 0x4225077DU, 0x8E8F07E3U, 0x844A0EFAU, 0x48E00E64U, 0xC66F0987U, 0x0AC50919U,
+        0xD3E51BB5U, 0x1F4F1B2BU, 0x91C01CC8U, 0x5D6A1C56U, 0x57AF154FU, 0x9B0515D1U, 0x158A1232U, 0xD92012ACU,
+        0x7CBB312BU, 0xB01131B5U, 0x3E9E3656U, 0xF23436C8U, 0xF8F13FD1U, 0x345B3F4FU, 0xBAD438ACU, 0x767E3832U,
+        0xAF5E2A9EU, 0x63F42A00U, 0xED7B2DE3U, 0x21D12D7DU, 0x2B142464U, 0xE7BE24FAU, 0x69312319U, 0xA59B2387U,
+        0xF9766256U, 0x35DC62C8U, 0xBB53652BU, 0x77F965B5U, 0x7D3C6CACU, 0xB1966C32U, 0x3F196BD1U, 0xF3B36B4FU,
+        0x2A9379E3U, 0xE639797DU, 0x68B67E9EU, 0xA41C7E00U, 0xAED97719U, 0x62737787U, 0xECFC7064U, 0x205670FAU,
+        0x85CD537DU, 0x496753E3U, 0xC7E85400U, 0x0B42549EU, 0x01875D87U, 0xCD2D5D19U, 0x43A25AFAU, 0x8F085A64U,
+        0x562848C8U, 0x9A824856U, 0x140D4FB5U, 0xD8A74F2BU, 0xD2624632U, 0x1EC846ACU, 0x9047414FU, 0x5CED41D1U,
+        0x299DC2EDU, 0xE537C273U, 0x6BB8C590U, 0xA712C50EU, 0xADD7CC17U, 0x617DCC89U, 0xEFF2CB6AU, 0x2358CBF4U,
+        0xFA78D958U, 0x36D2D9C6U, 0xB85DDE25U, 0x74F7DEBBU, 0x7E32D7A2U, 0xB298D73CU, 0x3C17D0DFU, 0xF0BDD041U,
+        0x5526F3C6U, 0x998CF358U, 0x1703F4BBU, 0xDBA9F425U, 0xD16CFD3CU, 0x1DC6FDA2U, 0x9349FA41U, 0x5FE3FADFU,
+        0x86C3E873U, 0x4A69E8EDU, 0xC4E6EF0EU, 0x084CEF90U, 0x0289E689U, 0xCE23E617U, 0x40ACE1F4U, 0x8C06E16AU,
+        0xD0EBA0BBU, 0x1C41A025U, 0x92CEA7C6U, 0x5E64A758U, 0x54A1AE41U, 0x980BAEDFU, 0x1684A93CU, 0xDA2EA9A2U,
+        0x030EBB0EU, 0xCFA4BB90U, 0x412BBC73U, 0x8D81BCEDU, 0x8744B5F4U, 0x4BEEB56AU, 0xC561B289U, 0x09CBB217U,
+        0xAC509190U, 0x60FA910EU, 0xEE7596EDU, 0x22DF9673U, 0x281A9F6AU, 0xE4B09FF4U, 0x6A3F9817U, 0xA6959889U,
+        0x7FB58A25U, 0xB31F8ABBU, 0x3D908D58U, 0xF13A8DC6U, 0xFBFF84DFU, 0x37558441U, 0xB9DA83A2U, 0x7570833CU,
+        0x533B85DAU, 0x9F918544U, 0x111E82A7U, 0xDDB48239U, 0xD7718B20U, 0x1BDB8BBEU, 0x95548C5DU, 0x59FE8CC3U,
+        0x80DE9E6FU, 0x4C749EF1U, 0xC2FB9912U, 0x0E51998CU, 0x04949095U, 0xC83E900BU, 0x46B197E8U, 0x8A1B9776U,
+        0x2F80B4F1U, 0xE32AB46FU, 0x6DA5B38CU, 0xA10FB312U, 0xABCABA0BU, 0x6760BA95U, 0xE9EFBD76U, 0x2545BDE8U,
+        0xFC65AF44U, 0x30CFAFDAU, 0xBE40A839U, 0x72EAA8A7U, 0x782FA1BEU, 0xB485A120U, 0x3A0AA6C3U, 0xF6A0A65DU,
+        0xAA4DE78CU, 0x66E7E712U, 0xE868E0F1U, 0x24C2E06FU, 0x2E07E976U, 0xE2ADE9E8U, 0x6C22EE0BU, 0xA088EE95U,
+        0x79A8FC39U, 0xB502FCA7U, 0x3B8DFB44U, 0xF727FBDAU, 0xFDE2F2C3U, 0x3148F25DU, 0xBFC7F5BEU, 0x736DF520U,
+        0xD6F6D6A7U, 0x1A5CD639U, 0x94D3D1DAU, 0x5879D144U, 0x52BCD85DU, 0x9E16D8C3U, 0x1099DF20U, 0xDC33DFBEU,
+        0x0513CD12U, 0xC9B9CD8CU, 0x4736CA6FU, 0x8B9CCAF1U, 0x8159C3E8U, 0x4DF3C376U, 0xC37CC495U, 0x0FD6C40BU,
+        0x7AA64737U, 0xB60C47A9U, 0x3883404AU, 0xF42940D4U, 0xFEEC49CDU, 0x32464953U, 0xBCC94EB0U, 0x70634E2EU,
+        0xA9435C82U, 0x65E95C1CU, 0xEB665BFFU, 0x27CC5B61U, 0x2D095278U, 0xE1A352E6U, 0x6F2C5505U, 0xA386559BU,
+        0x061D761CU, 0xCAB77682U, 0x44387161U, 0x889271FFU, 0x825778E6U, 0x4EFD7878U, 0xC0727F9BU, 0x0CD87F05U,
+        0xD5F86DA9U, 0x19526D37U, 0x97DD6AD4U, 0x5B776A4AU, 0x51B26353U, 0x9D1863CDU, 0x1397642EU, 0xDF3D64B0U,
+        0x83D02561U, 0x4F7A25FFU, 0xC1F5221CU, 0x0D5F2282U, 0x079A2B9BU, 0xCB302B05U, 0x45BF2CE6U, 0x89152C78U,
+        0x50353ED4U, 0x9C9F3E4AU, 0x121039A9U, 0xDEBA3937U, 0xD47F302EU, 0x18D530B0U, 0x965A3753U, 0x5AF037CDU,
+        0xFF6B144AU, 0x33C114D4U, 0xBD4E1337U, 0x71E413A9U, 0x7B211AB0U, 0xB78B1A2EU, 0x39041DCDU, 0xF5AE1D53U,
+        0x2C8E0FFFU, 0xE0240F61U, 0x6EAB0882U, 0xA201081CU, 0xA8C40105U, 0x646E019BU, 0xEAE10678U, 0x264B06E6U,
+    },
+#endif
+};
+
+#endif // SCI_CRC_TABLES_H
@@ -0,0 +1,91 @@
+#ifndef SCI_CYCLE_H
+#define SCI_CYCLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "uart_config.h"
+
+/**
+ * @brief 1 to read the Cortex-R PMU cycle counter, 0 for the host clock.
+ *
+ * Detected from the compiler's target profile, not from __arm__, so an ARM
+ * host build still takes the host clock. Define it to override.
+ */
+#ifndef SCI_CYCLE_PMU
+#if (defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'R')) || defined(__TI_ARM_V7R4__)
+#define SCI_CYCLE_PMU       (1)
+#else
+#define SCI_CYCLE_PMU       (0)
+#endif
+#endif
+
+/** @brief Cycle counter ticks per microsecond. */
+#define SCI_CYCLE_PER_US    (GCLK_FREQ / 1000000U)
+
+#if !SCI_CYCLE_PMU
+/**
+ * @brief Host stand-in for the PMU counter, CLOCK_MONOTONIC scaled to GCLK.
+ *
+ * Lives in sci_cycle.c so the POSIX feature macro it needs does not depend
+ * on the include order of the caller.
+ *
+ * @return Current counter value in GCLK cycles.
+ */
+uint32_t sciCycleHostNow(void);
+#endif
+
+/**
+ * @brief Enable the cycle counter.
+ *
+ * On target this starts the Cortex-R PMU cycle counter (PMCCNTR); on a host
+ * build the counter is derived from CLOCK_MONOTONIC and needs no setup.
+ */
+static inline void sciCycleInit(void) {
+#if SCI_CYCLE_PMU
+    uint32_t pmcr;
+    __asm__ volatile ("mrc p15, 0, %0, c9, c12, 0" : "=r" (pmcr));
+    // E: enable counters, C: reset the cycle counter
+    pmcr |= (1U << 0) | (1U << 2);
+    __asm__ volatile ("mcr p15, 0, %0, c9, c12, 0" : : "r" (pmcr));
+    __asm__ volatile ("mcr p15, 0, %0, c9, c12, 1" : : "r" (1U << 31));
+#endif
+}
+
+/**
+ * @brief Read the free-running cycle counter.
+ *
+ * Wraps every 2^32 cycles (about 26 s at 160 MHz).
+ *
+ * @return Current counter value in GCLK cycles.
+ */
+static inline uint32_t sciCycleNow(void) {
+#if SCI_CYCLE_PMU
+    uint32_t cycles;
+    __asm__ volatile ("mrc p15, 0, %0, c9, c13, 0" : "=r" (cycles));
+    return cycles;
+#else
+    return sciCycleHostNow();
+#endif
+}
+
+/**
+ * @brief Compute a deadline relative to now.
+ *
+ * @param[in] timeout_us Timeout in microseconds, at most half the counter period.
+ * @return Counter value at which the deadline expires.
+ */
+static inline uint32_t sciCycleDeadline(uint32_t timeout_us) {
+    return sciCycleNow() + (timeout_us * SCI_CYCLE_PER_US);
+}
+
+/**
+ * @brief Check whether a deadline has passed, wrap-safe.
+ *
+ * @param[in] deadline Value returned by sciCycleDeadline().
+ * @return true if the deadline has passed, false otherwise.
+ */
+static inline bool sciCycleExpired(uint32_t deadline) {
+    return ((int32_t)(sciCycleNow() - deadline) >= 0);
+}
+
+#endif // SCI_CYCLE_H
@@ -0,0 +1,142 @@
+#include <string.h>
+#include "sci_demux.h"
+#include "sci_ring.h"
+#include "sci_stats.h"
+
+/* Sync and type, then the length field. */
+static uint32_t sci_demux_header_len(const sci_demux_t* demux){
+    return (2U + demux->config.length_size);
+}
+
+static void sci_demux_reset(sci_demux_t* demux){
+    demux->header_length = 0U;
+    demux->payload_length = 0U;
+    demux->assembled = 0U;
+}
+
+static uint32_t sci_demux_deliver(sci_demux_t* demux, const uint8_t* payload){
+    uint8_t  type = demux->header[1];
+    uint32_t length = demux->payload_length;
+
+    // Reset first, so the state is ready for the next packet whatever the handler does
+    sci_demux_reset(demux);
+    if ((type >= demux->num_of_types) || (demux->handlers[type] == NULL)){
+        demux->unrouted++;
+        return (0U);
+    }
+    demux->handlers[type](demux->context, type, payload, length);
+    demux->delivered++;
+    return (1U);
+}
+
+/* Header complete: take the length, drop what cannot fit and deliver empty payloads at once. */
+static uint32_t sci_demux_header_done(sci_demux_t* demux){
+    const uint8_t* field = &demux->header[2];
+
+    if (demux->config.length_size == 1U){
+        demux->payload_length = field[0];
+    } else if (demux->config.big_endian){
+        demux->payload_length = ((uint32_t)field[0] << 8) | field[1];
+    } else {
+        demux->payload_length = ((uint32_t)field[1] << 8) | field[0];
+    }
+
+    if (demux->payload_length > demux->capacity){
+        // Most likely a payload byte taken for sync; hunting resumes after the bad header
+        demux->oversized++;
+        sci_demux_reset(demux);
+        return (0U);
+    }
+    return (demux->payload_length == 0U) ? sci_demux_deliver(demux, demux->buffer) : 0U;
+}
+
+bool sciDemuxInit(sci_demux_t* demux, const sci_demux_config_t* config, const sci_demux_handler_t* handlers, uint32_t num_of_types,
+                  uint8_t* buffer, uint32_t capacity, void* context){
+    if ((demux == NULL) || (config == NULL) || (handlers == NULL) || (num_of_types == 0U) || (num_of_types > 256U) ||
+        (buffer == NULL) || (capacity == 0U) || ((config->length_size != 1U) && (config->length_size != 2U))){
+        return (false);
+    }
+
+    demux->config = *config;
+    demux->handlers = handlers;
+    demux->num_of_types = num_of_types;
+    demux->context = context;
+    demux->buffer = buffer;
+    demux->capacity = capacity;
+    demux->delivered = 0U;
+    demux->unrouted = 0U;
+    demux->oversized = 0U;
+    demux->skipped = 0U;
+    sci_demux_reset(demux);
+    return (true);
+}
+
+uint32_t sciDemuxFeed(sci_demux_t* demux, const uint8_t* data, uint32_t length){
+    uint32_t delivered = 0U;
+    uint32_t pos = 0U;
+
+    if ((demux == NULL) || (data == NULL)){
+        return (0U);
+    }
+
+    while (pos < length){
+        uint32_t available = length - pos;
+
+        if (demux->header_length == 0U){
+            const uint8_t* sync = memchr(&data[pos], demux->config.sync, available);
+            uint32_t       skip = (sync == NULL) ? available : (uint32_t)(sync - &data[pos]);
+
+            demux->skipped += skip;
+            pos += skip;
+            if (sync != NULL){
+                demux->header[demux->header_length++] = data[pos++];
+            }
+            continue;
+        }
+
+        if (demux->header_length < sci_demux_header_len(demux)){
+            demux->header[demux->header_length++] = data[pos++];
+            if (demux->header_length == sci_demux_header_len(demux)){
+                delivered += sci_demux_header_done(demux);
+            }
+            continue;
+        }
+
+        uint32_t need = demux->payload_length - demux->assembled;
+
+        // Whole payload in this chunk: hand it over in place
+        if ((demux->assembled == 0U) && (available >= need)){
+            pos += need;
+            delivered += sci_demux_deliver(demux, &data[pos - need]);
+            continue;
+        }
+
+        uint32_t chunk = (available < need) ? available : need;
+        memcpy(&demux->buffer[demux->assembled], &data[pos], chunk);
+        demux->assembled += chunk;
+        pos += chunk;
+        if (demux->assembled == demux->payload_length){
+            delivered += sci_demux_deliver(demux, demux->buffer);
+        }
+    }
+    return (delivered);
+}
+
+uint32_t sciDemuxPoll(sci_demux_t* demux, volatile tms570_reg* sci_lin_reg){
+    sci_ring_t*    ring = sciRxRingGet(sci_lin_reg);
+    uint32_t       delivered = 0U;
+    const uint8_t* region;
+    uint32_t       region_length;
+
+    if ((demux == NULL) || (ring == NULL)){
+        return (0U);
+    }
+
+    // Until the ring is empty; a packet across the wrap is reassembled like any split packet
+    while (sciRingPeek(ring, &region, &region_length)){
+        delivered += sciDemuxFeed(demux, region, region_length);
+        (void)sciRxRingConsume(sci_lin_reg, region_length);
+    }
+    sciStatsAdd(sci_lin_reg, SCI_STATS_RX_FRAMES, delivered);
+    return (delivered);
+}
@@ -0,0 +1,94 @@
+#ifndef SCI_DEMUX_H
+#define SCI_DEMUX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Longest header: sync, type and a two-byte length. */
+#define SCI_DEMUX_MAX_HEADER_LEN    (4U)
+
+/**
+ * @brief Packet handler of one type.
+ *
+ * @param[in] context Context given to sciDemuxInit().
+ * @param[in] type Packet type, the index of the handler in the table.
+ * @param[in] payload Payload, valid until the handler returns; points into the fed bytes unless the packet was split across chunks.
+ * @param[in] length Payload length in bytes, may be 0.
+ */
+typedef void (*sci_demux_handler_t)(void* context, uint8_t type, const uint8_t* payload, uint32_t length);
+
+/**
+ * @struct sci_demux_config_s
+ * @brief Packet header layout: sync byte, type byte, length field, payload.
+ */
+typedef struct sci_demux_config_s {
+    uint8_t sync;           /** First byte of every packet */
+    uint8_t length_size;    /** Bytes of the length field, 1 or 2 */
+    bool    big_endian;     /** Byte order of a two-byte length field */
+} sci_demux_config_t;
+
+/**
+ * @struct sci_demux_s
+ * @brief Streaming demultiplexer state, constant size.
+ */
+typedef struct sci_demux_s {
+    sci_demux_config_t         config;                              /** Header layout */
+    const sci_demux_handler_t* handlers;                            /** Dense table indexed by type, NULL entries drop the type */
+    uint32_t                   num_of_types;                        /** Entries in handlers */
+    void*                      context;                             /** Passed back to the handlers */
+    uint8_t*                   buffer;                              /** Reassembly of payloads split across chunks */
+    uint32_t                   capacity;                            /** Size of buffer in bytes, the longest payload accepted */
+    uint8_t                    header[SCI_DEMUX_MAX_HEADER_LEN];    /** Header bytes of the current packet */
+    uint32_t                   header_length;                       /** Header bytes seen so far, 0 while hunting for sync */
+    uint32_t                   payload_length;                      /** Payload length of the current packet */
+    uint32_t                   assembled;                           /** Payload bytes copied to buffer so far */
+    uint32_t                   delivered;                           /** Packets handed to a handler */
+    uint32_t                   unrouted;                            /** Packets of a type without a handler */
+    uint32_t                   oversized;                           /** Headers announcing more than capacity, dropped */
+    uint32_t                   skipped;                             /** Bytes discarded while hunting for sync */
+} sci_demux_t;
+
+/**
+ * @brief Initialize a demultiplexer.
+ *
+ * @param[out] demux Demultiplexer to initialize.
+ * @param[in] config Header layout. @see sci_demux_config_t
+ * @param[in] handlers Handler table indexed by packet type, kept by reference.
+ * @param[in] num_of_types Entries in handlers, at most 256.
+ * @param[in] buffer Reassembly buffer, as large as the longest payload.
+ * @param[in] capacity Size of buffer in bytes.
+ * @param[in] context Passed back to the handlers, may be NULL.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool sciDemuxInit(sci_demux_t* demux, const sci_demux_config_t* config, const sci_demux_handler_t* handlers, uint32_t num_of_types,
+                  uint8_t* buffer, uint32_t capacity, void* context);
+
+/**
+ * @brief Feed received bytes to a demultiplexer.
+ *
+ * Chunks may split packets anywhere. A payload that lies within one chunk
+ * is handed over in place; only a payload split across chunks is copied to
+ * the reassembly buffer. Touches no hardware, so recorded streams can be
+ * replayed through it on a host.
+ *
+ * @param[in] demux Demultiplexer to feed.
+ * @param[in] data Received bytes, must stay untouched until the call returns.
+ * @param[in] length Number of received bytes.
+ * @return Number of packets handed to a handler.
+ */
+uint32_t sciDemuxFeed(sci_demux_t* demux, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Feed everything waiting on the RX ring of an instance.
+ *
+ * Payloads are handed over straight from the ring storage, which is
+ * released only after the handlers have returned.
+ *
+ * @param[in] demux Demultiplexer to feed.
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base, with an RX ring attached.
+ * @return Number of packets handed to a handler.
+ */
+uint32_t sciDemuxPoll(sci_demux_t* demux, volatile tms570_reg* sci_lin_reg);
+
+#endif // SCI_DEMUX_H
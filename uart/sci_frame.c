@@ -0,0 +1,247 @@
+#include <string.h>
+#include "sci_frame.h"
+#include "sci_lin_regs.h"
+#include "sci_stats.h"
+
+/* Longest COBS block: code 0xFF followed by 254 non-zero bytes. */
+#define SCI_FRAME_COBS_MAX_RUN  (254U)
+
+#define SCI_FRAME_ONES          (0x01010101U)
+#define SCI_FRAME_HIGHS         (0x80808080U)
+
+/* Non-zero if any byte of word is zero. */
+static inline uint32_t sci_frame_has_zero(uint32_t word){
+    return ((word - SCI_FRAME_ONES) & ~word & SCI_FRAME_HIGHS);
+}
+
+/* Index of the first byte equal to a or b, or length; four bytes per step once aligned. */
+static uint32_t sci_frame_find(const uint8_t* data, uint32_t length, uint8_t a, uint8_t b){
+    uint32_t pattern_a = a * SCI_FRAME_ONES;
+    uint32_t pattern_b = b * SCI_FRAME_ONES;
+    uint32_t i = 0U;
+
+    while ((i < length) && (((uintptr_t)&data[i] & 3U) != 0U)){
+        if ((data[i] == a) || (data[i] == b)){
+            return (i);
+        }
+        i++;
+    }
+    while ((i + 4U) <= length){
+        uint32_t word;
+        memcpy(&word, &data[i], sizeof(word));
+        if ((sci_frame_has_zero(word ^ pattern_a) | sci_frame_has_zero(word ^ pattern_b)) != 0U){
+            break;
+        }
+        i += 4U;
+    }
+    while ((i < length) && (data[i] != a) && (data[i] != b)){
+        i++;
+    }
+    return (i);
+}
+
+static void sci_frame_put(sci_ring_t* ring, uint8_t byte){
+    (void)sciRingWrite(ring, &byte, 1U);
+}
+
+static void sci_frame_encode_cobs(sci_ring_t* ring, const uint8_t* data, uint32_t length){
+    uint32_t pos = 0U;
+
+    for (;;){
+        uint32_t limit = ((length - pos) < SCI_FRAME_COBS_MAX_RUN) ? (length - pos) : SCI_FRAME_COBS_MAX_RUN;
+        uint32_t run = sci_frame_find(&data[pos], limit, 0U, 0U);
+
+        sci_frame_put(ring, (uint8_t)(run + 1U));
+        (void)sciRingWrite(ring, &data[pos], run);
+        pos += run;
+
+        // A full block carries no implied zero, anything else consumes the zero that ended it
+        if ((run != SCI_FRAME_COBS_MAX_RUN) && (pos < length)){
+            pos++;
+        } else if (pos == length){
+            break;
+        }
+    }
+    sci_frame_put(ring, SCI_FRAME_COBS_DELIMITER);
+}
+
+static void sci_frame_encode_slip(sci_ring_t* ring, const uint8_t* data, uint32_t length){
+    uint32_t pos = 0U;
+
+    // A leading END flushes any line noise at the receiver
+    sci_frame_put(ring, SCI_FRAME_SLIP_END);
+    while (pos < length){
+        uint32_t run = sci_frame_find(&data[pos], length - pos, SCI_FRAME_SLIP_END, SCI_FRAME_SLIP_ESC);
+        (void)sciRingWrite(ring, &data[pos], run);
+        pos += run;
+        if (pos < length){
+            sci_frame_put(ring, SCI_FRAME_SLIP_ESC);
+            sci_frame_put(ring, (data[pos] == SCI_FRAME_SLIP_END) ? SCI_FRAME_SLIP_ESC_END : SCI_FRAME_SLIP_ESC_ESC);
+            pos++;
+        }
+    }
+    sci_frame_put(ring, SCI_FRAME_SLIP_END);
+}
+
+uint32_t sciFrameMaxEncodedLength(sci_frame_type_t type, uint32_t length){
+    if (type == SCI_FRAME_SLIP){
+        return ((2U * length) + 2U);
+    }
+    return (length + (length / SCI_FRAME_COBS_MAX_RUN) + 2U);
+}
+
+bool sciFrameEncode(sci_ring_t* ring, sci_frame_type_t type, const uint8_t* data, uint32_t length){
+    // An empty frame would look like back-to-back delimiters, which the decoder skips
+    if ((ring == NULL) || (data == NULL) || (length == 0U) || !IS_ENUM_IN_RANGE(type, NUM_OF_SCI_FRAME)){
+        return (false);
+    }
+    if (sciRingFree(ring) < sciFrameMaxEncodedLength(type, length)){
+        return (false);
+    }
+
+    if (type == SCI_FRAME_COBS){
+        sci_frame_encode_cobs(ring, data, length);
+    } else {
+        sci_frame_encode_slip(ring, data, length);
+    }
+    return (true);
+}
+
+bool sciFrameSend(volatile tms570_reg* sci_lin_reg, sci_frame_type_t type, const uint8_t* data, uint32_t length){
+    if (!sciFrameEncode(sciTxRingGet(sci_lin_reg), type, data, length)){
+        return (false);
+    }
+    sciStatsAdd(sci_lin_reg, SCI_STATS_TX_FRAMES, 1U);
+    return sciTxRingKick(sci_lin_reg);
+}
+
+bool sciFrameDecoderInit(sci_frame_decoder_t* decoder, sci_frame_type_t type, uint8_t* buffer, uint32_t capacity,
+                         sci_frame_callback_t callback, void* context){
+    if ((decoder == NULL) || (buffer == NULL) || (capacity == 0U) || (callback == NULL) || !IS_ENUM_IN_RANGE(type, NUM_OF_SCI_FRAME)){
+        return (false);
+    }
+
+    decoder->type = type;
+    decoder->buffer = buffer;
+    decoder->capacity = capacity;
+    decoder->length = 0U;
+    decoder->remaining = 0U;
+    decoder->pending_zero = false;
+    decoder->escape = false;
+    decoder->error = false;
+    decoder->dropped = 0U;
+    decoder->callback = callback;
+    decoder->context = context;
+    return (true);
+}
+
+static void sci_frame_append(sci_frame_decoder_t* decoder, const uint8_t* data, uint32_t length){
+    if (decoder->error){
+        return;
+    }
+    if (length > (decoder->capacity - decoder->length)){
+        decoder->error = true;
+        return;
+    }
+    memcpy(&decoder->buffer[decoder->length], data, length);
+    decoder->length += length;
+}
+
+/* Delimiter seen: deliver or drop the frame and start over. Back-to-back delimiters are not frames. */
+static uint32_t sci_frame_end(sci_frame_decoder_t* decoder){
+    uint32_t delivered = 0U;
+    bool truncated = (decoder->remaining != 0U) || decoder->escape;
+
+    if (decoder->error || truncated){
+        decoder->dropped++;
+    } else if (decoder->length != 0U){
+        decoder->callback(decoder->context, decoder->buffer, decoder->length);
+        delivered = 1U;
+    }
+
+    decoder->length = 0U;
+    decoder->remaining = 0U;
+    decoder->pending_zero = false;
+    decoder->escape = false;
+    decoder->error = false;
+    return (delivered);
+}
+
+static uint32_t sci_frame_decode_cobs(sci_frame_decoder_t* decoder, const uint8_t* data, uint32_t length){
+    uint32_t delivered = 0U;
+    uint32_t pos = 0U;
+
+    while (pos < length){
+        if (decoder->remaining == 0U){
+            uint8_t code = data[pos++];
+            if (code == SCI_FRAME_COBS_DELIMITER){
+                delivered += sci_frame_end(decoder);
+                continue;
+            }
+            if (decoder->pending_zero){
+                static const uint8_t s_zero = 0U;
+                sci_frame_append(decoder, &s_zero, 1U);
+            }
+            decoder->remaining = code - 1U;
+            decoder->pending_zero = (code != (SCI_FRAME_COBS_MAX_RUN + 1U));
+            continue;
+        }
+
+        uint32_t limit = ((length - pos) < decoder->remaining) ? (length - pos) : decoder->remaining;
+        uint32_t run = sci_frame_find(&data[pos], limit, 0U, 0U);
+        sci_frame_append(decoder, &data[pos], run);
+        pos += run;
+        decoder->remaining -= run;
+        if (run < limit){
+            // Delimiter inside a block: the frame was cut short, resynchronise on it
+            decoder->error = true;
+            decoder->remaining = 0U;
+        }
+    }
+    return (delivered);
+}
+
+static uint32_t sci_frame_decode_slip(sci_frame_decoder_t* decoder, const uint8_t* data, uint32_t length){
+    uint32_t delivered = 0U;
+    uint32_t pos = 0U;
+
+    while (pos < length){
+        if (decoder->escape){
+            uint8_t byte = data[pos];
+            decoder->escape = false;
+            if (byte == SCI_FRAME_SLIP_END){
+                decoder->error = true;
+                delivered += sci_frame_end(decoder);
+            } else {
+                uint8_t decoded = (byte == SCI_FRAME_SLIP_ESC_END) ? SCI_FRAME_SLIP_END : SCI_FRAME_SLIP_ESC;
+                decoder->error = decoder->error || ((byte != SCI_FRAME_SLIP_ESC_END) && (byte != SCI_FRAME_SLIP_ESC_ESC));
+                sci_frame_append(decoder, &decoded, 1U);
+            }
+            pos++;
+            continue;
+        }
+
+        uint32_t run = sci_frame_find(&data[pos], length - pos, SCI_FRAME_SLIP_END, SCI_FRAME_SLIP_ESC);
+        sci_frame_append(decoder, &data[pos], run);
+        pos += run;
+        if (pos < length){
+            if (data[pos] == SCI_FRAME_SLIP_END){
+                delivered += sci_frame_end(decoder);
+            } else {
+                decoder->escape = true;
+            }
+            pos++;
+        }
+    }
+    return (delivered);
+}
+
+uint32_t sciFrameDecode(sci_frame_decoder_t* decoder, const uint8_t* data, uint32_t length){
+    if ((decoder == NULL) || (data == NULL)){
+        return (0U);
+    }
+    if (decoder->type == SCI_FRAME_SLIP){
+        return sci_frame_decode_slip(decoder, data, length);
+    }
+    return sci_frame_decode_cobs(decoder, data, length);
+}
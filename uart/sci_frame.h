@@ -0,0 +1,116 @@
+#ifndef SCI_FRAME_H
+#define SCI_FRAME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+#include "sci_ring.h"
+
+/** @brief Frame delimiter of COBS frames. */
+#define SCI_FRAME_COBS_DELIMITER    (0x00U)
+
+/** @brief SLIP special bytes (RFC 1055). */
+#define SCI_FRAME_SLIP_END          (0xC0U)
+#define SCI_FRAME_SLIP_ESC          (0xDBU)
+#define SCI_FRAME_SLIP_ESC_END      (0xDCU)
+#define SCI_FRAME_SLIP_ESC_ESC      (0xDDU)
+
+/**
+ * @enum sci_frame_type_e
+ * @brief Framing schemes.
+ */
+typedef enum sci_frame_type_e {
+    SCI_FRAME_COBS = 0,     /** Consistent overhead byte stuffing, 0x00 delimited */
+    SCI_FRAME_SLIP,         /** Serial line IP, 0xC0 delimited */
+    NUM_OF_SCI_FRAME        /** Number of framing schemes */
+} sci_frame_type_t;
+
+/**
+ * @brief Complete frame callback.
+ *
+ * @param[in] context Context given to sciFrameDecoderInit().
+ * @param[in] data Decoded payload, valid until the callback returns.
+ * @param[in] length Payload length in bytes.
+ */
+typedef void (*sci_frame_callback_t)(void* context, const uint8_t* data, uint32_t length);
+
+/**
+ * @struct sci_frame_decoder_s
+ * @brief Streaming frame decoder state, constant size.
+ */
+typedef struct sci_frame_decoder_s {
+    sci_frame_type_t     type;          /** Framing scheme */
+    uint8_t*             buffer;        /** Payload buffer */
+    uint32_t             capacity;      /** Size of buffer in bytes */
+    uint32_t             length;        /** Payload bytes decoded so far */
+    uint32_t             remaining;     /** COBS: data bytes left in the current block */
+    bool                 pending_zero;  /** COBS: the current block ends in an implied zero */
+    bool                 escape;        /** SLIP: the previous byte was ESC */
+    bool                 error;         /** The current frame is dropped up to the next delimiter */
+    uint32_t             dropped;       /** Frames dropped for overflow or bad encoding */
+    sci_frame_callback_t callback;      /** Complete frame callback */
+    void*                context;       /** Passed back to callback */
+} sci_frame_decoder_t;
+
+/**
+ * @brief Get the worst-case encoded size of a payload, delimiters included.
+ *
+ * @param[in] type Framing scheme. @see sci_frame_type_t
+ * @param[in] length Payload length in bytes.
+ * @return Encoded size in bytes.
+ */
+uint32_t sciFrameMaxEncodedLength(sci_frame_type_t type, uint32_t length);
+
+/**
+ * @brief Encode one frame straight into a ring.
+ *
+ * Runs of bytes that need no stuffing are copied in one go; the whole frame
+ * is written or nothing is.
+ *
+ * @param[in] ring Ring to write, e.g. sciTxRingGet().
+ * @param[in] type Framing scheme. @see sci_frame_type_t
+ * @param[in] data Payload.
+ * @param[in] length Payload length in bytes, at least 1; the decoder never delivers an empty frame.
+ * @return true if the frame was written, false for an empty payload or if the ring has no room for the worst case.
+ */
+bool sciFrameEncode(sci_ring_t* ring, sci_frame_type_t type, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Encode one frame into the TX ring of an instance and start transmission.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base, with a TX ring attached.
+ * @param[in] type Framing scheme. @see sci_frame_type_t
+ * @param[in] data Payload.
+ * @param[in] length Payload length in bytes, at least 1.
+ * @return true if the frame was queued, false otherwise.
+ */
+bool sciFrameSend(volatile tms570_reg* sci_lin_reg, sci_frame_type_t type, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Initialize a streaming decoder.
+ *
+ * @param[out] decoder Decoder to initialize.
+ * @param[in] type Framing scheme. @see sci_frame_type_t
+ * @param[in] buffer Payload buffer, as large as the longest frame.
+ * @param[in] capacity Size of buffer in bytes.
+ * @param[in] callback Complete frame callback.
+ * @param[in] context Passed back to callback, may be NULL.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool sciFrameDecoderInit(sci_frame_decoder_t* decoder, sci_frame_type_t type, uint8_t* buffer, uint32_t capacity,
+                         sci_frame_callback_t callback, void* context);
+
+/**
+ * @brief Feed received bytes to a decoder.
+ *
+ * Chunks may split frames anywhere; complete frames are delivered to the
+ * callback as their delimiter arrives.
+ *
+ * @param[in] decoder Decoder to feed.
+ * @param[in] data Received bytes.
+ * @param[in] length Number of received bytes.
+ * @return Number of frames delivered.
+ */
+uint32_t sciFrameDecode(sci_frame_decoder_t* decoder, const uint8_t* data, uint32_t length);
+
+#endif // SCI_FRAME_H
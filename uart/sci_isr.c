@@ -0,0 +1,142 @@
+#include "sci_isr.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_stats.h"
+#include "sci_cycle.h"
+#include "sci_trace.h"
+
+static volatile struct g_sciIsr
+{
+    sci_isr_handler_t handler[SCI_ISR_NUM_OF_VECTORS];   /* Indexed by vector offset */
+} g_sciIsr_t[SCI_LIN_NUM_OF_INSTANCES];
+
+/* Vector register of each interrupt line, indexed by sci_int_line_t. */
+static const uint32_t s_sciIsrVectorReg[NUM_OF_SCI_INT_LINE] = {
+    TMS570_SCI_INT_VECT_0,
+    TMS570_SCI_INT_VECT_1,
+};
+
+static void sci_isr_ignore(volatile tms570_reg* sci_lin_reg, uint8_t vector){
+    (void)sci_lin_reg;
+    (void)vector;
+}
+
+static void sci_isr_tx(volatile tms570_reg* sci_lin_reg, uint8_t vector){
+    (void)vector;
+    sciTxInterruptHandler(sci_lin_reg);
+}
+
+static void sci_isr_rx(volatile tms570_reg* sci_lin_reg, uint8_t vector){
+    (void)vector;
+    sciRxInterruptHandler(sci_lin_reg);
+}
+
+/* TX and RX flags survive the vector read, their defaults must clear them or the dispatch loop never ends. */
+static sci_isr_handler_t sci_isr_default_handler(uint8_t vector){
+    return (vector == SCI_INT_VECTOR_TX) ? sci_isr_tx :
+           ((vector == SCI_INT_VECTOR_RX) ? sci_isr_rx : sci_isr_ignore);
+}
+
+bool sciIsrInit(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    for (uint32_t vector = 0U; vector < SCI_ISR_NUM_OF_VECTORS; vector++){
+        g_sciIsr_t[index].handler[vector] = sci_isr_default_handler((uint8_t)vector);
+    }
+    return (true);
+}
+
+bool sciIsrRegisterHandler(volatile tms570_reg* sci_lin_reg, uint8_t vector, sci_isr_handler_t handler){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (vector == SCI_INT_VECTOR_NONE) || (vector >= SCI_ISR_NUM_OF_VECTORS)){
+        return (false);
+    }
+
+    g_sciIsr_t[index].handler[vector] = (handler != NULL) ? handler : sci_isr_default_handler(vector);
+    return (true);
+}
+
+uint32_t sciIsrDispatch(volatile tms570_reg* sci_lin_reg, sci_int_line_t line){
+    uint32_t start = sciCycleNow();
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+    uint32_t serviced = 0U;
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(line, NUM_OF_SCI_INT_LINE)){
+        return (serviced);
+    }
+
+    SCI_TRACE_ENTER((line == SCI_INT_LINE_0) ? SCI_TRACE_POINT_ISR_LINE_0 : SCI_TRACE_POINT_ISR_LINE_1, index);
+
+    // Each read returns the highest priority pending source and clears its flag
+    volatile tms570_reg* vector_reg = &sci_lin_reg[s_sciIsrVectorReg[line]];
+    uint8_t vector = (uint8_t)GET_BITS(*vector_reg, TMS570_SCI_INT_VECT_0_INT_VECT_0_OFFSET, TMS570_SCI_INT_VECT_0_BIT_LEN);
+
+    while (vector != SCI_INT_VECTOR_NONE){
+        // Modules register handlers without sciIsrInit(), every other entry may still be empty
+        sci_isr_handler_t handler = g_sciIsr_t[index].handler[vector];
+        if (handler == NULL){
+            handler = sci_isr_default_handler(vector);
+        }
+        handler(sci_lin_reg, vector);
+        sciStatsVector(sci_lin_reg, vector);
+        serviced++;
+        vector = (uint8_t)GET_BITS(*vector_reg, TMS570_SCI_INT_VECT_0_INT_VECT_0_OFFSET, TMS570_SCI_INT_VECT_0_BIT_LEN);
+    }
+    sciStatsIsr(sci_lin_reg, line, sciCycleNow() - start);
+    SCI_TRACE_EXIT((line == SCI_INT_LINE_0) ? SCI_TRACE_POINT_ISR_LINE_0 : SCI_TRACE_POINT_ISR_LINE_1, index);
+    return (serviced);
+}
+
+bool sciIsrApplyLevelPolicy(const sci_int_level_policy_t* policy){
+    bool result = true;
+
+    if (policy == NULL){
+        return (false);
+    }
+
+    for (uint32_t index = 0U; index < SCI_LIN_NUM_OF_INSTANCES; index++){
+        if (!policy->apply[index]){
+            continue;
+        }
+
+        volatile tms570_reg* base = sciGetInstanceBase(index);
+        uint32_t line0 = policy->line0_sources[index] & TMS570_SCI_SET_INT_LVL_MASK;
+        uint32_t line1 = (~policy->line0_sources[index]) & TMS570_SCI_SET_INT_LVL_MASK;
+
+        tms570_write_register(&base[TMS570_SCI_CLEAR_INT_LVL], line0);
+        tms570_write_register(&base[TMS570_SCI_SET_INT_LVL], line1);
+        if ((base[TMS570_SCI_SET_INT_LVL] & TMS570_SCI_SET_INT_LVL_MASK) != line1){
+            result = false;
+        }
+    }
+    return (result);
+}
+
+void sciLin1HighLevelInterrupt(void){
+    (void)sciIsrDispatch(TMS570_SCI_LIN_1_BASE_ADDR, SCI_INT_LINE_0);
+}
+
+void sciLin1LowLevelInterrupt(void){
+    (void)sciIsrDispatch(TMS570_SCI_LIN_1_BASE_ADDR, SCI_INT_LINE_1);
+}
+
+void sciLin2HighLevelInterrupt(void){
+    (void)sciIsrDispatch(TMS570_SCI_LIN_2_BASE_ADDR, SCI_INT_LINE_0);
+}
+
+void sciLin2LowLevelInterrupt(void){
+    (void)sciIsrDispatch(TMS570_SCI_LIN_2_BASE_ADDR, SCI_INT_LINE_1);
+}
+
+void sciLin3HighLevelInterrupt(void){
+    (void)sciIsrDispatch(TMS570_SCI_LIN_3_BASE_ADDR, SCI_INT_LINE_0);
+}
+
+void sciLin3LowLevelInterrupt(void){
+    (void)sciIsrDispatch(TMS570_SCI_LIN_3_BASE_ADDR, SCI_INT_LINE_1);
+}
@@ -0,0 +1,142 @@
+#ifndef SCI_ISR_H
+#define SCI_ISR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+/** @brief Entries in the per-instance handler table, one per 5-bit vector offset. */
+#define SCI_ISR_NUM_OF_VECTORS  (32U)
+
+/** @brief Source masks for sci_int_level_policy_t, bit positions as in SET_INT_LVL. */
+#define SCI_INT_SOURCE_BRKDT        MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_BRKDT_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_BRKDT_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_WAKEUP       MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_WAKEUP_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_WAKEUP_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_TIMEOUT      MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_TIMEOUT_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_TIMEOUT_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_TOAWUS       MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_TOAWUS_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_TOAWUS_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_TOA3WUS      MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_TOA3WUS_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_TOA3WUS_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_TX           MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_TX_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_TX_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_RX           MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_RX_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_RX_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_ID           MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_ID_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_ID_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_RX_DMA_ALL   MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_RX_DMA_ALL_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_RX_DMA_ALL_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_PE           MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_PE_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_PE_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_OE           MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_OE_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_OE_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_FE           MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_FE_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_FE_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_NRE          MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_NRE_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_NRE_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_ISFE         MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_ISFE_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_ISFE_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_CE           MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_CE_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_CE_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_PBE          MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_PBE_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_PBE_INT_LVL_BIT_LEN)
+#define SCI_INT_SOURCE_BE           MAKE_MASK(TMS570_SCI_SET_INT_LVL_SET_BE_INT_LVL_OFFSET, TMS570_SCI_SET_INT_LVL_SET_BE_INT_LVL_BIT_LEN)
+
+/** @brief Default latency-critical sources: data and header events on INT0, errors, wakeup and timeouts on INT1. */
+#define SCI_INT_SOURCE_LATENCY_CRITICAL (SCI_INT_SOURCE_RX | SCI_INT_SOURCE_TX | SCI_INT_SOURCE_ID)
+
+/**
+ * @enum sci_int_line_e
+ * @brief Interrupt lines of an SCI/LIN instance.
+ */
+typedef enum sci_int_line_e {
+    SCI_INT_LINE_0 = 0,         /** INT0, high level, vector read from INT_VECT_0 */
+    SCI_INT_LINE_1,             /** INT1, low level, vector read from INT_VECT_1 */
+    NUM_OF_SCI_INT_LINE         /** Number of interrupt lines */
+} sci_int_line_t;
+
+/**
+ * @enum sci_int_vector_e
+ * @brief Interrupt vector offsets reported in INT_VECT_0/INT_VECT_1.
+ */
+typedef enum sci_int_vector_e {
+    SCI_INT_VECTOR_NONE = 0,    /** No interrupt pending */
+    SCI_INT_VECTOR_WAKEUP,      /** Wakeup */
+    SCI_INT_VECTOR_ISFE,        /** Inconsistent synch field error */
+    SCI_INT_VECTOR_PE,          /** Parity error */
+    SCI_INT_VECTOR_ID,          /** ID received */
+    SCI_INT_VECTOR_PBE,         /** Physical bus error */
+    SCI_INT_VECTOR_FE,          /** Framing error */
+    SCI_INT_VECTOR_BRKDT,       /** Break detect */
+    SCI_INT_VECTOR_CE,          /** Checksum error */
+    SCI_INT_VECTOR_OE,          /** Overrun error */
+    SCI_INT_VECTOR_BE,          /** Bit error */
+    SCI_INT_VECTOR_RX,          /** Receive, cleared by reading RD */
+    SCI_INT_VECTOR_TX,          /** Transmit, cleared by writing TD or disabling the interrupt */
+    SCI_INT_VECTOR_NRE,         /** No-response error */
+    SCI_INT_VECTOR_TOAWUS,      /** Timeout after wakeup signal */
+    SCI_INT_VECTOR_TOA3WUS,     /** Timeout after three wakeup signals */
+    SCI_INT_VECTOR_TIMEOUT,     /** Bus idle timeout */
+    NUM_OF_SCI_INT_VECTOR       /** Number of defined vector offsets */
+} sci_int_vector_t;
+
+/**
+ * @struct sci_int_level_policy_s
+ * @brief Interrupt line assignment of all SCI/LIN instances.
+ */
+typedef struct sci_int_level_policy_s {
+    bool     apply[SCI_LIN_NUM_OF_INSTANCES];           /** false leaves the levels of the instance untouched */
+    uint32_t line0_sources[SCI_LIN_NUM_OF_INSTANCES];   /** SCI_INT_SOURCE_* mask routed to INT0, all others go to INT1 */
+} sci_int_level_policy_t;
+
+/**
+ * @brief Interrupt source handler.
+ *
+ * Runs in interrupt context. Except for RX and TX, the flag has already been
+ * cleared by the vector read.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] vector Vector offset being serviced. @see sci_int_vector_t
+ */
+typedef void (*sci_isr_handler_t)(volatile tms570_reg* sci_lin_reg, uint8_t vector);
+
+/**
+ * @brief Initialize the handler table of an SCI/LIN instance.
+ *
+ * TX and RX are routed to sciTxInterruptHandler() and sciRxInterruptHandler(),
+ * every other vector is ignored. Optional: the dispatcher falls back to these
+ * defaults for any vector without a handler.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool sciIsrInit(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Install the handler of one vector offset.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] vector Vector offset (1 - 31). @see sci_int_vector_t
+ * @param[in] handler Handler to install, NULL restores the default.
+ * @return true if installed, false otherwise.
+ */
+bool sciIsrRegisterHandler(volatile tms570_reg* sci_lin_reg, uint8_t vector, sci_isr_handler_t handler);
+
+/**
+ * @brief Service every pending source of one interrupt line.
+ *
+ * Reads the vector register of the line and calls the matching handler until
+ * the vector reads zero.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] line Interrupt line being serviced. @see sci_int_line_t
+ * @return Number of sources serviced.
+ */
+uint32_t sciIsrDispatch(volatile tms570_reg* sci_lin_reg, sci_int_line_t line);
+
+/**
+ * @brief Route interrupt sources of every SCI/LIN instance to INT0 or INT1.
+ *
+ * Each instance is programmed with one SET_INT_LVL and one CLEAR_INT_LVL
+ * write, without read-modify-write, and the result is read back.
+ *
+ * @param[in] policy Line assignment to apply. @see sci_int_level_policy_t
+ * @return true if every applied instance reads back the requested levels, false otherwise.
+ */
+bool sciIsrApplyLevelPolicy(const sci_int_level_policy_t* policy);
+
+/** @brief VIM entries, one per SCI/LIN instance and interrupt line. */
+void sciLin1HighLevelInterrupt(void);
+void sciLin1LowLevelInterrupt(void);
+void sciLin2HighLevelInterrupt(void);
+void sciLin2LowLevelInterrupt(void);
+void sciLin3HighLevelInterrupt(void);
+void sciLin3LowLevelInterrupt(void);
+
+#endif // SCI_ISR_H
@@ -0,0 +1,179 @@
+#include "sci_lane.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_cycle.h"
+#include "sci_stats.h"
+
+/** @brief Lane value meaning no frame is in the transmitter. */
+#define SCI_LANE_NONE           (NUM_OF_SCI_LANE)
+
+/** @brief Credit is counted in byte-permille so shares need no division. */
+#define SCI_LANE_PERMILLE       (1000U)
+
+typedef struct sci_lane_frame_s {
+    const uint8_t* data;    /** Bytes to send */
+    uint32_t       length;  /** Number of bytes */
+    uint32_t       stamp;   /** Cycle count at sciSendPriority() */
+} sci_lane_frame_t;
+
+static volatile struct g_sciLane
+{
+    sci_lane_frame_t queue[NUM_OF_SCI_LANE][SCI_LANE_QUEUE_LEN];  /* Descriptor ring per lane */
+    uint32_t         head[NUM_OF_SCI_LANE];                       /* Next free slot, written by sciSendPriority() only */
+    uint32_t         tail[NUM_OF_SCI_LANE];                       /* Oldest unreleased slot, written by the ISR only */
+    uint32_t         credit[NUM_OF_SCI_LANE];                     /* Bandwidth owed to a backlogged lane, byte-permille */
+    uint16_t         share[NUM_OF_SCI_LANE];                      /* Copy of sci_lane_config_t::min_share_permille */
+    uint32_t         in_flight;                                   /* Lane of the frame in the transmitter, SCI_LANE_NONE if none */
+    sci_lane_stats_t stats[NUM_OF_SCI_LANE];                      /* Written by the ISR only */
+} g_sciLane_t[SCI_LIN_NUM_OF_INSTANCES];
+
+static uint32_t sci_lane_credit_add(uint32_t credit, uint32_t add){
+    return ((credit > (UINT32_MAX - add)) ? UINT32_MAX : (credit + add));
+}
+
+/* length * permille, saturated like the credit it is compared with. */
+static uint32_t sci_lane_scale(uint32_t length, uint32_t permille){
+    return (((permille != 0U) && (length > (UINT32_MAX / permille))) ? UINT32_MAX : (length * permille));
+}
+
+static uint32_t sci_lane_cost(uint32_t length){
+    return sci_lane_scale(length, SCI_LANE_PERMILLE);
+}
+
+/* Most urgent lane owed its next frame, else the most urgent backlogged lane, else SCI_LANE_NONE. */
+static uint32_t sci_lane_select(volatile struct g_sciLane* lanes){
+    uint32_t first = SCI_LANE_NONE;
+
+    for (uint32_t lane = 0U; lane < NUM_OF_SCI_LANE; lane++){
+        if (lanes->tail[lane] == lanes->head[lane]){
+            // An empty lane forfeits its credit, it must not burst later on saved-up bandwidth
+            lanes->credit[lane] = 0U;
+            continue;
+        }
+        if (first == SCI_LANE_NONE){
+            first = lane;
+        }
+        uint32_t length = lanes->queue[lane][lanes->tail[lane] % SCI_LANE_QUEUE_LEN].length;
+        if ((lanes->share[lane] != 0U) && (lanes->credit[lane] >= sci_lane_cost(length))){
+            return (lane);
+        }
+    }
+    return (first);
+}
+
+/* Runs in the TX interrupt: a frame is only asked for once the previous one is fully in the transmitter. */
+static bool sci_lane_refill(volatile tms570_reg* sci_lin_reg, const uint8_t** data, uint32_t* length){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile struct g_sciLane* lanes = &g_sciLane_t[index];
+    if (lanes->in_flight != SCI_LANE_NONE){
+        lanes->tail[lanes->in_flight]++;
+        lanes->in_flight = SCI_LANE_NONE;
+    }
+
+    uint32_t lane = sci_lane_select(lanes);
+    if (lane == SCI_LANE_NONE){
+        return (false);
+    }
+
+    volatile sci_lane_frame_t* frame = &lanes->queue[lane][lanes->tail[lane] % SCI_LANE_QUEUE_LEN];
+    uint32_t cost = sci_lane_cost(frame->length);
+    bool     shaped = false;
+
+    lanes->credit[lane] -= (lanes->credit[lane] < cost) ? lanes->credit[lane] : cost;
+    for (uint32_t other = 0U; other < NUM_OF_SCI_LANE; other++){
+        if ((other == lane) || (lanes->tail[other] == lanes->head[other])){
+            continue;
+        }
+        lanes->credit[other] = sci_lane_credit_add(lanes->credit[other], sci_lane_scale(frame->length, lanes->share[other]));
+        shaped = shaped || (other < lane);
+    }
+
+    volatile sci_lane_stats_t* stats = &lanes->stats[lane];
+    uint32_t latency = sciCycleNow() - frame->stamp;
+    stats->frames++;
+    stats->bytes += frame->length;
+    stats->shaped_frames += shaped ? 1U : 0U;
+    stats->latency_cycles[sciStatsBucket(latency)]++;
+    if (latency > stats->max_latency_cycles){
+        stats->max_latency_cycles = latency;
+    }
+
+    *data = frame->data;
+    *length = frame->length;
+    lanes->in_flight = lane;
+    return (true);
+}
+
+bool sciLaneInit(volatile tms570_reg* sci_lin_reg, const sci_lane_config_t* config){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile struct g_sciLane* lanes = &g_sciLane_t[index];
+    for (uint32_t lane = 0U; lane < NUM_OF_SCI_LANE; lane++){
+        uint16_t share = (config != NULL) ? config->min_share_permille[lane] : 0U;
+
+        lanes->head[lane] = 0U;
+        lanes->tail[lane] = 0U;
+        lanes->credit[lane] = 0U;
+        lanes->share[lane] = (share > SCI_LANE_PERMILLE) ? SCI_LANE_PERMILLE : share;
+
+        volatile uint32_t* words = (volatile uint32_t*)&lanes->stats[lane];
+        for (uint32_t i = 0U; i < (sizeof(sci_lane_stats_t) / sizeof(uint32_t)); i++){
+            words[i] = 0U;
+        }
+    }
+    lanes->in_flight = SCI_LANE_NONE;
+    return sciSetTxRefill(sci_lin_reg, sci_lane_refill);
+}
+
+bool sciSendPriority(volatile tms570_reg* sci_lin_reg, sci_lane_t priority, uint32_t length, const uint8_t* data){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(priority, NUM_OF_SCI_LANE) || (length == 0U) || (data == NULL)){
+        return (false);
+    }
+
+    volatile struct g_sciLane* lanes = &g_sciLane_t[index];
+    uint32_t head = lanes->head[priority];
+    if ((head - lanes->tail[priority]) >= SCI_LANE_QUEUE_LEN){
+        return (false);
+    }
+
+    volatile sci_lane_frame_t* slot = &lanes->queue[priority][head % SCI_LANE_QUEUE_LEN];
+    slot->data = data;
+    slot->length = length;
+    slot->stamp = sciCycleNow();
+
+    // The slot is complete before the ISR can see it
+    lanes->head[priority] = head + 1U;
+    return sciKickTx(sci_lin_reg);
+}
+
+bool sciLaneIsIdle(volatile tms570_reg* sci_lin_reg, sci_lane_t priority){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(priority, NUM_OF_SCI_LANE)){
+        return (false);
+    }
+    return (g_sciLane_t[index].tail[priority] == g_sciLane_t[index].head[priority]);
+}
+
+bool sciLaneGetStats(volatile tms570_reg* sci_lin_reg, sci_lane_t priority, sci_lane_stats_t* stats){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(priority, NUM_OF_SCI_LANE) || (stats == NULL)){
+        return (false);
+    }
+
+    // Each counter is consistent, the set may straddle one frame
+    sciStatsCopy((uint32_t*)stats, (volatile const uint32_t*)&g_sciLane_t[index].stats[priority], sizeof(sci_lane_stats_t) / sizeof(uint32_t));
+    return (true);
+}
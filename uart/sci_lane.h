@@ -0,0 +1,92 @@
+#ifndef SCI_LANE_H
+#define SCI_LANE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+#include "sci_stats.h"
+
+/** @brief Frames queued per lane. */
+#define SCI_LANE_QUEUE_LEN      (16U)
+
+/**
+ * @enum sci_lane_e
+ * @brief TX priority lanes, most urgent first.
+ */
+typedef enum sci_lane_e {
+    SCI_LANE_CONTROL = 0,       /** Control and protocol messages */
+    SCI_LANE_NORMAL,            /** Regular application traffic */
+    SCI_LANE_BULK,              /** Log dumps and file transfers */
+    NUM_OF_SCI_LANE             /** Number of lanes */
+} sci_lane_t;
+
+/**
+ * @struct sci_lane_config_s
+ * @brief Bandwidth shaping of an instance.
+ */
+typedef struct sci_lane_config_s {
+    uint16_t min_share_permille[NUM_OF_SCI_LANE];  /** Share of the bytes sent by other lanes a backlogged lane is owed, 0 for strict priority */
+} sci_lane_config_t;
+
+/**
+ * @struct sci_lane_stats_s
+ * @brief Statistics of one lane.
+ */
+typedef struct sci_lane_stats_s {
+    uint32_t frames;                                /** Frames started */
+    uint32_t bytes;                                 /** Bytes of the frames started */
+    uint32_t shaped_frames;                         /** Frames started ahead of a more urgent lane on owed bandwidth */
+    uint32_t max_latency_cycles;                    /** Longest time from sciSendPriority() to the first byte in TD */
+    uint32_t latency_cycles[SCI_STATS_HIST_BUCKETS];/** Queueing latency histogram, buckets as in sci_stats_t */
+} sci_lane_stats_t;
+
+/**
+ * @brief Attach priority lanes to an SCI/LIN instance.
+ *
+ * Installs the TX refill hook. At every frame boundary the TX interrupt
+ * starts the next frame of the most urgent non-empty lane, unless a less
+ * urgent lane is owed bandwidth: each frame sent credits every other
+ * backlogged lane with its min_share_permille of the frame length, and a
+ * lane whose credit covers its next frame goes first. Credit is dropped
+ * when a lane runs empty, so an idle lane cannot save it up.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] config Shaping parameters, NULL for strict priority. @see sci_lane_config_t
+ * @return true if attached, false otherwise.
+ */
+bool sciLaneInit(volatile tms570_reg* sci_lin_reg, const sci_lane_config_t* config);
+
+/**
+ * @brief Queue a frame on a priority lane, the lane-aware form of sciSend().
+ *
+ * The data is not copied and must stay valid until sciLaneIsIdle() reports
+ * the lane idle. Frames are never interleaved. One producer per lane.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] priority Lane to queue on. @see sci_lane_t
+ * @param[in] length Number of bytes to send.
+ * @param[in] data Bytes to send.
+ * @return true if queued, false if the lane is full or the arguments are invalid.
+ */
+bool sciSendPriority(volatile tms570_reg* sci_lin_reg, sci_lane_t priority, uint32_t length, const uint8_t* data);
+
+/**
+ * @brief Check whether every frame of a lane has been handed to the transmitter.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] priority Lane to check. @see sci_lane_t
+ * @return true if the lane is empty, false otherwise.
+ */
+bool sciLaneIsIdle(volatile tms570_reg* sci_lin_reg, sci_lane_t priority);
+
+/**
+ * @brief Copy the statistics of a lane without stopping the TX interrupt.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] priority Lane to read. @see sci_lane_t
+ * @param[out] stats Pointer to store the snapshot. @see sci_lane_stats_t
+ * @return true if the snapshot was taken, false otherwise.
+ */
+bool sciLaneGetStats(volatile tms570_reg* sci_lin_reg, sci_lane_t priority, sci_lane_stats_t* stats);
+
+#endif // SCI_LANE_H
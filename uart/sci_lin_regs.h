@@ -341,6 +341,8 @@
 #define TMS570_SCI_FLR_NRE_BIT_LEN (1)
 #define TMS570_SCI_FLR_ISFE_BIT_LEN (1)
 #define TMS570_SCI_FLR_CE_BIT_LEN (1)
+#define TMS570_SCI_FLR_PBE_BIT_LEN (1)
+#define TMS570_SCI_FLR_BE_BIT_LEN (1)
 
 /* INT_VECT_0 Fields */
 #define TMS570_SCI_INT_VECT_0_INT_VECT_0_OFFSET (0)
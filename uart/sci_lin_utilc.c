@@ -1,5 +1,8 @@
 #include "sci_lin_utils.h"
 #include "sci_lin_regs.h"
+#include "sci_cycle.h"
+#include "sci_stats.h"
+#include "sci_trace.h"
 #include "math.h"
 
 static volatile struct g_sciTransfer
@@ -9,6 +12,7 @@ static volatile struct g_sciTransfer
     uint32_t   rx_length;    /* Receive data length in number of Bytes */  
     uint8_t    * tx_data;    /* Transmit data pointer */      
     uint8_t    * rx_data;    /* Receive data pointer */  
+    sci_tx_refill_t tx_refill; /* Supplies the next chunk once tx_length runs out */
 } g_sciTransfer_t[4U];
 
 bool gcr0_reset(volatile tms570_reg* sci_lin_reg, bool reset){
@@ -830,12 +834,24 @@ bool sciIsTxReady(volatile tms570_reg* sci_lin_reg){
     return (GET_BITS(sci_lin_reg[TMS570_SCI_FLR], TMS570_SCI_FLR_TX_RDY_OFFSET, TMS570_SCI_FLR_TX_RDY_BIT_LEN) == 1U);
 }
 
-bool sciSendByte(volatile tms570_reg* sci_lin_reg, uint8_t byte){
+// Spins for TXRDY; only an actual wait reads the cycle counter, so a ready transmitter costs one poll
+static void sci_wait_tx_ready(volatile tms570_reg* sci_lin_reg){
+    if (sciIsTxReady(sci_lin_reg)){
+        return;
+    }
+
+    uint32_t wait_start = sciCycleNow();
     while (!sciIsTxReady(sci_lin_reg)){
     }
+    sciStatsAdd(sci_lin_reg, SCI_STATS_TXRDY_WAIT_CYCLES, sciCycleNow() - wait_start);
+}
+
+bool sciSendByte(volatile tms570_reg* sci_lin_reg, uint8_t byte){
+    sci_wait_tx_ready(sci_lin_reg);
     if (!tms570_update_register(sci_lin_reg[TMS570_SCI_TD], byte, TMS570_SCI_TD_MASK)){
         return (false);
     }
+    sciStatsAdd(sci_lin_reg, SCI_STATS_TX_POLLED_BYTES, 1U);
     return (true);
 }
 
@@ -846,6 +862,8 @@ bool sciSend(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data)
                          ((sci_lin_reg == TMS570_SCI_LIN_3_BASE_ADDR) ? 2U : 3U));
     uint8_t txdata;
 
+    SCI_TRACE_ENTER(SCI_TRACE_POINT_SEND, index);
+
     // Check if interrupt mode is enabled (SCI_TX_INT = 0x00000100U)
     if ((g_sciTransfer_t[index].mode & 0x00000100U) != 0U)
     {
@@ -855,6 +873,7 @@ bool sciSend(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data)
 
         txdata = *g_sciTransfer_t[index].tx_data;
         if (!tms570_update_register(sci_lin_reg[TMS570_SCI_TD], txdata, TMS570_SCI_TD_MASK)){
+            SCI_TRACE_EXIT(SCI_TRACE_POINT_SEND, index);
             return false;
         }
         g_sciTransfer_t[index].tx_data++;
@@ -866,18 +885,18 @@ bool sciSend(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data)
         // Polling mode: send all bytes, waiting for TX ready each time
         while (length > 0U)
         {
-            while (!sciIsTxReady(sci_lin_reg))
-            {
-                // Wait for TX ready
-            }
+            sci_wait_tx_ready(sci_lin_reg);
             txdata = *data;
             if (!tms570_update_register(sci_lin_reg[TMS570_SCI_TD], txdata, TMS570_SCI_TD_MASK)){
+                SCI_TRACE_EXIT(SCI_TRACE_POINT_SEND, index);
                 return false;
             }
+            sciStatsAdd(sci_lin_reg, SCI_STATS_TX_POLLED_BYTES, 1U);
             data++;
             length--;
         }
     }
+    SCI_TRACE_EXIT(SCI_TRACE_POINT_SEND, index);
     return true;
 }
 
@@ -897,13 +916,15 @@ bool sciRxError(volatile tms570_reg* sci_lin_reg, uint32_t* error_flags){
     return (true);
 }
 
-bool sciReceiveByte(volatile tms570_reg* sci_lin_reg){
+uint8_t sciReceiveByte(volatile tms570_reg* sci_lin_reg){
     while (sciIsRxReady(sci_lin_reg)==0){
     }
-    return GET_BITS(sci_lin_reg[TMS570_SCI_RD], TMS570_SCI_RD_RD_OFFSET, TMS570_SCI_RD_RD_BIT_LEN);
+    sciStatsAdd(sci_lin_reg, SCI_STATS_RX_POLLED_BYTES, 1U);
+    return (uint8_t)GET_BITS(sci_lin_reg[TMS570_SCI_RD], TMS570_SCI_RD_RD_OFFSET, TMS570_SCI_RD_RD_BIT_LEN);
 }
 
 bool sciReceive(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data){
+    SCI_TRACE_ENTER(SCI_TRACE_POINT_RECEIVE, sciGetInstanceIndex(sci_lin_reg));
     if(sciIsRxReady(sci_lin_reg)==GET_BITS(sci_lin_reg[TMS570_SCI_SET_INT], TMS570_SCI_SET_INT_SET_RX_INT_OFFSET, TMS570_SCI_SET_INT_SET_RX_INT_BIT_LEN)){
         uint32_t index = (sci_lin_reg == TMS570_SCI_LIN_1_BASE_ADDR) ? 0U : 
                          ((sci_lin_reg == TMS570_SCI_LIN_2_BASE_ADDR) ? 1U : 
@@ -924,10 +945,12 @@ bool sciReceive(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data
             while (sciIsRxReady(sci_lin_reg)==0){
             }
             *data = GET_BITS(sci_lin_reg[TMS570_SCI_RD], TMS570_SCI_RD_RD_OFFSET, TMS570_SCI_RD_RD_BIT_LEN);
+            sciStatsAdd(sci_lin_reg, SCI_STATS_RX_POLLED_BYTES, 1U);
             data++;
             length--;
         }
     }
+    SCI_TRACE_EXIT(SCI_TRACE_POINT_RECEIVE, sciGetInstanceIndex(sci_lin_reg));
     return (true);
 }
 
@@ -987,3 +1010,578 @@ bool sciExitResetState(volatile tms570_reg* sci_lin_reg){
     tms570_update_register(sci_lin_reg[TMS570_SCI_GCR1], gcr1_reg, TMS570_SCI_GCR1_MASK);
     return true;
 }
+
+uint32_t sciGetInstanceIndex(volatile tms570_reg* sci_lin_reg){
+    return (sci_lin_reg == TMS570_SCI_LIN_1_BASE_ADDR) ? 0U :
+           ((sci_lin_reg == TMS570_SCI_LIN_2_BASE_ADDR) ? 1U :
+           ((sci_lin_reg == TMS570_SCI_LIN_3_BASE_ADDR) ? 2U : SCI_LIN_NUM_OF_INSTANCES));
+}
+
+volatile tms570_reg* sciGetInstanceBase(uint32_t index){
+    static volatile tms570_reg* const s_sciInstanceBase[SCI_LIN_NUM_OF_INSTANCES] = {
+        TMS570_SCI_LIN_1_BASE_ADDR,
+        TMS570_SCI_LIN_2_BASE_ADDR,
+        TMS570_SCI_LIN_3_BASE_ADDR,
+    };
+
+    return (index < SCI_LIN_NUM_OF_INSTANCES) ? s_sciInstanceBase[index] : NULL;
+}
+
+bool sci_set_lin_max_baud_rate(volatile tms570_reg* sci_lin_reg, uint16_t mbr){
+    tms570_reg mbrs_reg = VAL2FIELD((tms570_reg)mbr, TMS570_MBRS_MBRS_OFFSET, TMS570_MBRS_MBRS_BIT_LEN);
+    return tms570_update_register(&sci_lin_reg[TMS570_MBRS], mbrs_reg, TMS570_MBRS_MASK);
+}
+
+bool sci_get_lin_max_baud_rate(volatile tms570_reg* sci_lin_reg, uint16_t* mbr_bit){
+    if (mbr_bit == NULL){
+        return (false);
+    }
+    *mbr_bit = (uint16_t)GET_BITS(sci_lin_reg[TMS570_MBRS], TMS570_MBRS_MBRS_OFFSET, TMS570_MBRS_MBRS_BIT_LEN);
+    return (true);
+}
+
+bool sci_get_int_vect_0(volatile tms570_reg* sci_lin_reg, uint8_t* int_vect_0_bit){
+    if (int_vect_0_bit == NULL){
+        return (false);
+    }
+    *int_vect_0_bit = (uint8_t)GET_BITS(sci_lin_reg[TMS570_SCI_INT_VECT_0], TMS570_SCI_INT_VECT_0_INT_VECT_0_OFFSET, TMS570_SCI_INT_VECT_0_BIT_LEN);
+    return (true);
+}
+
+bool sci_get_int_vect_1(volatile tms570_reg* sci_lin_reg, uint8_t* int_vect_1_bit){
+    if (int_vect_1_bit == NULL){
+        return (false);
+    }
+    *int_vect_1_bit = (uint8_t)GET_BITS(sci_lin_reg[TMS570_SCI_INT_VECT_1], TMS570_SCI_INT_VECT_1_INT_VECT_1_OFFSET, TMS570_SCI_INT_VECT_1_BIT_LEN);
+    return (true);
+}
+
+bool sciTxInterruptHandler(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    // sciSend() wrote the first byte already, tx_length still counts it
+    if (g_sciTransfer_t[index].tx_length > 1U){
+        g_sciTransfer_t[index].tx_length--;
+        tms570_write_register(&sci_lin_reg[TMS570_SCI_TD], *g_sciTransfer_t[index].tx_data);
+        g_sciTransfer_t[index].tx_data++;
+        sciStatsAdd(sci_lin_reg, SCI_STATS_TX_BYTES, 1U);
+        return (true);
+    }
+
+    // Chunk done, the refill hook may hand over the next one without a round trip through the task
+    const uint8_t* data = NULL;
+    uint32_t length = 0U;
+    if ((g_sciTransfer_t[index].tx_refill != NULL) && g_sciTransfer_t[index].tx_refill(sci_lin_reg, &data, &length) && (length > 0U)){
+        g_sciTransfer_t[index].tx_length = length;
+        g_sciTransfer_t[index].tx_data = (uint8_t*)&data[1];
+        tms570_write_register(&sci_lin_reg[TMS570_SCI_TD], data[0]);
+        sciStatsAdd(sci_lin_reg, SCI_STATS_TX_BYTES, 1U);
+        return (true);
+    }
+
+    // TX_RDY stays set while the buffer is empty, so the interrupt has to be disabled
+    g_sciTransfer_t[index].tx_length = 0U;
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_CLEAR_INT], MAKE_MASK(TMS570_SCI_CLEAR_INT_CLEAR_TX_INT_OFFSET, TMS570_SCI_CLEAR_INT_CLEAR_TX_INT_BIT_LEN));
+    return (false);
+}
+
+bool sciRxInterruptHandler(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        // Still read RD so the flag is cleared
+        (void)sci_lin_reg[TMS570_SCI_RD];
+        return (false);
+    }
+
+    uint8_t byte = (uint8_t)GET_BITS(sci_lin_reg[TMS570_SCI_RD], TMS570_SCI_RD_RD_OFFSET, TMS570_SCI_RD_RD_BIT_LEN);
+    sciStatsAdd(sci_lin_reg, SCI_STATS_RX_BYTES, 1U);
+    if (g_sciTransfer_t[index].rx_length == 0U){
+        return (false);
+    }
+
+    *g_sciTransfer_t[index].rx_data = byte;
+    g_sciTransfer_t[index].rx_data++;
+    g_sciTransfer_t[index].rx_length--;
+    return (true);
+}
+
+// SET_INT_LVL and CLEAR_INT_LVL are write-1 registers: a 1 in SET maps the source to INT1, a 1 in CLEAR to INT0
+static bool sci_write_int_level(volatile tms570_reg* sci_lin_reg, uint32_t offset, bool intLevel){
+    uint32_t bit = MAKE_MASK(offset, 1U);
+    if (intLevel){
+        tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT_LVL], bit);
+    } else {
+        tms570_write_register(&sci_lin_reg[TMS570_SCI_CLEAR_INT_LVL], bit);
+    }
+    return ((sci_lin_reg[TMS570_SCI_SET_INT_LVL] & bit) == (intLevel ? bit : 0U));
+}
+
+bool sci_set_int_brkdt_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_BRKDT_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_wakeup_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_WAKEUP_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_timeout_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_TIMEOUT_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_toawus_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_TOAWUS_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_toa3wus_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_TOA3WUS_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_tx_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_TX_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_rx_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_RX_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_id_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_ID_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_rx_dma_all_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_RX_DMA_ALL_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_parity_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_PE_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_overrun_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_OE_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_framing_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_FE_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_no_response_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_NRE_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_inconsistent_synch_field_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_ISFE_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_checksum_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_CE_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_physical_bus_error_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_PBE_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_set_int_bit_error_level(volatile tms570_reg* sci_lin_reg, bool intLevel){
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_SET_INT_LVL_SET_BE_INT_LVL_OFFSET, intLevel);
+}
+
+bool sci_clr_int_brkdt_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_BRKDT_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_wakeup_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_WAKEUP_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_timeout_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_TIMEOUT_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_toawus_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_TOAWUS_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_toa3wus_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_TOA3WUS_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_tx_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_TX_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_rx_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_RX_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_id_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_ID_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_rx_dma_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_RX_DMA_ALL_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_parity_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_PE_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_overrun_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_OE_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_framing_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_FE_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_no_response_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_NRE_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_inconsistent_synch_field_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_ISFE_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_checksum_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_CE_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_physical_bus_error_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_PBE_INT_LVL_OFFSET, false);
+}
+
+bool sci_clr_int_bit_error_level(volatile tms570_reg* sci_lin_reg, bool clear){
+    if (!clear){
+        return (true);
+    }
+    return sci_write_int_level(sci_lin_reg, TMS570_SCI_CLEAR_INT_LVL_CLEAR_BE_INT_LVL_OFFSET, false);
+}
+
+// IODFTCTRL fields are plain read-modify-write; none of them take effect unless IODFTENA holds the 0xA key
+static bool sci_write_iodftctrl_field(volatile tms570_reg* sci_lin_reg, uint8_t value, uint32_t offset, uint32_t len){
+    if (value > MASK_N(len)){
+        return (false);
+    }
+    tms570_reg iodftctrl_reg = tms570_update_field(sci_lin_reg[TMS570_IODFTCTRL], value, offset, len);
+    return tms570_update_register(&sci_lin_reg[TMS570_IODFTCTRL], iodftctrl_reg, TMS570_IODFTCTRL_MASK);
+}
+
+static bool sci_read_iodftctrl_field(volatile tms570_reg* sci_lin_reg, uint8_t* value, uint32_t offset, uint32_t len){
+    if (value == NULL){
+        return (false);
+    }
+    *value = (uint8_t)GET_BITS(sci_lin_reg[TMS570_IODFTCTRL], offset, len);
+    return (true);
+}
+
+bool sci_set_iodftctrl_rxp_ena(volatile tms570_reg* sci_lin_reg, uint8_t rxp_ena){
+    return sci_write_iodftctrl_field(sci_lin_reg, rxp_ena, TMS570_IODFTCTRL_RXP_ENA_OFFSET, TMS570_IODFTCTRL_RXP_ENA_BIT_LEN);
+}
+
+bool sci_get_iodftctrl_rxp_ena(volatile tms570_reg* sci_lin_reg, uint8_t* rxp_ena_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, rxp_ena_bit, TMS570_IODFTCTRL_RXP_ENA_OFFSET, TMS570_IODFTCTRL_RXP_ENA_BIT_LEN);
+}
+
+bool sci_set_iodftctrl_lpb_ena(volatile tms570_reg* sci_lin_reg, uint8_t lpb_ena){
+    return sci_write_iodftctrl_field(sci_lin_reg, lpb_ena, TMS570_IODFTCTRL_LPB_ENA_OFFSET, TMS570_IODFTCTRL_LPB_ENA_BIT_LEN);
+}
+
+bool sci_get_iodftctrl_lpb_ena(volatile tms570_reg* sci_lin_reg, uint8_t* lpb_ena_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, lpb_ena_bit, TMS570_IODFTCTRL_LPB_ENA_OFFSET, TMS570_IODFTCTRL_LPB_ENA_BIT_LEN);
+}
+
+bool sci_set_iodftctrl_iodftena(volatile tms570_reg* sci_lin_reg, uint8_t iodftena){
+    return sci_write_iodftctrl_field(sci_lin_reg, iodftena, TMS570_IODFTCTRL_IODFTENA_OFFSET, TMS570_IODFTCTRL_IODFTENA_BIT_LEN);
+}
+
+bool sci_get_iodftctrl_iodftena(volatile tms570_reg* sci_lin_reg, uint8_t* iodftena_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, iodftena_bit, TMS570_IODFTCTRL_IODFTENA_OFFSET, TMS570_IODFTCTRL_IODFTENA_BIT_LEN);
+}
+
+bool sci_set_tx_shift(volatile tms570_reg* sci_lin_reg, uint8_t tx_shift){
+    return sci_write_iodftctrl_field(sci_lin_reg, tx_shift, TMS570_IODFTCTRL_TX_SHIFT_OFFSET, TMS570_IODFTCTRL_TX_SHIFT_BIT_LEN);
+}
+
+bool sci_get_tx_shift(volatile tms570_reg* sci_lin_reg, uint8_t* tx_shift_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, tx_shift_bit, TMS570_IODFTCTRL_TX_SHIFT_OFFSET, TMS570_IODFTCTRL_TX_SHIFT_BIT_LEN);
+}
+
+bool sci_set_pin_sample_mask(volatile tms570_reg* sci_lin_reg, uint8_t pin_sample_mask){
+    return sci_write_iodftctrl_field(sci_lin_reg, pin_sample_mask, TMS570_IODFTCTRL_PIN_SAMPLE_MASK_OFFSET, TMS570_IODFTCTRL_PIN_SAMPLE_MASK_BIT_LEN);
+}
+
+bool sci_get_pin_sample_mask(volatile tms570_reg* sci_lin_reg, uint8_t* pin_sample_mask_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, pin_sample_mask_bit, TMS570_IODFTCTRL_PIN_SAMPLE_MASK_OFFSET, TMS570_IODFTCTRL_PIN_SAMPLE_MASK_BIT_LEN);
+}
+
+bool sci_set_brkdt_enable(volatile tms570_reg* sci_lin_reg, uint8_t enable){
+    return sci_write_iodftctrl_field(sci_lin_reg, enable, TMS570_IODFTCTRL_BRKDT_ENA_OFFSET, TMS570_IODFTCTRL_BRKDT_ENA_BIT_LEN);
+}
+
+bool sci_get_brkdt_enable(volatile tms570_reg* sci_lin_reg, uint8_t* brkdt_enable_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, brkdt_enable_bit, TMS570_IODFTCTRL_BRKDT_ENA_OFFSET, TMS570_IODFTCTRL_BRKDT_ENA_BIT_LEN);
+}
+
+bool sci_set_pen_enable(volatile tms570_reg* sci_lin_reg, uint8_t enable){
+    return sci_write_iodftctrl_field(sci_lin_reg, enable, TMS570_IODFTCTRL_PEN_OFFSET, TMS570_IODFTCTRL_PEN_BIT_LEN);
+}
+
+bool sci_get_pen_enable(volatile tms570_reg* sci_lin_reg, uint8_t* pen_enable_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, pen_enable_bit, TMS570_IODFTCTRL_PEN_OFFSET, TMS570_IODFTCTRL_PEN_BIT_LEN);
+}
+
+bool sci_set_fen_enable(volatile tms570_reg* sci_lin_reg, uint8_t enable){
+    return sci_write_iodftctrl_field(sci_lin_reg, enable, TMS570_IODFTCTRL_FEN_OFFSET, TMS570_IODFTCTRL_FEN_BIT_LEN);
+}
+
+bool sci_get_fen_enable(volatile tms570_reg* sci_lin_reg, uint8_t* fen_enable_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, fen_enable_bit, TMS570_IODFTCTRL_FEN_OFFSET, TMS570_IODFTCTRL_FEN_BIT_LEN);
+}
+
+bool sci_set_isfe_enable(volatile tms570_reg* sci_lin_reg, uint8_t enable){
+    return sci_write_iodftctrl_field(sci_lin_reg, enable, TMS570_IODFTCTRL_ISFE_OFFSET, TMS570_IODFTCTRL_ISFE_BIT_LEN);
+}
+
+bool sci_get_isfe_enable(volatile tms570_reg* sci_lin_reg, uint8_t* isfe_enable_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, isfe_enable_bit, TMS570_IODFTCTRL_ISFE_OFFSET, TMS570_IODFTCTRL_ISFE_BIT_LEN);
+}
+
+bool sci_set_cen_enable(volatile tms570_reg* sci_lin_reg, uint8_t enable){
+    return sci_write_iodftctrl_field(sci_lin_reg, enable, TMS570_IODFTCTRL_CEN_OFFSET, TMS570_IODFTCTRL_CEN_BIT_LEN);
+}
+
+bool sci_get_cen_enable(volatile tms570_reg* sci_lin_reg, uint8_t* cen_enable_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, cen_enable_bit, TMS570_IODFTCTRL_CEN_OFFSET, TMS570_IODFTCTRL_CEN_BIT_LEN);
+}
+
+bool sci_set_pb_enable(volatile tms570_reg* sci_lin_reg, uint8_t enable){
+    return sci_write_iodftctrl_field(sci_lin_reg, enable, TMS570_IODFTCTRL_PBEN_OFFSET, TMS570_IODFTCTRL_PBEN_BIT_LEN);
+}
+
+bool sci_get_pb_enable(volatile tms570_reg* sci_lin_reg, uint8_t* pb_enable_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, pb_enable_bit, TMS570_IODFTCTRL_PBEN_OFFSET, TMS570_IODFTCTRL_PBEN_BIT_LEN);
+}
+
+bool sci_set_ben_enable(volatile tms570_reg* sci_lin_reg, uint8_t enable){
+    return sci_write_iodftctrl_field(sci_lin_reg, enable, TMS570_IODFTCTRL_BEN_OFFSET, TMS570_IODFTCTRL_BEN_BIT_LEN);
+}
+
+bool sci_get_ben_enable(volatile tms570_reg* sci_lin_reg, uint8_t* ben_enable_bit){
+    return sci_read_iodftctrl_field(sci_lin_reg, ben_enable_bit, TMS570_IODFTCTRL_BEN_OFFSET, TMS570_IODFTCTRL_BEN_BIT_LEN);
+}
+
+bool sciTrySendByte(volatile tms570_reg* sci_lin_reg, uint8_t byte){
+    if (!sciIsTxReady(sci_lin_reg)){
+        return (false);
+    }
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_TD], byte);
+    sciStatsAdd(sci_lin_reg, SCI_STATS_TX_POLLED_BYTES, 1U);
+    return (true);
+}
+
+bool sciTryReceiveByte(volatile tms570_reg* sci_lin_reg, uint8_t* byte){
+    if ((byte == NULL) || !sciIsRxReady(sci_lin_reg)){
+        return (false);
+    }
+    *byte = (uint8_t)GET_BITS(sci_lin_reg[TMS570_SCI_RD], TMS570_SCI_RD_RD_OFFSET, TMS570_SCI_RD_RD_BIT_LEN);
+    sciStatsAdd(sci_lin_reg, SCI_STATS_RX_POLLED_BYTES, 1U);
+    return (true);
+}
+
+// bounded == false returns at the first busy poll, otherwise polling continues until the deadline
+static uint32_t sci_send_bounded(volatile tms570_reg* sci_lin_reg, uint32_t length, const uint8_t* data, bool bounded, uint32_t deadline){
+    uint32_t count = 0U;
+    uint32_t wait_start = 0U;
+    bool     waiting = false;
+
+    while (count < length){
+        if (sciTrySendByte(sci_lin_reg, data[count])){
+            count++;
+            if (waiting){
+                sciStatsAdd(sci_lin_reg, SCI_STATS_TXRDY_WAIT_CYCLES, sciCycleNow() - wait_start);
+                waiting = false;
+            }
+        } else if (!bounded || sciCycleExpired(deadline)){
+            break;
+        } else if (!waiting){
+            wait_start = sciCycleNow();
+            waiting = true;
+        }
+    }
+    if (waiting){
+        sciStatsAdd(sci_lin_reg, SCI_STATS_TXRDY_WAIT_CYCLES, sciCycleNow() - wait_start);
+    }
+    return (count);
+}
+
+static uint32_t sci_receive_bounded(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data, bool bounded, uint32_t deadline){
+    uint32_t count = 0U;
+
+    while (count < length){
+        if (sciTryReceiveByte(sci_lin_reg, &data[count])){
+            count++;
+        } else if (!bounded || sciCycleExpired(deadline)){
+            break;
+        }
+    }
+    return (count);
+}
+
+bool sciTrySend(volatile tms570_reg* sci_lin_reg, uint32_t length, const uint8_t* data, uint32_t* sent){
+    if ((data == NULL) || (sent == NULL)){
+        return (false);
+    }
+    *sent = sci_send_bounded(sci_lin_reg, length, data, false, 0U);
+    return (*sent == length);
+}
+
+bool sciTryReceive(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data, uint32_t* received){
+    if ((data == NULL) || (received == NULL)){
+        return (false);
+    }
+    *received = sci_receive_bounded(sci_lin_reg, length, data, false, 0U);
+    return (*received == length);
+}
+
+bool sciSendDeadline(volatile tms570_reg* sci_lin_reg, uint32_t length, const uint8_t* data, uint32_t deadline, uint32_t* sent){
+    if ((data == NULL) || (sent == NULL)){
+        return (false);
+    }
+    *sent = sci_send_bounded(sci_lin_reg, length, data, true, deadline);
+    return (*sent == length);
+}
+
+bool sciReceiveDeadline(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data, uint32_t deadline, uint32_t* received){
+    if ((data == NULL) || (received == NULL)){
+        return (false);
+    }
+    *received = sci_receive_bounded(sci_lin_reg, length, data, true, deadline);
+    return (*received == length);
+}
+
+bool sciSetTxRefill(volatile tms570_reg* sci_lin_reg, sci_tx_refill_t refill){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+    g_sciTransfer_t[index].tx_refill = refill;
+    return (true);
+}
+
+bool sciKickTx(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (g_sciTransfer_t[index].tx_refill == NULL)){
+        return (false);
+    }
+    // TX_RDY is set while idle, so the interrupt fires at once and pulls the first chunk; harmless while active
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], MAKE_MASK(TMS570_SCI_SET_INT_SET_TX_INT_OFFSET, TMS570_SCI_SET_INT_SET_TX_INT_BIT_LEN));
+    return (true);
+}
+
+bool sciBaudrateToBrs(uint32_t baud, bool async, uint32_t* brs){
+    if ((brs == NULL) || (baud == 0U)){
+        return (false);
+    }
+
+    uint32_t ticks = (VCLK_FREQ + (baud / 2U)) / baud;
+    uint32_t p = async ? ((ticks / 16U) - 1U) : (ticks - 1U);
+    uint32_t m = async ? (ticks % 16U) : 0U;
+
+    if ((ticks < (async ? 16U : 1U)) || (p > MASK_N(TMS570_SCI_BRS_PRESCALER_P_BIT_LEN))){
+        return (false);
+    }
+    *brs = VAL2FIELD(p, TMS570_SCI_BRS_PRESCALER_P_OFFSET, TMS570_SCI_BRS_PRESCALER_P_BIT_LEN) |
+           VAL2FIELD(m, TMS570_SCI_BRS_M_OFFSET, TMS570_SCI_BRS_M_BIT_LEN);
+    return (true);
+}
+
+bool sciSwitchBaudrate(volatile tms570_reg* sci_lin_reg, uint32_t baud, uint32_t deadline){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+    uint32_t tx_int = MAKE_MASK(TMS570_SCI_SET_INT_SET_TX_INT_OFFSET, TMS570_SCI_SET_INT_SET_TX_INT_BIT_LEN);
+    uint32_t swnrst = MAKE_MASK(TMS570_SCI_GCR1_SWnRST_OFFSET, TMS570_SCI_GCR1_SWnRST_BIT_LEN);
+    uint32_t brs;
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+    tms570_reg gcr1_reg = sci_lin_reg[TMS570_SCI_GCR1] & TMS570_SCI_GCR1_MASK;
+    bool async = (GET_BITS(gcr1_reg, TMS570_SCI_GCR1_TIMING_MODE_OFFSET, TMS570_SCI_GCR1_TIMING_MODE_BIT_LEN) == 1U);
+    if (!sciBaudrateToBrs(baud, async, &brs)){
+        return (false);
+    }
+
+    // With the TX interrupt held back the refill hook stops feeding TD and the rings keep their bytes
+    uint32_t tx_enabled = sci_lin_reg[TMS570_SCI_SET_INT] & tx_int;
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_CLEAR_INT], tx_int);
+
+    bool result = true;
+    while (GET_BITS(sci_lin_reg[TMS570_SCI_FLR], TMS570_SCI_FLR_TX_EMPTY_OFFSET, TMS570_SCI_FLR_TX_EMPTY_BIT_LEN) == 0U){
+        if (sciCycleExpired(deadline)){
+            result = false;
+            break;
+        }
+    }
+
+    if (result){
+        result = tms570_update_register(&sci_lin_reg[TMS570_SCI_GCR1], gcr1_reg & ~swnrst, TMS570_SCI_GCR1_MASK);
+        result = tms570_update_register(&sci_lin_reg[TMS570_SCI_BRS], brs, TMS570_SCI_BRS_MASK) && result;
+        result = tms570_update_register(&sci_lin_reg[TMS570_SCI_GCR1], gcr1_reg | swnrst, TMS570_SCI_GCR1_MASK) && result;
+    }
+
+    // TX_RDY is set after the reset, so a pending refill resumes at once
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], tx_enabled);
+    return (result);
+}
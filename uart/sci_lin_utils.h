@@ -2946,7 +2946,7 @@ bool sciSend(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data);
 bool sciIsRxReady(volatile tms570_reg* sci_lin_reg);
 bool sciIsIdleDetected(volatile tms570_reg* sci_lin_reg);
 bool sciRxError(volatile tms570_reg* sci_lin_reg, uint32_t* error_flags);
-bool sciReceiveByte(volatile tms570_reg* sci_lin_reg);
+uint8_t sciReceiveByte(volatile tms570_reg* sci_lin_reg);
 bool sciReceive(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data);
 bool sciEnableLoopback(volatile tms570_reg* sci_lin_reg, bool loopbackMode);
 bool sciDisableLoopback(volatile tms570_reg* sci_lin_reg);
@@ -2954,4 +2954,174 @@ bool sciEnableNotification(volatile tms570_reg* sci_lin_reg, uint32_t flags);
 bool sciDisableNotification(volatile tms570_reg* sci_lin_reg, uint32_t flags);
 bool sciEnterResetState(volatile tms570_reg* sci_lin_reg);
 bool sciExitResetState(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief TX refill hook, called from the TX interrupt when the current chunk is done.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param data Pointer to store the next chunk; it must stay valid until the next call.
+ * @param length Pointer to store the length of the next chunk.
+ * @return true if a chunk was supplied, false to end the transfer.
+ */
+typedef bool (*sci_tx_refill_t)(volatile tms570_reg* sci_lin_reg, const uint8_t** data, uint32_t* length);
+
+/** @brief Number of SCI/LIN instances on the device. */
+#define SCI_LIN_NUM_OF_INSTANCES             (3U)
+
+/**
+ * @brief Map an SCI/LIN register base to its instance index.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return 0, 1 or 2 for SCI/LIN 1, 2 or 3; SCI_LIN_NUM_OF_INSTANCES for an unknown base.
+ */
+uint32_t sciGetInstanceIndex(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Map an instance index to its SCI/LIN register base.
+ *
+ * @param index 0, 1 or 2 for SCI/LIN 1, 2 or 3.
+ * @return The register base, NULL for an unknown index.
+ */
+volatile tms570_reg* sciGetInstanceBase(uint32_t index);
+
+/**
+ * @brief Transmit interrupt handler for interrupt-driven sciSend().
+ *
+ * Writes the next byte of the current transfer, or disables the TX interrupt
+ * once the last byte has been written.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if a byte was written, false if the transfer is complete.
+ */
+bool sciTxInterruptHandler(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Receive interrupt handler for interrupt-driven sciReceive().
+ *
+ * Reads RD, which clears the RX flag, and stores the byte while a transfer
+ * is pending.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if the byte was stored, false if it was dropped.
+ */
+bool sciRxInterruptHandler(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Write one byte if the transmitter is ready, without waiting.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param byte Byte to send.
+ * @return true if the byte was written, false if TD is still busy.
+ */
+bool sciTrySendByte(volatile tms570_reg* sci_lin_reg, uint8_t byte);
+
+/**
+ * @brief Read one byte if one has been received, without waiting.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param byte Pointer to store the byte.
+ * @return true if a byte was read, false if RD is empty.
+ */
+bool sciTryReceiveByte(volatile tms570_reg* sci_lin_reg, uint8_t* byte);
+
+/**
+ * @brief Send as many bytes as the transmitter accepts right now.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param length Number of bytes to send.
+ * @param data Bytes to send.
+ * @param sent Pointer to store the number of bytes written.
+ * @return true if all bytes were written, false otherwise.
+ */
+bool sciTrySend(volatile tms570_reg* sci_lin_reg, uint32_t length, const uint8_t* data, uint32_t* sent);
+
+/**
+ * @brief Receive the bytes that have already arrived.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param length Maximum number of bytes to receive.
+ * @param data Buffer for the received bytes.
+ * @param received Pointer to store the number of bytes read.
+ * @return true if length bytes were read, false otherwise.
+ */
+bool sciTryReceive(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data, uint32_t* received);
+
+/**
+ * @brief Send bytes, waiting for the transmitter no longer than a deadline.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param length Number of bytes to send.
+ * @param data Bytes to send.
+ * @param deadline Cycle counter deadline from sciCycleDeadline().
+ * @param sent Pointer to store the number of bytes written.
+ * @return true if all bytes were written before the deadline, false otherwise.
+ */
+bool sciSendDeadline(volatile tms570_reg* sci_lin_reg, uint32_t length, const uint8_t* data, uint32_t deadline, uint32_t* sent);
+
+/**
+ * @brief Receive bytes, waiting no longer than a deadline.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param length Number of bytes to receive.
+ * @param data Buffer for the received bytes.
+ * @param deadline Cycle counter deadline from sciCycleDeadline().
+ * @param received Pointer to store the number of bytes read.
+ * @return true if length bytes were read before the deadline, false otherwise.
+ */
+bool sciReceiveDeadline(volatile tms570_reg* sci_lin_reg, uint32_t length, uint8_t* data, uint32_t deadline, uint32_t* received);
+
+/**
+ * @brief Install the TX refill hook of an instance.
+ *
+ * There is one hook per instance; the module that installs it owns the
+ * interrupt-driven TX path.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param refill Hook to install, NULL to remove it.
+ * @return true if installed, false otherwise.
+ */
+bool sciSetTxRefill(volatile tms570_reg* sci_lin_reg, sci_tx_refill_t refill);
+
+/**
+ * @brief Start the interrupt-driven TX path if it is idle.
+ *
+ * Enables the TX interrupt; the interrupt handler then pulls chunks from the
+ * refill hook until it returns false.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if TX is running, false if no refill hook is installed.
+ */
+bool sciKickTx(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Compute the BRS value for a baud rate with integer arithmetic.
+ *
+ * Asynchronous timing divides one bit into 16 * (P + 1) + M VCLK cycles,
+ * isosynchronous timing into P + 1; the divisor is rounded to the nearest
+ * cycle.
+ *
+ * @param baud Baud rate in bit/s.
+ * @param async true for asynchronous timing (GCR1 TIMING_MODE set), false for isosynchronous.
+ * @param brs Pointer to store the BRS value.
+ * @return true if the baud rate is reachable from VCLK_FREQ, false otherwise.
+ */
+bool sciBaudrateToBrs(uint32_t baud, bool async, uint32_t* brs);
+
+/**
+ * @brief Change the baud rate of a running instance.
+ *
+ * Holds back the TX interrupt, waits for TX_EMPTY, then writes only BRS
+ * while SWnRST is low. Every other register, the interrupt enables and
+ * the software rings are left as they are, so bytes still queued go out at
+ * the new rate once the TX interrupt is restored. A byte being received
+ * during the switch is lost; switch at a quiet point of the protocol.
+ * Modules that derive timing from BRS, such as modbusRtuUpdateTiming(),
+ * are refreshed by the caller.
+ *
+ * @param sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param baud New baud rate in bit/s.
+ * @param deadline Cycle counter deadline from sciCycleDeadline() for TX_EMPTY.
+ * @return true if the new rate is active, false if it is unreachable or TX did not drain in time.
+ */
+bool sciSwitchBaudrate(volatile tms570_reg* sci_lin_reg, uint32_t baud, uint32_t deadline);
 #endif // SCI_LIN_UTILS_H
\ No newline at end of file
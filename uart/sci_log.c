@@ -0,0 +1,124 @@
+#include <stdatomic.h>
+#include "sci_log.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_cycle.h"
+
+/* Bits 15:0 of the reserve word: next slot to reserve. Bits 31:16: sequence number of the next record. */
+#define SCI_LOG_INDEX_MASK      (0xFFFFU)
+#define SCI_LOG_SEQUENCE_ONE    (0x10000U)
+
+static struct g_sciLog
+{
+    volatile uint32_t    slot[SCI_LOG_NUM_OF_SLOTS][SCI_LOG_SLOT_WORDS];   /* Header word 0 is non-zero once committed */
+    atomic_uint          reserve;                                       /* Next slot and sequence number, any context */
+    volatile uint32_t    tail;                                          /* Next slot to drain, written by the drain only */
+    atomic_uint          dropped;                                       /* Records lost to a full ring */
+    volatile tms570_reg* port;                                          /* Drain output */
+    uint8_t              staging[SCI_LOG_SLOT_WORDS * 4U];              /* Record being sent */
+    uint32_t             length;                                        /* Bytes in staging */
+    uint32_t             sent;                                          /* Bytes of staging already sent */
+} g_sciLog;
+
+bool sciLogInit(volatile tms570_reg* sci_lin_reg){
+    if (sciGetInstanceIndex(sci_lin_reg) >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    for (uint32_t slot = 0U; slot < SCI_LOG_NUM_OF_SLOTS; slot++){
+        g_sciLog.slot[slot][0] = 0U;
+    }
+    atomic_store(&g_sciLog.reserve, 0U);
+    atomic_store(&g_sciLog.dropped, 0U);
+    g_sciLog.tail = 0U;
+    g_sciLog.length = 0U;
+    g_sciLog.sent = 0U;
+    g_sciLog.port = sci_lin_reg;
+    sciCycleInit();
+    return (true);
+}
+
+bool sciLogWrite(const char* fmt, uint32_t nargs, const uint32_t* args){
+    if ((fmt == NULL) || (nargs > SCI_LOG_MAX_ARGS) || ((nargs != 0U) && (args == NULL))){
+        return (false);
+    }
+
+    // A dropped record still takes a sequence number, so the decoder sees the gap
+    unsigned int reserve = atomic_load_explicit(&g_sciLog.reserve, memory_order_relaxed);
+    unsigned int next;
+    bool         full;
+    do {
+        full = (((reserve - g_sciLog.tail) & SCI_LOG_INDEX_MASK) >= SCI_LOG_NUM_OF_SLOTS);
+        next = ((reserve & ~SCI_LOG_INDEX_MASK) + SCI_LOG_SEQUENCE_ONE) |
+               (full ? (reserve & SCI_LOG_INDEX_MASK) : ((reserve + 1U) & SCI_LOG_INDEX_MASK));
+    } while (!atomic_compare_exchange_weak_explicit(&g_sciLog.reserve, &reserve, next, memory_order_acquire, memory_order_relaxed));
+
+    if (full){
+        atomic_fetch_add_explicit(&g_sciLog.dropped, 1U, memory_order_relaxed);
+        return (false);
+    }
+
+    volatile uint32_t* slot = g_sciLog.slot[(reserve & SCI_LOG_INDEX_MASK) % SCI_LOG_NUM_OF_SLOTS];
+    slot[1] = (uint32_t)(uintptr_t)fmt;
+    slot[2] = sciCycleNow();
+    for (uint32_t i = 0U; i < nargs; i++){
+        slot[3U + i] = args[i];
+    }
+
+    // The header commits the record, the drain must not see it before the payload
+    atomic_thread_fence(memory_order_release);
+    slot[0] = (SCI_LOG_SYNC << 24U) | (nargs << 16U) | (reserve >> 16U);
+    return (true);
+}
+
+bool sciLogDrain(uint32_t max_records){
+    uint32_t records = 0U;
+
+    if (g_sciLog.port == NULL){
+        return (false);
+    }
+
+    for (;;){
+        if (g_sciLog.sent < g_sciLog.length){
+            uint32_t sent = 0U;
+            (void)sciTrySend(g_sciLog.port, g_sciLog.length - g_sciLog.sent, &g_sciLog.staging[g_sciLog.sent], &sent);
+            g_sciLog.sent += sent;
+            if (g_sciLog.sent < g_sciLog.length){
+                return (false);
+            }
+        }
+
+        volatile uint32_t* slot = g_sciLog.slot[g_sciLog.tail % SCI_LOG_NUM_OF_SLOTS];
+        uint32_t header = slot[0];
+        if (header == 0U){
+            // Empty, or reserved by a writer that has not committed yet
+            return ((g_sciLog.tail & SCI_LOG_INDEX_MASK) == (atomic_load_explicit(&g_sciLog.reserve, memory_order_relaxed) & SCI_LOG_INDEX_MASK));
+        }
+        if (records >= max_records){
+            return (false);
+        }
+        atomic_thread_fence(memory_order_acquire);
+
+        // Records go out big-endian regardless of the core's byte order
+        uint32_t words = 3U + GET_BITS(header, 16U, 8U);
+        for (uint32_t i = 0U; i < words; i++){
+            uint32_t word = slot[i];
+            g_sciLog.staging[(4U * i) + 0U] = (uint8_t)(word >> 24U);
+            g_sciLog.staging[(4U * i) + 1U] = (uint8_t)(word >> 16U);
+            g_sciLog.staging[(4U * i) + 2U] = (uint8_t)(word >> 8U);
+            g_sciLog.staging[(4U * i) + 3U] = (uint8_t)word;
+        }
+        g_sciLog.length = 4U * words;
+        g_sciLog.sent = 0U;
+
+        // Hand the slot back only after it has been copied out
+        slot[0] = 0U;
+        atomic_thread_fence(memory_order_release);
+        g_sciLog.tail++;
+        records++;
+    }
+}
+
+uint32_t sciLogGetDropped(void){
+    return atomic_load_explicit(&g_sciLog.dropped, memory_order_relaxed);
+}
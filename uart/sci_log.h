@@ -0,0 +1,85 @@
+#ifndef SCI_LOG_H
+#define SCI_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Record slots in the log ring, a power of two. */
+#define SCI_LOG_NUM_OF_SLOTS    (64U)
+
+/** @brief Argument words per record. */
+#define SCI_LOG_MAX_ARGS        (6U)
+
+/** @brief Words per record: header, format string address, timestamp and arguments. */
+#define SCI_LOG_SLOT_WORDS      (3U + SCI_LOG_MAX_ARGS)
+
+/** @brief Sync byte in bits 31:24 of every record header. */
+#define SCI_LOG_SYNC            (0xA5U)
+
+/**
+ * @brief Pass a constant string to a %s conversion of SCI_LOG().
+ *
+ * The record holds the string's address, which the decoder looks up in the
+ * ELF, so the string must have static storage.
+ */
+#define SCI_LOG_STR(s)          ((uint32_t)(uintptr_t)(s))
+
+/**
+ * @brief Log a message without formatting it on target.
+ *
+ * Only the address of the format string, a cycle timestamp and the argument
+ * words are stored; tools/sci_log_decode.py rebuilds the text from the ELF.
+ * Arguments are integers, or constant strings wrapped in SCI_LOG_STR() for
+ * %s, at most SCI_LOG_MAX_ARGS of them. Safe from tasks and interrupts.
+ */
+#define SCI_LOG(fmt, ...)                                                                                   \
+    do {                                                                                                    \
+        static const char s_sciLogFmt[] = fmt;                                                              \
+        const uint32_t s_sciLogArgs[] = { 0U, ##__VA_ARGS__ };                                              \
+        _Static_assert((sizeof(s_sciLogArgs) / sizeof(uint32_t)) <= (SCI_LOG_MAX_ARGS + 1U), "too many log arguments"); \
+        (void)sciLogWrite(s_sciLogFmt, (sizeof(s_sciLogArgs) / sizeof(uint32_t)) - 1U, &s_sciLogArgs[1]); \
+    } while (0)
+
+/**
+ * @brief Initialize the log ring and select the drain port.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base records are sent on.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool sciLogInit(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Store one record in the log ring, normally through SCI_LOG().
+ *
+ * Lock-free: a slot is reserved with a compare-and-swap on the reserve word, so
+ * an interrupt may log while the interrupted code is logging. A record
+ * dropped on a full ring still consumes a sequence number, so the decoder
+ * reports the gap.
+ *
+ * @param[in] fmt Format string, must have static storage.
+ * @param[in] nargs Number of argument words, at most SCI_LOG_MAX_ARGS.
+ * @param[in] args Argument words.
+ * @return true if stored, false if the ring was full and the record was dropped.
+ */
+bool sciLogWrite(const char* fmt, uint32_t nargs, const uint32_t* args);
+
+/**
+ * @brief Send pending records, from a background task.
+ *
+ * Never waits for the transmitter; a record that does not fit is continued
+ * on the next call.
+ *
+ * @param[in] max_records Maximum number of records to start in this call.
+ * @return true if the ring is empty afterwards, false otherwise.
+ */
+bool sciLogDrain(uint32_t max_records);
+
+/**
+ * @brief Get the number of records dropped because the ring was full.
+ *
+ * @return Dropped records since sciLogInit().
+ */
+uint32_t sciLogGetDropped(void);
+
+#endif // SCI_LOG_H
@@ -0,0 +1,61 @@
+#ifndef SCI_OS_H
+#define SCI_OS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_utils.h"
+
+/** @brief Timeout that never expires. */
+#define SCI_OS_WAIT_FOREVER     (0xFFFFFFFFU)
+
+/**
+ * @enum sci_os_event_e
+ * @brief Events of an SCI/LIN instance a task can sleep on.
+ */
+typedef enum sci_os_event_e {
+    SCI_OS_EVENT_TX = 0,        /** TX ring has room or has drained */
+    SCI_OS_EVENT_RX,            /** RX ring holds the bytes a reader waits for */
+    NUM_OF_SCI_OS_EVENT         /** Number of events */
+} sci_os_event_t;
+
+/**
+ * Porting interface of the blocking I/O layer, see sci_blocking.h.
+ *
+ * Each event is a binary signal with one waiting task: a signal raised
+ * while nobody waits is kept until the next wait, further signals are
+ * absorbed. A port maps this onto task notifications, binary semaphores or
+ * event flags of the RTOS; sci_os_pthread.c is the host port.
+ */
+
+/**
+ * @brief Create the events of every SCI/LIN instance.
+ *
+ * Called once at startup, before the scheduler hands out any blocking call.
+ *
+ * @return true if the events were created, false otherwise.
+ */
+bool sciOsInit(void);
+
+/**
+ * @brief Sleep until an event is signalled or the timeout expires.
+ *
+ * Task context only. Consumes the signal.
+ *
+ * @param[in] instance SCI/LIN instance index from sciGetInstanceIndex().
+ * @param[in] event Event to wait for. @see sci_os_event_t
+ * @param[in] timeout_us Timeout in microseconds, SCI_OS_WAIT_FOREVER to wait without limit.
+ * @return true if the event was signalled, false on timeout or invalid arguments.
+ */
+bool sciOsWait(uint32_t instance, sci_os_event_t event, uint32_t timeout_us);
+
+/**
+ * @brief Signal an event and wake its waiter.
+ *
+ * Callable from the TX and RX interrupts; must not block.
+ *
+ * @param[in] instance SCI/LIN instance index from sciGetInstanceIndex().
+ * @param[in] event Event to signal. @see sci_os_event_t
+ */
+void sciOsSignal(uint32_t instance, sci_os_event_t event);
+
+#endif // SCI_OS_H
@@ -0,0 +1,81 @@
+/* pthread_condattr_setclock(), clock_gettime() and CLOCK_MONOTONIC are POSIX, hidden under a strict -std=c11. */
+#define _POSIX_C_SOURCE 200112L
+
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include "sci_os.h"
+
+/* Host port: the "interrupts" are threads, so a mutex is as good as masking them. */
+static struct g_sciOs
+{
+    pthread_mutex_t mutex;      /* Guards pending */
+    pthread_cond_t  cond;       /* Broadcast when pending is set */
+    bool            pending;    /* Signalled and not yet consumed */
+} g_sciOs_t[SCI_LIN_NUM_OF_INSTANCES][NUM_OF_SCI_OS_EVENT];
+
+bool sciOsInit(void){
+    pthread_condattr_t attr;
+
+    // Timeouts run on CLOCK_MONOTONIC, like sciCycleNow() on a host build
+    if ((pthread_condattr_init(&attr) != 0) || (pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) != 0)){
+        return (false);
+    }
+
+    bool result = true;
+    for (uint32_t instance = 0U; instance < SCI_LIN_NUM_OF_INSTANCES; instance++){
+        for (uint32_t event = 0U; event < NUM_OF_SCI_OS_EVENT; event++){
+            struct g_sciOs* os = &g_sciOs_t[instance][event];
+            os->pending = false;
+            if ((pthread_mutex_init(&os->mutex, NULL) != 0) || (pthread_cond_init(&os->cond, &attr) != 0)){
+                result = false;
+            }
+        }
+    }
+    (void)pthread_condattr_destroy(&attr);
+    return (result);
+}
+
+bool sciOsWait(uint32_t instance, sci_os_event_t event, uint32_t timeout_us){
+    struct timespec until;
+
+    if ((instance >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(event, NUM_OF_SCI_OS_EVENT)){
+        return (false);
+    }
+
+    if (timeout_us != SCI_OS_WAIT_FOREVER){
+        clock_gettime(CLOCK_MONOTONIC, &until);
+        until.tv_sec += (time_t)(timeout_us / 1000000U);
+        until.tv_nsec += (long)(timeout_us % 1000000U) * 1000L;
+        if (until.tv_nsec >= 1000000000L){
+            until.tv_sec++;
+            until.tv_nsec -= 1000000000L;
+        }
+    }
+
+    struct g_sciOs* os = &g_sciOs_t[instance][event];
+    pthread_mutex_lock(&os->mutex);
+    while (!os->pending){
+        if (timeout_us == SCI_OS_WAIT_FOREVER){
+            pthread_cond_wait(&os->cond, &os->mutex);
+        } else if (pthread_cond_timedwait(&os->cond, &os->mutex, &until) == ETIMEDOUT){
+            break;
+        }
+    }
+    bool signalled = os->pending;
+    os->pending = false;
+    pthread_mutex_unlock(&os->mutex);
+    return (signalled);
+}
+
+void sciOsSignal(uint32_t instance, sci_os_event_t event){
+    if ((instance >= SCI_LIN_NUM_OF_INSTANCES) || !IS_ENUM_IN_RANGE(event, NUM_OF_SCI_OS_EVENT)){
+        return;
+    }
+
+    struct g_sciOs* os = &g_sciOs_t[instance][event];
+    pthread_mutex_lock(&os->mutex);
+    os->pending = true;
+    pthread_cond_broadcast(&os->cond);
+    pthread_mutex_unlock(&os->mutex);
+}
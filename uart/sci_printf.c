@@ -0,0 +1,306 @@
+#include <string.h>
+#include "sci_printf.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+/* Longest conversion before padding: sign, 10 digits, point and leading zero of %.9k. */
+#define SCI_PRINTF_NUM_LEN  (24U)
+
+typedef struct sci_printf_out_s {
+    sci_ring_t* ring;       /* Destination */
+    uint8_t*    region;     /* Reserved contiguous region */
+    uint32_t    avail;      /* Length of region */
+    uint32_t    used;       /* Bytes of region filled, not yet committed */
+    uint32_t    total;      /* Bytes committed or pending */
+    bool        full;       /* The ring ran out of space */
+} sci_printf_out_t;
+
+static const char s_sciPrintfDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char s_sciPrintfHexLower[] = "0123456789abcdef";
+static const char s_sciPrintfHexUpper[] = "0123456789ABCDEF";
+
+/* x / 100 as a multiply-high, exact for every 32-bit x; one UMULL instead of a division call. */
+static inline uint32_t sci_printf_div100(uint32_t x){
+    return (uint32_t)(((uint64_t)x * 0x51EB851FU) >> 37U);
+}
+
+/* Writes the digits of value backwards ending at end, two per step, and returns their count. */
+static uint32_t sci_printf_utoa(uint32_t value, char* end){
+    char* p = end;
+
+    while (value >= 100U){
+        uint32_t q = sci_printf_div100(value);
+        uint32_t r = 2U * (value - (q * 100U));
+        *--p = s_sciPrintfDigitPairs[r + 1U];
+        *--p = s_sciPrintfDigitPairs[r];
+        value = q;
+    }
+    if (value >= 10U){
+        *--p = s_sciPrintfDigitPairs[(2U * value) + 1U];
+        *--p = s_sciPrintfDigitPairs[2U * value];
+    } else {
+        *--p = (char)('0' + value);
+    }
+    return (uint32_t)(end - p);
+}
+
+static uint32_t sci_printf_xtoa(uint32_t value, char* end, const char* digits){
+    char* p = end;
+
+    do {
+        *--p = digits[value & 0xFU];
+        value >>= 4U;
+    } while (value != 0U);
+    return (uint32_t)(end - p);
+}
+
+/* Precision of an integer: pads the digits ending at end with zeros to precision, or drops a lone zero for precision 0. */
+static uint32_t sci_printf_min_digits(char* end, uint32_t length, uint32_t value, uint32_t precision){
+    // Leave room for the sign in the number buffer
+    precision = (precision < (SCI_PRINTF_NUM_LEN - 1U)) ? precision : (SCI_PRINTF_NUM_LEN - 1U);
+    if ((precision == 0U) && (value == 0U)){
+        return (0U);
+    }
+    while (length < precision){
+        end[-(int32_t)length - 1] = '0';
+        length++;
+    }
+    return (length);
+}
+
+static void sci_printf_commit(sci_printf_out_t* out){
+    sciRingCommit(out->ring, out->used);
+    out->used = 0U;
+    out->avail = 0U;
+}
+
+/* Fills the reserved region and moves to the next one; c != 0 repeats c instead of copying data. */
+static void sci_printf_emit(sci_printf_out_t* out, const char* data, char c, uint32_t length){
+    while ((length > 0U) && !out->full){
+        if (out->used == out->avail){
+            sci_printf_commit(out);
+            if (!sciRingReserve(out->ring, &out->region, &out->avail)){
+                out->full = true;
+                break;
+            }
+        }
+
+        uint32_t chunk = out->avail - out->used;
+        chunk = (length < chunk) ? length : chunk;
+        if (data != NULL){
+            memcpy(&out->region[out->used], data, chunk);
+            data += chunk;
+        } else {
+            memset(&out->region[out->used], c, chunk);
+        }
+        out->used += chunk;
+        out->total += chunk;
+        length -= chunk;
+    }
+}
+
+static void sci_printf_field(sci_printf_out_t* out, const char* text, uint32_t length, uint32_t width,
+                             bool left, bool zero, bool sign){
+    uint32_t pad = (width > length) ? (width - length) : 0U;
+
+    if (left){
+        sci_printf_emit(out, text, 0, length);
+        sci_printf_emit(out, NULL, ' ', pad);
+    } else if (zero){
+        // Zeros go between the sign and the digits
+        if (sign){
+            sci_printf_emit(out, text, 0, 1U);
+            text++;
+            length--;
+        }
+        sci_printf_emit(out, NULL, '0', pad);
+        sci_printf_emit(out, text, 0, length);
+    } else {
+        sci_printf_emit(out, NULL, ' ', pad);
+        sci_printf_emit(out, text, 0, length);
+    }
+}
+
+/* Fixed point: the integer digits are split at a constant position, so no division by 10^N is needed. */
+static uint32_t sci_printf_ktoa(uint32_t magnitude, uint32_t places, char* end){
+    uint32_t digits = sci_printf_utoa(magnitude, end);
+    char* start = end - digits;
+
+    if (places == 0U){
+        return (digits);
+    }
+    while (digits <= places){
+        *--start = '0';
+        digits++;
+    }
+    // Shift the integer part one to the left to make room for the point
+    memmove(start - 1, start, digits - places);
+    end[-(int32_t)places - 1] = '.';
+    return (digits + 1U);
+}
+
+uint32_t sciRingVPrintf(sci_ring_t* ring, const char* fmt, va_list args){
+    sci_printf_out_t out = { ring, NULL, 0U, 0U, 0U, false };
+    char number[SCI_PRINTF_NUM_LEN];
+    char* end = &number[SCI_PRINTF_NUM_LEN];
+
+    if ((ring == NULL) || (fmt == NULL)){
+        return (0U);
+    }
+
+    while ((*fmt != '\0') && !out.full){
+        // Copy literal runs in one go
+        const char* literal = fmt;
+        while ((*fmt != '\0') && (*fmt != '%')){
+            fmt++;
+        }
+        sci_printf_emit(&out, literal, 0, (uint32_t)(fmt - literal));
+        if (*fmt == '\0'){
+            break;
+        }
+        fmt++;
+
+        bool left = false;
+        bool zero = false;
+        for (;; fmt++){
+            if (*fmt == '-'){
+                left = true;
+            } else if (*fmt == '0'){
+                zero = true;
+            } else {
+                break;
+            }
+        }
+
+        uint32_t width = 0U;
+        if (*fmt == '*'){
+            int32_t w = va_arg(args, int32_t);
+            left = left || (w < 0);
+            width = (w < 0) ? (uint32_t)(-w) : (uint32_t)w;
+            fmt++;
+        }
+        while ((*fmt >= '0') && (*fmt <= '9')){
+            width = (width * 10U) + (uint32_t)(*fmt - '0');
+            fmt++;
+        }
+
+        bool has_precision = false;
+        uint32_t precision = 0U;
+        if (*fmt == '.'){
+            has_precision = true;
+            fmt++;
+            while ((*fmt >= '0') && (*fmt <= '9')){
+                precision = (precision * 10U) + (uint32_t)(*fmt - '0');
+                fmt++;
+            }
+        }
+        while ((*fmt == 'l') || (*fmt == 'h')){
+            fmt++;
+        }
+
+        uint32_t length;
+        switch (*fmt){
+        case 'd':
+        case 'i':
+        case 'k': {
+            int32_t value = va_arg(args, int32_t);
+            uint32_t magnitude = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+            if (*fmt == 'k'){
+                length = sci_printf_ktoa(magnitude, (precision > 9U) ? 9U : precision, end);
+            } else {
+                length = sci_printf_utoa(magnitude, end);
+                if (has_precision){
+                    length = sci_printf_min_digits(end, length, magnitude, precision);
+                }
+            }
+            if (value < 0){
+                end[-(int32_t)length - 1] = '-';
+                length++;
+            }
+            // As in C, a precision on an integer turns off the '0' flag
+            sci_printf_field(&out, end - length, length, width, left, zero && ((*fmt == 'k') || !has_precision), (value < 0));
+            break;
+        }
+        case 'u': {
+            uint32_t value = va_arg(args, uint32_t);
+            length = sci_printf_utoa(value, end);
+            if (has_precision){
+                length = sci_printf_min_digits(end, length, value, precision);
+            }
+            sci_printf_field(&out, end - length, length, width, left, zero && !has_precision, false);
+            break;
+        }
+        case 'x':
+        case 'X': {
+            uint32_t value = va_arg(args, uint32_t);
+            length = sci_printf_xtoa(value, end, (*fmt == 'x') ? s_sciPrintfHexLower : s_sciPrintfHexUpper);
+            if (has_precision){
+                length = sci_printf_min_digits(end, length, value, precision);
+            }
+            sci_printf_field(&out, end - length, length, width, left, zero && !has_precision, false);
+            break;
+        }
+        case 'p':
+            length = sci_printf_xtoa((uint32_t)(uintptr_t)va_arg(args, void*), end, s_sciPrintfHexLower);
+            sci_printf_field(&out, end - length, length, 8U, false, true, false);
+            break;
+        case 'c':
+            number[0] = (char)va_arg(args, int);
+            sci_printf_field(&out, number, 1U, width, left, false, false);
+            break;
+        case 's': {
+            const char* text = va_arg(args, const char*);
+            text = (text != NULL) ? text : "(null)";
+            length = 0U;
+            while ((text[length] != '\0') && (!has_precision || (length < precision))){
+                length++;
+            }
+            sci_printf_field(&out, text, length, width, left, false, false);
+            break;
+        }
+        case '%':
+            sci_printf_emit(&out, "%", 0, 1U);
+            break;
+        default:
+            // Unknown conversion: print it verbatim, and stop at a trailing '%'
+            if (*fmt == '\0'){
+                continue;
+            }
+            sci_printf_emit(&out, fmt - 1, 0, 2U);
+            break;
+        }
+        fmt++;
+    }
+
+    sci_printf_commit(&out);
+    return (out.total);
+}
+
+uint32_t sciVPrintf(volatile tms570_reg* sci_lin_reg, const char* fmt, va_list args){
+    uint32_t length = sciRingVPrintf(sciTxRingGet(sci_lin_reg), fmt, args);
+
+    if (length != 0U){
+        (void)sciTxRingKick(sci_lin_reg);
+    }
+    return (length);
+}
+
+uint32_t sciPrintf(volatile tms570_reg* sci_lin_reg, const char* fmt, ...){
+    va_list args;
+
+    va_start(args, fmt);
+    uint32_t length = sciVPrintf(sci_lin_reg, fmt, args);
+    va_end(args);
+    return (length);
+}
@@ -0,0 +1,52 @@
+#ifndef SCI_PRINTF_H
+#define SCI_PRINTF_H
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+#include "sci_ring.h"
+
+/**
+ * @brief Format into a byte ring.
+ *
+ * Supports %d %i %u %x %X %c %s %p %% with the '-' and '0' flags, a width
+ * (or '*') and a precision; 'l' and 'h' are accepted and ignored since all
+ * integers are 32-bit. The precision is the minimum number of digits for
+ * %d %i %u %x %X (at most 23) and the maximum length for %s, as in C.
+ * %.Nk prints a signed 32-bit fixed-point value with N decimal places
+ * (0 - 9), e.g. 12345 with %.2k gives 123.45.
+ *
+ * Text is copied into the ring in contiguous chunks. Output that does not fit
+ * is dropped; nothing waits and nothing is allocated. Reentrant as long as
+ * each ring has a single producer.
+ *
+ * @param[in] ring Ring to write.
+ * @param[in] fmt Format string.
+ * @param[in] args Arguments.
+ * @return Number of characters written to the ring.
+ */
+uint32_t sciRingVPrintf(sci_ring_t* ring, const char* fmt, va_list args);
+
+/**
+ * @brief Format into the TX ring of an instance and start transmission.
+ *
+ * @see sciRingVPrintf() for the supported conversions.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base, with a TX ring attached.
+ * @param[in] fmt Format string.
+ * @return Number of characters queued.
+ */
+uint32_t sciPrintf(volatile tms570_reg* sci_lin_reg, const char* fmt, ...);
+
+/**
+ * @brief va_list variant of sciPrintf().
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base, with a TX ring attached.
+ * @param[in] fmt Format string.
+ * @param[in] args Arguments.
+ * @return Number of characters queued.
+ */
+uint32_t sciVPrintf(volatile tms570_reg* sci_lin_reg, const char* fmt, va_list args);
+
+#endif // SCI_PRINTF_H
@@ -0,0 +1,325 @@
+#include <stdatomic.h>
+#include <string.h>
+#include "sci_ring.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_isr.h"
+#include "sci_stats.h"
+#include "sci_cycle.h"
+
+static struct g_sciTxRing
+{
+    sci_ring_t ring;            /* Producer: task, consumer: TX interrupt */
+    bool       attached;        /* sciTxRingInit() succeeded */
+    uint32_t   in_flight;       /* Bytes handed to the driver by the last refill */
+    volatile sci_ring_notify_t notify;  /* Told the free space after each refill */
+} g_sciTxRing_t[SCI_LIN_NUM_OF_INSTANCES];
+
+static struct g_sciRxRing
+{
+    sci_ring_t        ring;         /* Producer: RX interrupt, consumer: task */
+    bool              attached;     /* sciRxRingInit() succeeded */
+    volatile uint32_t overruns;     /* Bytes dropped on a full ring */
+    volatile uint32_t arrival;      /* Cycle count of the first byte of the current burst */
+    volatile uint32_t burst;        /* Ring position of that byte */
+    volatile sci_ring_notify_t notify;  /* Told the readable bytes after each byte */
+} g_sciRxRing_t[SCI_LIN_NUM_OF_INSTANCES];
+
+bool sciRingInit(sci_ring_t* ring, uint8_t* buffer, uint32_t size){
+    if ((ring == NULL) || (buffer == NULL) || (size == 0U) || ((size & (size - 1U)) != 0U)){
+        return (false);
+    }
+
+    ring->buffer = buffer;
+    ring->size = size;
+    ring->head = 0U;
+    ring->tail = 0U;
+    return (true);
+}
+
+uint32_t sciRingUsed(const sci_ring_t* ring){
+    return (ring->head - ring->tail);
+}
+
+uint32_t sciRingFree(const sci_ring_t* ring){
+    return (ring->size - (ring->head - ring->tail));
+}
+
+bool sciRingReserve(sci_ring_t* ring, uint8_t** data, uint32_t* length){
+    uint32_t head = ring->head;
+    uint32_t tail = ring->tail;
+    uint32_t offset = head & (ring->size - 1U);
+    uint32_t space = ring->size - (head - tail);
+    uint32_t contiguous = ring->size - offset;
+
+    // The consumer is done with everything before tail; no store into it may be hoisted above this load
+    atomic_thread_fence(memory_order_acquire);
+    *data = &ring->buffer[offset];
+    *length = (space < contiguous) ? space : contiguous;
+    return (*length != 0U);
+}
+
+bool sciRingCommit(sci_ring_t* ring, uint32_t length){
+    if (length > sciRingFree(ring)){
+        return (false);
+    }
+    // Volatile orders only volatile accesses: the payload stores must not sink below the head store
+    atomic_thread_fence(memory_order_release);
+    ring->head += length;
+    return (true);
+}
+
+bool sciRingPeek(sci_ring_t* ring, const uint8_t** data, uint32_t* length){
+    uint32_t tail = ring->tail;
+    uint32_t head = ring->head;
+    uint32_t offset = tail & (ring->size - 1U);
+    uint32_t used = head - tail;
+    uint32_t contiguous = ring->size - offset;
+
+    // Bytes before head are published; no payload load may be hoisted above this load
+    atomic_thread_fence(memory_order_acquire);
+    *data = &ring->buffer[offset];
+    *length = (used < contiguous) ? used : contiguous;
+    return (*length != 0U);
+}
+
+bool sciRingConsume(sci_ring_t* ring, uint32_t length){
+    if (length > sciRingUsed(ring)){
+        return (false);
+    }
+    // The payload loads complete before the producer may reuse the space
+    atomic_thread_fence(memory_order_release);
+    ring->tail += length;
+    return (true);
+}
+
+uint32_t sciRingWrite(sci_ring_t* ring, const uint8_t* data, uint32_t length){
+    uint32_t written = 0U;
+    uint8_t* region;
+    uint32_t region_length;
+
+    // At most two regions: up to the end of the buffer, then from its start
+    while ((written < length) && sciRingReserve(ring, &region, &region_length)){
+        uint32_t chunk = ((length - written) < region_length) ? (length - written) : region_length;
+        memcpy(region, &data[written], chunk);
+        sciRingCommit(ring, chunk);
+        written += chunk;
+    }
+    return (written);
+}
+
+uint32_t sciRingRead(sci_ring_t* ring, uint8_t* data, uint32_t length){
+    uint32_t read = 0U;
+    const uint8_t* region;
+    uint32_t region_length;
+
+    while ((read < length) && sciRingPeek(ring, &region, &region_length)){
+        uint32_t chunk = ((length - read) < region_length) ? (length - read) : region_length;
+        memcpy(&data[read], region, chunk);
+        sciRingConsume(ring, chunk);
+        read += chunk;
+    }
+    return (read);
+}
+
+/* Runs in the TX interrupt: the last chunk has left the ring storage once the next one is asked for. */
+static bool sci_tx_ring_refill(volatile tms570_reg* sci_lin_reg, const uint8_t** data, uint32_t* length){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    struct g_sciTxRing* tx = &g_sciTxRing_t[index];
+    sciRingConsume(&tx->ring, tx->in_flight);
+    tx->in_flight = 0U;
+
+    bool more = sciRingPeek(&tx->ring, data, length);
+    if (more){
+        tx->in_flight = *length;
+    }
+    // The chunk just handed out still occupies the ring, what is free now stays free
+    if (tx->notify != NULL){
+        tx->notify(sci_lin_reg, sciRingFree(&tx->ring));
+    }
+    return (more);
+}
+
+bool sciTxRingInit(volatile tms570_reg* sci_lin_reg, uint8_t* buffer, uint32_t size){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !sciRingInit(&g_sciTxRing_t[index].ring, buffer, size)){
+        return (false);
+    }
+
+    g_sciTxRing_t[index].in_flight = 0U;
+    g_sciTxRing_t[index].notify = NULL;
+    g_sciTxRing_t[index].attached = true;
+    return sciSetTxRefill(sci_lin_reg, sci_tx_ring_refill);
+}
+
+sci_ring_t* sciTxRingGet(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !g_sciTxRing_t[index].attached){
+        return (NULL);
+    }
+    return (&g_sciTxRing_t[index].ring);
+}
+
+bool sciTxRingKick(volatile tms570_reg* sci_lin_reg){
+    sci_ring_t* ring = sciTxRingGet(sci_lin_reg);
+
+    if (ring == NULL){
+        return (false);
+    }
+    // Zero-copy writers commit directly, the kick is where their fill level is seen
+    sciStatsHighWater(sci_lin_reg, SCI_STATS_TX_RING_HIGH_WATER, sciRingUsed(ring));
+    return sciKickTx(sci_lin_reg);
+}
+
+bool sciTxRingSetNotify(volatile tms570_reg* sci_lin_reg, sci_ring_notify_t notify){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !g_sciTxRing_t[index].attached){
+        return (false);
+    }
+    g_sciTxRing_t[index].notify = notify;
+    return (true);
+}
+
+uint32_t sciTxRingWrite(volatile tms570_reg* sci_lin_reg, const uint8_t* data, uint32_t length){
+    sci_ring_t* ring = sciTxRingGet(sci_lin_reg);
+
+    if ((ring == NULL) || (data == NULL)){
+        return (0U);
+    }
+
+    uint32_t written = sciRingWrite(ring, data, length);
+    sciStatsHighWater(sci_lin_reg, SCI_STATS_TX_RING_HIGH_WATER, sciRingUsed(ring));
+    if (written != 0U){
+        (void)sciKickTx(sci_lin_reg);
+    }
+    return (written);
+}
+
+/* RX vector handler: one byte per interrupt, straight into the ring. */
+static void sci_rx_ring_handler(volatile tms570_reg* sci_lin_reg, uint8_t vector){
+    // Reading RD clears the RX flag, so it happens even if the byte is dropped
+    uint8_t  byte = (uint8_t)GET_BITS(sci_lin_reg[TMS570_SCI_RD], TMS570_SCI_RD_RD_OFFSET, TMS570_SCI_RD_RD_BIT_LEN);
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+    uint8_t* region;
+    uint32_t region_length;
+
+    (void)vector;
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !g_sciRxRing_t[index].attached){
+        return;
+    }
+
+    struct g_sciRxRing* rx = &g_sciRxRing_t[index];
+    sciStatsAdd(sci_lin_reg, SCI_STATS_RX_BYTES, 1U);
+    if (sciRingReserve(&rx->ring, &region, &region_length)){
+        // The consumer leaves arrival alone while the ring holds data, so only the first byte of a burst is stamped
+        if (sciRingUsed(&rx->ring) == 0U){
+            rx->arrival = sciCycleNow();
+            rx->burst = rx->ring.head;
+        }
+        *region = byte;
+        sciRingCommit(&rx->ring, 1U);
+        sciStatsHighWater(sci_lin_reg, SCI_STATS_RX_RING_HIGH_WATER, sciRingUsed(&rx->ring));
+        if (rx->notify != NULL){
+            rx->notify(sci_lin_reg, sciRingUsed(&rx->ring));
+        }
+    } else {
+        rx->overruns++;
+    }
+}
+
+bool sciRxRingInit(volatile tms570_reg* sci_lin_reg, uint8_t* buffer, uint32_t size){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !sciRingInit(&g_sciRxRing_t[index].ring, buffer, size)){
+        return (false);
+    }
+
+    g_sciRxRing_t[index].overruns = 0U;
+    g_sciRxRing_t[index].notify = NULL;
+    g_sciRxRing_t[index].attached = false;
+    if (!sciIsrRegisterHandler(sci_lin_reg, SCI_INT_VECTOR_RX, sci_rx_ring_handler)){
+        return (false);
+    }
+    g_sciRxRing_t[index].attached = true;
+
+    // SET_INT is write-1-to-set, other enables are left untouched
+    tms570_write_register(&sci_lin_reg[TMS570_SCI_SET_INT], MAKE_MASK(TMS570_SCI_SET_INT_SET_RX_INT_OFFSET, TMS570_SCI_SET_INT_SET_RX_INT_BIT_LEN));
+    return (true);
+}
+
+sci_ring_t* sciRxRingGet(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !g_sciRxRing_t[index].attached){
+        return (NULL);
+    }
+    return (&g_sciRxRing_t[index].ring);
+}
+
+bool sciRxRingConsume(volatile tms570_reg* sci_lin_reg, uint32_t length){
+    uint32_t    index = sciGetInstanceIndex(sci_lin_reg);
+    sci_ring_t* ring = sciRxRingGet(sci_lin_reg);
+
+    if (ring == NULL){
+        return (false);
+    }
+
+    // A burst that started on an empty ring is being consumed: its first byte gives the latency
+    bool     stamped = (length != 0U) && (sciRingUsed(ring) != 0U) && (ring->tail == g_sciRxRing_t[index].burst);
+    uint32_t arrival = g_sciRxRing_t[index].arrival;
+    if (!sciRingConsume(ring, length)){
+        return (false);
+    }
+    if (stamped){
+        sciStatsRxLatency(sci_lin_reg, sciCycleNow() - arrival);
+    }
+    return (true);
+}
+
+uint32_t sciRxRingRead(volatile tms570_reg* sci_lin_reg, uint8_t* data, uint32_t length){
+    sci_ring_t*    ring = sciRxRingGet(sci_lin_reg);
+    uint32_t       read = 0U;
+    const uint8_t* region;
+    uint32_t       region_length;
+
+    if ((ring == NULL) || (data == NULL)){
+        return (0U);
+    }
+
+    while ((read < length) && sciRingPeek(ring, &region, &region_length)){
+        uint32_t chunk = ((length - read) < region_length) ? (length - read) : region_length;
+        memcpy(&data[read], region, chunk);
+        (void)sciRxRingConsume(sci_lin_reg, chunk);
+        read += chunk;
+    }
+    return (read);
+}
+
+bool sciRxRingSetNotify(volatile tms570_reg* sci_lin_reg, sci_ring_notify_t notify){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !g_sciRxRing_t[index].attached){
+        return (false);
+    }
+    g_sciRxRing_t[index].notify = notify;
+    return (true);
+}
+
+bool sciRxRingGetOverruns(volatile tms570_reg* sci_lin_reg, uint32_t* overruns){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (overruns == NULL)){
+        return (false);
+    }
+
+    *overruns = g_sciRxRing_t[index].overruns;
+    return (true);
+}
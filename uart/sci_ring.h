@@ -0,0 +1,230 @@
+#ifndef SCI_RING_H
+#define SCI_RING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/**
+ * @struct sci_ring_s
+ * @brief Single-producer single-consumer byte ring.
+ *
+ * head and tail are free-running; only the producer writes head and only the
+ * consumer writes tail, so an interrupt and a task can share a ring without
+ * locking. Index updates are fenced against the payload copies, which also
+ * covers two threads of a host build.
+ */
+typedef struct sci_ring_s {
+    uint8_t*          buffer;   /** Storage, size bytes */
+    uint32_t          size;     /** Capacity, a power of two */
+    volatile uint32_t head;     /** Bytes ever written, producer only */
+    volatile uint32_t tail;     /** Bytes ever read, consumer only */
+} sci_ring_t;
+
+/**
+ * @brief Ring level callback, runs in interrupt context.
+ *
+ * Called by the RX interrupt after each byte with the bytes now readable,
+ * and by the TX interrupt after each chunk with the bytes now free.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] level Readable bytes on the RX ring, free bytes on the TX ring.
+ */
+typedef void (*sci_ring_notify_t)(volatile tms570_reg* sci_lin_reg, uint32_t level);
+
+/**
+ * @brief Initialize a ring over caller-provided storage.
+ *
+ * @param[out] ring Ring to initialize.
+ * @param[in] buffer Storage for the ring.
+ * @param[in] size Size of buffer in bytes, a power of two.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool sciRingInit(sci_ring_t* ring, uint8_t* buffer, uint32_t size);
+
+/**
+ * @brief Get the number of bytes that can be read.
+ *
+ * @param[in] ring Ring to query.
+ * @return Readable bytes.
+ */
+uint32_t sciRingUsed(const sci_ring_t* ring);
+
+/**
+ * @brief Get the number of bytes that can be written.
+ *
+ * @param[in] ring Ring to query.
+ * @return Writable bytes.
+ */
+uint32_t sciRingFree(const sci_ring_t* ring);
+
+/**
+ * @brief Copy bytes into the ring, producer side.
+ *
+ * @param[in] ring Ring to write.
+ * @param[in] data Bytes to write.
+ * @param[in] length Number of bytes to write.
+ * @return Number of bytes written, less than length if the ring filled up.
+ */
+uint32_t sciRingWrite(sci_ring_t* ring, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Copy bytes out of the ring, consumer side.
+ *
+ * @param[in] ring Ring to read.
+ * @param[out] data Buffer for the bytes.
+ * @param[in] length Maximum number of bytes to read.
+ * @return Number of bytes read.
+ */
+uint32_t sciRingRead(sci_ring_t* ring, uint8_t* data, uint32_t length);
+
+/**
+ * @brief Get the contiguous writable region without copying, producer side.
+ *
+ * @param[in] ring Ring to write.
+ * @param[out] data Pointer to store the start of the region.
+ * @param[out] length Pointer to store the region length.
+ * @return true if the region is not empty, false otherwise.
+ */
+bool sciRingReserve(sci_ring_t* ring, uint8_t** data, uint32_t* length);
+
+/**
+ * @brief Publish bytes written into a reserved region, producer side.
+ *
+ * @param[in] ring Ring to write.
+ * @param[in] length Number of bytes written, at most the reserved length.
+ * @return true if committed, false otherwise.
+ */
+bool sciRingCommit(sci_ring_t* ring, uint32_t length);
+
+/**
+ * @brief Get the contiguous readable region without copying, consumer side.
+ *
+ * @param[in] ring Ring to read.
+ * @param[out] data Pointer to store the start of the region.
+ * @param[out] length Pointer to store the region length.
+ * @return true if the region is not empty, false otherwise.
+ */
+bool sciRingPeek(sci_ring_t* ring, const uint8_t** data, uint32_t* length);
+
+/**
+ * @brief Release bytes obtained with sciRingPeek(), consumer side.
+ *
+ * @param[in] ring Ring to read.
+ * @param[in] length Number of bytes consumed, at most the peeked length.
+ * @return true if consumed, false otherwise.
+ */
+bool sciRingConsume(sci_ring_t* ring, uint32_t length);
+
+/**
+ * @brief Attach a TX ring to an SCI/LIN instance.
+ *
+ * Installs the TX refill hook, so the TX interrupt drains the ring in
+ * contiguous chunks. The task side is the only producer.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] buffer Storage for the ring.
+ * @param[in] size Size of buffer in bytes, a power of two.
+ * @return true if attached, false otherwise.
+ */
+bool sciTxRingInit(volatile tms570_reg* sci_lin_reg, uint8_t* buffer, uint32_t size);
+
+/**
+ * @brief Get the TX ring of an instance for zero-copy writers.
+ *
+ * Bytes committed to the ring are sent after the next sciTxRingKick().
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return The TX ring, NULL if none is attached.
+ */
+sci_ring_t* sciTxRingGet(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Start transmission of committed bytes.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if TX is running, false otherwise.
+ */
+bool sciTxRingKick(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Queue bytes on the TX ring and start transmission.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] data Bytes to send.
+ * @param[in] length Number of bytes to send.
+ * @return Number of bytes queued, less than length if the ring filled up.
+ */
+uint32_t sciTxRingWrite(volatile tms570_reg* sci_lin_reg, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Install the level callback of the TX ring.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] notify Callback to install, NULL to remove it. @see sci_ring_notify_t
+ * @return true if installed, false if no TX ring is attached.
+ */
+bool sciTxRingSetNotify(volatile tms570_reg* sci_lin_reg, sci_ring_notify_t notify);
+
+/**
+ * @brief Attach an RX ring to an SCI/LIN instance.
+ *
+ * Takes over the RX interrupt vector and enables the RX interrupt; every
+ * received byte is appended to the ring. The task side is the only consumer.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] buffer Storage for the ring.
+ * @param[in] size Size of buffer in bytes, a power of two.
+ * @return true if attached, false otherwise.
+ */
+bool sciRxRingInit(volatile tms570_reg* sci_lin_reg, uint8_t* buffer, uint32_t size);
+
+/**
+ * @brief Get the RX ring of an instance for zero-copy readers.
+ *
+ * Zero-copy readers peek the ring directly but release bytes through
+ * sciRxRingConsume(), so the RX latency statistic sees every consumer.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return The RX ring, NULL if none is attached.
+ */
+sci_ring_t* sciRxRingGet(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Release bytes of the RX ring and record the RX latency of a new burst.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] length Number of bytes consumed, at most the bytes readable.
+ * @return true if consumed, false otherwise.
+ */
+bool sciRxRingConsume(volatile tms570_reg* sci_lin_reg, uint32_t length);
+
+/**
+ * @brief Copy received bytes out of the RX ring.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] data Buffer for the bytes.
+ * @param[in] length Maximum number of bytes to read.
+ * @return Number of bytes read.
+ */
+uint32_t sciRxRingRead(volatile tms570_reg* sci_lin_reg, uint8_t* data, uint32_t length);
+
+/**
+ * @brief Install the level callback of the RX ring.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] notify Callback to install, NULL to remove it. @see sci_ring_notify_t
+ * @return true if installed, false if no RX ring is attached.
+ */
+bool sciRxRingSetNotify(volatile tms570_reg* sci_lin_reg, sci_ring_notify_t notify);
+
+/**
+ * @brief Get the number of bytes dropped because the RX ring was full.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] overruns Pointer to store the count.
+ * @return true if the count was read, false otherwise.
+ */
+bool sciRxRingGetOverruns(volatile tms570_reg* sci_lin_reg, uint32_t* overruns);
+
+#endif // SCI_RING_H
@@ -0,0 +1,98 @@
+#include "sci_sg.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+static volatile struct g_sciSg
+{
+    sci_sg_segment_t queue[SCI_SG_QUEUE_LEN];   /* Descriptor ring */
+    uint32_t         head;                      /* Next free slot, written by sciSgSend() only */
+    uint32_t         tail;                      /* Oldest unreleased slot, written by the ISR only */
+    bool             in_flight;                 /* queue[tail] is being transmitted */
+} g_sciSg_t[SCI_LIN_NUM_OF_INSTANCES];
+
+static void sci_sg_release(volatile tms570_reg* sci_lin_reg, volatile struct g_sciSg* sg){
+    volatile sci_sg_segment_t* slot = &sg->queue[sg->tail % SCI_SG_QUEUE_LEN];
+    sci_sg_segment_t segment = { slot->data, slot->length, slot->release, slot->context };
+
+    // The slot is free again once tail moves past it, the callback gets a copy
+    sg->tail++;
+    if (segment.release != NULL){
+        segment.release(sci_lin_reg, &segment);
+    }
+}
+
+/* Runs in the TX interrupt: the previous segment is fully in the transmitter once the next one is asked for. */
+static bool sci_sg_refill(volatile tms570_reg* sci_lin_reg, const uint8_t** data, uint32_t* length){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile struct g_sciSg* sg = &g_sciSg_t[index];
+    if (sg->in_flight){
+        sg->in_flight = false;
+        sci_sg_release(sci_lin_reg, sg);
+    }
+
+    while (sg->tail != sg->head){
+        volatile sci_sg_segment_t* segment = &sg->queue[sg->tail % SCI_SG_QUEUE_LEN];
+        if (segment->length != 0U){
+            *data = segment->data;
+            *length = segment->length;
+            sg->in_flight = true;
+            return (true);
+        }
+        // Nothing to send, but the owner still expects its release
+        sci_sg_release(sci_lin_reg, sg);
+    }
+    return (false);
+}
+
+bool sciSgInit(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    g_sciSg_t[index].head = 0U;
+    g_sciSg_t[index].tail = 0U;
+    g_sciSg_t[index].in_flight = false;
+    return sciSetTxRefill(sci_lin_reg, sci_sg_refill);
+}
+
+bool sciSgSend(volatile tms570_reg* sci_lin_reg, const sci_sg_segment_t* segments, uint32_t count){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (segments == NULL) || (count == 0U)){
+        return (false);
+    }
+
+    volatile struct g_sciSg* sg = &g_sciSg_t[index];
+    uint32_t head = sg->head;
+    if ((SCI_SG_QUEUE_LEN - (head - sg->tail)) < count){
+        return (false);
+    }
+
+    for (uint32_t i = 0U; i < count; i++){
+        volatile sci_sg_segment_t* slot = &sg->queue[(head + i) % SCI_SG_QUEUE_LEN];
+        slot->data = segments[i].data;
+        slot->length = segments[i].length;
+        slot->release = segments[i].release;
+        slot->context = segments[i].context;
+    }
+
+    // Publish the descriptors only once they are complete
+    sg->head = head + count;
+    return sciKickTx(sci_lin_reg);
+}
+
+bool sciSgIsIdle(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (true);
+    }
+    return (g_sciSg_t[index].tail == g_sciSg_t[index].head);
+}
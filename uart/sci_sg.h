@@ -0,0 +1,67 @@
+#ifndef SCI_SG_H
+#define SCI_SG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Segment descriptors queued per instance. */
+#define SCI_SG_QUEUE_LEN    (16U)
+
+struct sci_sg_segment_s;
+
+/**
+ * @brief Segment release callback.
+ *
+ * Called from the TX interrupt once the last byte of the segment has been
+ * handed to the transmitter; the buffer may be reused from then on.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] segment Descriptor of the released segment.
+ */
+typedef void (*sci_sg_release_t)(volatile tms570_reg* sci_lin_reg, const struct sci_sg_segment_s* segment);
+
+/**
+ * @struct sci_sg_segment_s
+ * @brief One (pointer, length) segment of a frame.
+ */
+typedef struct sci_sg_segment_s {
+    const uint8_t*   data;      /** Segment bytes, not copied, must stay valid until released */
+    uint32_t         length;    /** Segment length in bytes */
+    sci_sg_release_t release;   /** Release callback, may be NULL */
+    void*            context;   /** Caller data passed back with the descriptor */
+} sci_sg_segment_t;
+
+/**
+ * @brief Initialize scatter-gather TX of an SCI/LIN instance.
+ *
+ * Installs the TX refill hook, so the instance must be set up for
+ * interrupt-driven TX.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if initialized successfully, false otherwise.
+ */
+bool sciSgInit(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Queue a list of segments for transmission without copying them.
+ *
+ * The descriptors are copied into the queue, the data is not. Either all
+ * segments are queued or none.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] segments Segment descriptors, sent in order.
+ * @param[in] count Number of segments.
+ * @return true if queued, false if the queue has no room for all of them.
+ */
+bool sciSgSend(volatile tms570_reg* sci_lin_reg, const sci_sg_segment_t* segments, uint32_t count);
+
+/**
+ * @brief Check whether every queued segment has been released.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if the queue is empty, false otherwise.
+ */
+bool sciSgIsIdle(volatile tms570_reg* sci_lin_reg);
+
+#endif // SCI_SG_H
@@ -0,0 +1,84 @@
+#include "sci_stats.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+static volatile sci_stats_t g_sciStats_t[SCI_LIN_NUM_OF_INSTANCES];
+
+uint32_t sciStatsBucket(uint32_t value){
+    return ((value == 0U) ? 0U : (32U - (uint32_t)__builtin_clz(value)));
+}
+
+void sciStatsCopy(uint32_t* destination, volatile const uint32_t* source, uint32_t words){
+    for (uint32_t i = 0U; i < words; i++){
+        destination[i] = source[i];
+    }
+}
+
+bool sciStatsReset(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index >= SCI_LIN_NUM_OF_INSTANCES){
+        return (false);
+    }
+
+    volatile uint32_t* word = (volatile uint32_t*)&g_sciStats_t[index];
+    for (uint32_t i = 0U; i < (sizeof(sci_stats_t) / sizeof(uint32_t)); i++){
+        word[i] = 0U;
+    }
+    return (true);
+}
+
+void sciStatsAdd(volatile tms570_reg* sci_lin_reg, sci_stats_counter_t counter, uint32_t value){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index < SCI_LIN_NUM_OF_INSTANCES) && IS_ENUM_IN_RANGE(counter, NUM_OF_SCI_STATS_COUNTER)){
+        g_sciStats_t[index].counter[counter] += value;
+    }
+}
+
+void sciStatsHighWater(volatile tms570_reg* sci_lin_reg, sci_stats_counter_t counter, uint32_t level){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index < SCI_LIN_NUM_OF_INSTANCES) && IS_ENUM_IN_RANGE(counter, NUM_OF_SCI_STATS_COUNTER) &&
+        (level > g_sciStats_t[index].counter[counter])){
+        g_sciStats_t[index].counter[counter] = level;
+    }
+}
+
+void sciStatsIsr(volatile tms570_reg* sci_lin_reg, sci_int_line_t line, uint32_t cycles){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    // The lines nest, so each has its own entry counter and histogram
+    if ((index < SCI_LIN_NUM_OF_INSTANCES) && IS_ENUM_IN_RANGE(line, NUM_OF_SCI_INT_LINE)){
+        g_sciStats_t[index].isr_entries[line]++;
+        g_sciStats_t[index].isr_cycles[line][sciStatsBucket(cycles)]++;
+    }
+}
+
+void sciStatsVector(volatile tms570_reg* sci_lin_reg, uint8_t vector){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    // A source is routed to one line only, so each vector has a single writer
+    if ((index < SCI_LIN_NUM_OF_INSTANCES) && (vector < SCI_ISR_NUM_OF_VECTORS)){
+        g_sciStats_t[index].vector[vector]++;
+    }
+}
+
+void sciStatsRxLatency(volatile tms570_reg* sci_lin_reg, uint32_t cycles){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if (index < SCI_LIN_NUM_OF_INSTANCES){
+        g_sciStats_t[index].rx_latency_cycles[sciStatsBucket(cycles)]++;
+    }
+}
+
+bool sciStatsSnapshot(volatile tms570_reg* sci_lin_reg, sci_stats_t* stats){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (stats == NULL)){
+        return (false);
+    }
+
+    sciStatsCopy((uint32_t*)stats, (volatile const uint32_t*)&g_sciStats_t[index], sizeof(sci_stats_t) / sizeof(uint32_t));
+    return (true);
+}
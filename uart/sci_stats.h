@@ -0,0 +1,132 @@
+#ifndef SCI_STATS_H
+#define SCI_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+#include "sci_isr.h"
+
+/** @brief Histogram buckets: bucket 0 counts zero, bucket n counts [2^(n-1), 2^n). */
+#define SCI_STATS_HIST_BUCKETS  (33U)
+
+/**
+ * @enum sci_stats_counter_e
+ * @brief Free-running counters of an instance.
+ *
+ * Every counter has a single writer context, noted below, so increments
+ * need no locking; they wrap, so compare deltas between snapshots.
+ */
+typedef enum sci_stats_counter_e {
+    SCI_STATS_TX_BYTES = 0,         /** Bytes written to TD by the TX interrupt */
+    SCI_STATS_TX_POLLED_BYTES,      /** Bytes written to TD by polled sends, task */
+    SCI_STATS_RX_BYTES,             /** Bytes read from RD by RX interrupt handlers */
+    SCI_STATS_RX_POLLED_BYTES,      /** Bytes read from RD by polled receives, task */
+    SCI_STATS_TX_FRAMES,            /** Frames sent by framing and protocol layers, task */
+    SCI_STATS_RX_FRAMES,            /** Frames accepted by framing and protocol layers, task */
+    SCI_STATS_TXRDY_WAIT_CYCLES,    /** Cycles polled sends spent waiting for TXRDY, task */
+    SCI_STATS_TX_RING_HIGH_WATER,   /** Most bytes queued on the TX ring, task */
+    SCI_STATS_RX_RING_HIGH_WATER,   /** Most bytes waiting on the RX ring, RX interrupt */
+    NUM_OF_SCI_STATS_COUNTER        /** Number of counters */
+} sci_stats_counter_t;
+
+/**
+ * @struct sci_stats_s
+ * @brief Statistics block of an instance.
+ *
+ * A high TXRDY wait and full rings point to a line-bound port, long ISR
+ * durations and consumer latencies to a CPU-bound one.
+ */
+typedef struct sci_stats_s {
+    uint32_t counter[NUM_OF_SCI_STATS_COUNTER];                         /** @see sci_stats_counter_t */
+    uint32_t isr_entries[NUM_OF_SCI_INT_LINE];                          /** sciIsrDispatch() calls per line */
+    uint32_t vector[SCI_ISR_NUM_OF_VECTORS];                            /** Dispatches per vector offset, every FLR error class included */
+    uint32_t isr_cycles[NUM_OF_SCI_INT_LINE][SCI_STATS_HIST_BUCKETS];   /** ISR duration per line */
+    uint32_t rx_latency_cycles[SCI_STATS_HIST_BUCKETS];                 /** RX ring arrival to sciRxRingConsume(), first byte of each burst */
+} sci_stats_t;
+
+/**
+ * @brief Clear the statistics of an instance.
+ *
+ * Not synchronized with the writers; call before traffic starts.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @return true if cleared, false otherwise.
+ */
+bool sciStatsReset(volatile tms570_reg* sci_lin_reg);
+
+/**
+ * @brief Add to a counter; only from the writer context of the counter.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] counter Counter to add to. @see sci_stats_counter_t
+ * @param[in] value Amount to add.
+ */
+void sciStatsAdd(volatile tms570_reg* sci_lin_reg, sci_stats_counter_t counter, uint32_t value);
+
+/**
+ * @brief Raise a high-water counter; only from the writer context of the counter.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] counter SCI_STATS_TX_RING_HIGH_WATER or SCI_STATS_RX_RING_HIGH_WATER.
+ * @param[in] level Current fill level.
+ */
+void sciStatsHighWater(volatile tms570_reg* sci_lin_reg, sci_stats_counter_t counter, uint32_t level);
+
+/**
+ * @brief Record one dispatcher run, called by sciIsrDispatch().
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] line Interrupt line. @see sci_int_line_t
+ * @param[in] cycles Duration of the run.
+ */
+void sciStatsIsr(volatile tms570_reg* sci_lin_reg, sci_int_line_t line, uint32_t cycles);
+
+/**
+ * @brief Count one dispatched vector, called by sciIsrDispatch().
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] vector Vector offset.
+ */
+void sciStatsVector(volatile tms570_reg* sci_lin_reg, uint8_t vector);
+
+/**
+ * @brief Record a byte-to-consumer latency, RX ring consumer only.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] cycles Cycles from arrival on the ring to consumption.
+ */
+void sciStatsRxLatency(volatile tms570_reg* sci_lin_reg, uint32_t cycles);
+
+/**
+ * @brief Histogram bucket of a value, for every histogram laid out like sci_stats_t.
+ *
+ * @param[in] value Value to count, e.g. cycles.
+ * @return Bit length of value, 0 - 32. @see SCI_STATS_HIST_BUCKETS
+ */
+uint32_t sciStatsBucket(uint32_t value);
+
+/**
+ * @brief Copy counters an interrupt is updating, one word at a time.
+ *
+ * Shared by every statistics snapshot in the driver: each 32-bit value is
+ * read in one aligned access and cannot be torn.
+ *
+ * @param[out] destination Copy of the counters.
+ * @param[in] source Counters being updated.
+ * @param[in] words Number of 32-bit words to copy.
+ */
+void sciStatsCopy(uint32_t* destination, volatile const uint32_t* source, uint32_t words);
+
+/**
+ * @brief Copy the statistics of an instance without stopping the writers.
+ *
+ * Each value is read in one access, so none is torn; values may come
+ * from slightly different moments.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] stats Pointer to store the snapshot. @see sci_stats_t
+ * @return true if the snapshot was taken, false otherwise.
+ */
+bool sciStatsSnapshot(volatile tms570_reg* sci_lin_reg, sci_stats_t* stats);
+
+#endif // SCI_STATS_H
@@ -0,0 +1,57 @@
+#include "sci_trace.h"
+
+#if SCI_TRACE_ENABLE
+
+#include <stdatomic.h>
+#include "sci_cycle.h"
+
+_Static_assert((SCI_TRACE_NUM_OF_RECORDS & (SCI_TRACE_NUM_OF_RECORDS - 1U)) == 0U, "SCI_TRACE_NUM_OF_RECORDS must be a power of two");
+
+/* Exported under a fixed name so a debugger can dump it: dump binary memory trace.bin &g_sciTrace (&g_sciTrace + 1) */
+volatile sci_trace_ring_t g_sciTrace;
+
+void sciTraceInit(void){
+    sciCycleInit();
+    g_sciTrace.frozen = 1U;
+    for (uint32_t i = 0U; i < SCI_TRACE_NUM_OF_RECORDS; i++){
+        g_sciTrace.record[i].valid = 0U;
+    }
+    atomic_store_explicit(&g_sciTrace.written, 0U, memory_order_relaxed);
+    g_sciTrace.size = SCI_TRACE_NUM_OF_RECORDS;
+    g_sciTrace.magic = SCI_TRACE_MAGIC;
+    g_sciTrace.frozen = 0U;
+}
+
+void sciTraceRecord(sci_trace_point_t point, sci_trace_phase_t phase, uint32_t instance){
+    uint32_t cycles = sciCycleNow();
+
+    if (g_sciTrace.frozen != 0U){
+        return;
+    }
+
+    // The slot is ours once reserved; a nested interrupt simply takes the next one,
+    // so slot order is not time order and the export tool sorts by timestamp
+    uint32_t slot = atomic_fetch_add_explicit(&g_sciTrace.written, 1U, memory_order_relaxed);
+    volatile sci_trace_record_t* record = &g_sciTrace.record[slot & (SCI_TRACE_NUM_OF_RECORDS - 1U)];
+
+    record->valid = 0U;
+    record->cycles = cycles;
+    record->point = (uint8_t)point;
+    record->phase = (uint8_t)phase;
+    record->instance = (uint8_t)instance;
+    record->valid = 1U;
+}
+
+void sciTraceGioHook(bool enter){
+    sciTraceRecord(SCI_TRACE_POINT_GIO_DISPATCH, enter ? SCI_TRACE_PHASE_ENTER : SCI_TRACE_PHASE_EXIT, SCI_TRACE_NO_INSTANCE);
+}
+
+void sciTraceFreeze(bool frozen){
+    g_sciTrace.frozen = frozen ? 1U : 0U;
+}
+
+const sci_trace_ring_t* sciTraceGet(void){
+    return ((const sci_trace_ring_t*)&g_sciTrace);
+}
+
+#endif // SCI_TRACE_ENABLE
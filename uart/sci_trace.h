@@ -0,0 +1,124 @@
+#ifndef SCI_TRACE_H
+#define SCI_TRACE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Build switch: 0 compiles every trace point to nothing. */
+#ifndef SCI_TRACE_ENABLE
+#define SCI_TRACE_ENABLE            (0)
+#endif
+
+/** @brief Records kept in the trace ring, a power of two; older ones are overwritten. */
+#ifndef SCI_TRACE_NUM_OF_RECORDS
+#define SCI_TRACE_NUM_OF_RECORDS    (512U)
+#endif
+
+/** @brief First word of the ring, lets tools/sci_trace_export.py find and check a memory dump. */
+#define SCI_TRACE_MAGIC             (0x54524353U)
+
+/** @brief Instance number of trace points not tied to an SCI/LIN instance. */
+#define SCI_TRACE_NO_INSTANCE       (0xFFU)
+
+/**
+ * @enum sci_trace_point_e
+ * @brief Instrumented code regions; the export tool names them in the same order.
+ */
+typedef enum sci_trace_point_e {
+    SCI_TRACE_POINT_SEND = 0,       /** sciSend() */
+    SCI_TRACE_POINT_RECEIVE,        /** sciReceive() */
+    SCI_TRACE_POINT_ISR_LINE_0,     /** sciIsrDispatch() on INT0 */
+    SCI_TRACE_POINT_ISR_LINE_1,     /** sciIsrDispatch() on INT1 */
+    SCI_TRACE_POINT_GIO_DISPATCH,   /** gio_get_pending_irq(), through sciTraceGioHook() */
+    NUM_OF_SCI_TRACE_POINT          /** Number of trace points */
+} sci_trace_point_t;
+
+/**
+ * @enum sci_trace_phase_e
+ * @brief Record kinds.
+ */
+typedef enum sci_trace_phase_e {
+    SCI_TRACE_PHASE_ENTER = 0,      /** Region entered */
+    SCI_TRACE_PHASE_EXIT,           /** Region left */
+    NUM_OF_SCI_TRACE_PHASE          /** Number of record kinds */
+} sci_trace_phase_t;
+
+/**
+ * @struct sci_trace_record_s
+ * @brief One trace record, 8 bytes.
+ */
+typedef struct sci_trace_record_s {
+    uint32_t cycles;                /** sciCycleNow() at the trace point */
+    uint8_t  point;                 /** @see sci_trace_point_t */
+    uint8_t  phase;                 /** @see sci_trace_phase_t */
+    uint8_t  instance;              /** SCI/LIN instance index or SCI_TRACE_NO_INSTANCE */
+    uint8_t  valid;                 /** 1 once the record is complete */
+} sci_trace_record_t;
+
+/**
+ * @struct sci_trace_ring_s
+ * @brief Trace ring, laid out for a raw memory dump.
+ */
+typedef struct sci_trace_ring_s {
+    uint32_t           magic;                               /** SCI_TRACE_MAGIC once initialized */
+    uint32_t           size;                                /** SCI_TRACE_NUM_OF_RECORDS */
+    atomic_uint        written;                             /** Records ever reserved, the oldest is at written % size once wrapped */
+    uint32_t           frozen;                              /** Non-zero stops recording */
+    sci_trace_record_t record[SCI_TRACE_NUM_OF_RECORDS];    /** Records */
+} sci_trace_ring_t;
+
+#if SCI_TRACE_ENABLE
+#define SCI_TRACE_ENTER(point, instance)    sciTraceRecord((point), SCI_TRACE_PHASE_ENTER, (instance))
+#define SCI_TRACE_EXIT(point, instance)     sciTraceRecord((point), SCI_TRACE_PHASE_EXIT, (instance))
+#else
+// Arguments are not evaluated, so instance lookups cost nothing either
+#define SCI_TRACE_ENTER(point, instance)    ((void)0)
+#define SCI_TRACE_EXIT(point, instance)     ((void)0)
+#endif
+
+#if SCI_TRACE_ENABLE
+
+/**
+ * @brief Clear the trace ring and start the cycle counter.
+ */
+void sciTraceInit(void);
+
+/**
+ * @brief Append one record; safe from tasks and nested interrupts.
+ *
+ * Use through SCI_TRACE_ENTER() and SCI_TRACE_EXIT().
+ *
+ * @param[in] point Code region. @see sci_trace_point_t
+ * @param[in] phase Enter or exit. @see sci_trace_phase_t
+ * @param[in] instance SCI/LIN instance index or SCI_TRACE_NO_INSTANCE.
+ */
+void sciTraceRecord(sci_trace_point_t point, sci_trace_phase_t phase, uint32_t instance);
+
+/**
+ * @brief GIO dispatch hook, install with gio_set_trace_hook(sciTraceGioHook).
+ *
+ * Keeps the GIO driver free of any dependency on the UART layer. The GIO
+ * driver must be built with GIO_TRACE_HOOK set for the hook to exist.
+ *
+ * @param[in] enter true on entry of gio_get_pending_irq(), false on exit.
+ */
+void sciTraceGioHook(bool enter);
+
+/**
+ * @brief Stop or resume recording, e.g. around a memory dump.
+ *
+ * @param[in] frozen true stops recording, false resumes it.
+ */
+void sciTraceFreeze(bool frozen);
+
+/**
+ * @brief Get the trace ring for dumping.
+ *
+ * @return The trace ring.
+ */
+const sci_trace_ring_t* sciTraceGet(void);
+
+#endif // SCI_TRACE_ENABLE
+
+#endif // SCI_TRACE_H
@@ -0,0 +1,170 @@
+#include <stdatomic.h>
+#include <string.h>
+#include "sci_txq.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+
+/** @brief Header bit: the record may be shipped. */
+#define SCI_TXQ_COMMITTED       (0x80000000U)
+
+/** @brief Header bit: the record only skips the end of the buffer. */
+#define SCI_TXQ_PADDING         (0x40000000U)
+
+/** @brief Header bits holding the payload length, or the padding length including its header. */
+#define SCI_TXQ_LENGTH_MASK     (0x3FFFFFFFU)
+
+_Static_assert(sizeof(atomic_uint) == sizeof(uint32_t), "record headers are buffer words accessed as atomic_uint");
+
+static struct g_sciTxQueue
+{
+    uint32_t*   buffer;     /* Storage, zero wherever no record is reserved */
+    uint32_t    size;       /* Capacity in bytes, a power of two */
+    atomic_uint reserved;   /* Bytes ever reserved, producers */
+    atomic_uint released;   /* Bytes ever released, TX interrupt */
+    atomic_uint dropped;    /* Reservations refused on a full queue */
+    uint32_t    in_flight;  /* Record bytes handed to the driver by the last refill */
+    bool        attached;   /* sciTxQueueInit() succeeded */
+} g_sciTxQueue_t[SCI_LIN_NUM_OF_INSTANCES];
+
+/* Payloads are padded to whole words so every header stays aligned. */
+static uint32_t sci_txq_stride(uint32_t length){
+    return (SCI_TXQ_HEADER_LEN + ((length + 3U) & ~3U));
+}
+
+static atomic_uint* sci_txq_header(struct g_sciTxQueue* queue, uint32_t position){
+    return ((atomic_uint*)&queue->buffer[(position & (queue->size - 1U)) / SCI_TXQ_HEADER_LEN]);
+}
+
+static struct g_sciTxQueue* sci_txq_get(volatile tms570_reg* sci_lin_reg){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || !g_sciTxQueue_t[index].attached){
+        return (NULL);
+    }
+    return (&g_sciTxQueue_t[index]);
+}
+
+// Runs in the TX interrupt, the only consumer; a released record is zeroed because a later header may land anywhere inside it
+static bool sci_txq_refill(volatile tms570_reg* sci_lin_reg, const uint8_t** data, uint32_t* length){
+    struct g_sciTxQueue* queue = sci_txq_get(sci_lin_reg);
+
+    if (queue == NULL){
+        return (false);
+    }
+
+    uint32_t released = atomic_load_explicit(&queue->released, memory_order_relaxed);
+    if (queue->in_flight != 0U){
+        memset(sci_txq_header(queue, released), 0, queue->in_flight);
+        released += queue->in_flight;
+        queue->in_flight = 0U;
+        atomic_store_explicit(&queue->released, released, memory_order_release);
+    }
+
+    while (released != atomic_load_explicit(&queue->reserved, memory_order_acquire)){
+        atomic_uint* header_word = sci_txq_header(queue, released);
+        uint32_t     header = atomic_load_explicit(header_word, memory_order_acquire);
+
+        // The oldest record is still being filled; its commit kicks TX again
+        if ((header & SCI_TXQ_COMMITTED) == 0U){
+            return (false);
+        }
+
+        if ((header & SCI_TXQ_PADDING) != 0U){
+            memset(header_word, 0, header & SCI_TXQ_LENGTH_MASK);
+            released += header & SCI_TXQ_LENGTH_MASK;
+            atomic_store_explicit(&queue->released, released, memory_order_release);
+            continue;
+        }
+
+        *data = (const uint8_t*)header_word + SCI_TXQ_HEADER_LEN;
+        *length = header & SCI_TXQ_LENGTH_MASK;
+        queue->in_flight = sci_txq_stride(*length);
+        return (true);
+    }
+    return (false);
+}
+
+bool sciTxQueueInit(volatile tms570_reg* sci_lin_reg, uint32_t* buffer, uint32_t size){
+    uint32_t index = sciGetInstanceIndex(sci_lin_reg);
+
+    if ((index >= SCI_LIN_NUM_OF_INSTANCES) || (buffer == NULL) || (size < 8U) || ((size & (size - 1U)) != 0U)){
+        return (false);
+    }
+
+    struct g_sciTxQueue* queue = &g_sciTxQueue_t[index];
+    memset(buffer, 0, size);
+    queue->buffer = buffer;
+    queue->size = size;
+    queue->in_flight = 0U;
+    atomic_store_explicit(&queue->reserved, 0U, memory_order_relaxed);
+    atomic_store_explicit(&queue->released, 0U, memory_order_relaxed);
+    atomic_store_explicit(&queue->dropped, 0U, memory_order_relaxed);
+    queue->attached = true;
+    return sciSetTxRefill(sci_lin_reg, sci_txq_refill);
+}
+
+bool sciTxQueueReserve(volatile tms570_reg* sci_lin_reg, uint32_t length, sci_txq_reservation_t* reservation){
+    struct g_sciTxQueue* queue = sci_txq_get(sci_lin_reg);
+
+    if ((queue == NULL) || (reservation == NULL) || (length == 0U) || (sci_txq_stride(length) > (queue->size / 2U))){
+        return (false);
+    }
+
+    uint32_t stride = sci_txq_stride(length);
+    uint32_t reserved = atomic_load_explicit(&queue->reserved, memory_order_relaxed);
+    uint32_t pad;
+
+    // A failed exchange reloads reserved, the space check is redone against it
+    do {
+        uint32_t offset = reserved & (queue->size - 1U);
+        uint32_t used = reserved - atomic_load_explicit(&queue->released, memory_order_acquire);
+
+        pad = ((queue->size - offset) < stride) ? (queue->size - offset) : 0U;
+        if ((pad + stride) > (queue->size - used)){
+            atomic_fetch_add_explicit(&queue->dropped, 1U, memory_order_relaxed);
+            return (false);
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&queue->reserved, &reserved, reserved + pad + stride,
+                                                    memory_order_acquire, memory_order_relaxed));
+
+    if (pad != 0U){
+        atomic_store_explicit(sci_txq_header(queue, reserved), SCI_TXQ_COMMITTED | SCI_TXQ_PADDING | pad, memory_order_release);
+    }
+
+    reservation->position = reserved + pad;
+    reservation->data = (uint8_t*)sci_txq_header(queue, reservation->position) + SCI_TXQ_HEADER_LEN;
+    reservation->length = length;
+    return (true);
+}
+
+bool sciTxQueueCommit(volatile tms570_reg* sci_lin_reg, const sci_txq_reservation_t* reservation){
+    struct g_sciTxQueue* queue = sci_txq_get(sci_lin_reg);
+
+    if ((queue == NULL) || (reservation == NULL) || (reservation->length == 0U)){
+        return (false);
+    }
+
+    // Release: the payload is visible before the interrupt can see the committed header
+    atomic_store_explicit(sci_txq_header(queue, reservation->position), SCI_TXQ_COMMITTED | reservation->length, memory_order_release);
+    return sciKickTx(sci_lin_reg);
+}
+
+bool sciTxQueueWrite(volatile tms570_reg* sci_lin_reg, const uint8_t* data, uint32_t length){
+    sci_txq_reservation_t reservation;
+
+    if ((data == NULL) || !sciTxQueueReserve(sci_lin_reg, length, &reservation)){
+        return (false);
+    }
+    memcpy(reservation.data, data, length);
+    return sciTxQueueCommit(sci_lin_reg, &reservation);
+}
+
+bool sciTxQueueGetDropped(volatile tms570_reg* sci_lin_reg, uint32_t* dropped){
+    struct g_sciTxQueue* queue = sci_txq_get(sci_lin_reg);
+
+    if ((queue == NULL) || (dropped == NULL)){
+        return (false);
+    }
+    *dropped = atomic_load_explicit(&queue->dropped, memory_order_relaxed);
+    return (true);
+}
@@ -0,0 +1,81 @@
+#ifndef SCI_TXQ_H
+#define SCI_TXQ_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+
+/** @brief Bytes of the header in front of every record. */
+#define SCI_TXQ_HEADER_LEN      (4U)
+
+/**
+ * @struct sci_txq_reservation_s
+ * @brief Space reserved by one producer, filled without a lock.
+ */
+typedef struct sci_txq_reservation_s {
+    uint8_t* data;      /** Where to write the bytes */
+    uint32_t length;    /** Bytes reserved, all of them are sent on commit */
+    uint32_t position;  /** Queue position of the record header, opaque to the producer */
+} sci_txq_reservation_t;
+
+/**
+ * @brief Attach a multi-producer TX queue to an SCI/LIN instance.
+ *
+ * Installs the TX refill hook, so the TX interrupt ships committed records
+ * in reservation order. Any number of tasks may produce, and interrupts
+ * that cannot preempt the TX interrupt: a kick landing between a refill
+ * that found nothing and the TX interrupt disable would be lost.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] buffer Storage for the queue, word aligned.
+ * @param[in] size Size of buffer in bytes, a power of two of at least 8.
+ * @return true if attached, false otherwise.
+ */
+bool sciTxQueueInit(volatile tms570_reg* sci_lin_reg, uint32_t* buffer, uint32_t size);
+
+/**
+ * @brief Reserve contiguous space for one record.
+ *
+ * Lock-free: one compare-and-swap on the reservation counter, retried only
+ * if another producer reserved in between. Records never wrap; space left
+ * at the end of the buffer is skipped with a padding record.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] length Bytes to reserve, at least 1; with header and word padding at most half the queue.
+ * @param[out] reservation Pointer to store the reserved space. @see sci_txq_reservation_t
+ * @return true if reserved, false if the queue has no room; the attempt is counted as dropped.
+ */
+bool sciTxQueueReserve(volatile tms570_reg* sci_lin_reg, uint32_t length, sci_txq_reservation_t* reservation);
+
+/**
+ * @brief Publish a filled reservation and start transmission.
+ *
+ * Records leave in reservation order, so a record committed early waits
+ * for older reservations to be committed.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] reservation Space returned by sciTxQueueReserve().
+ * @return true if committed, false otherwise.
+ */
+bool sciTxQueueCommit(volatile tms570_reg* sci_lin_reg, const sci_txq_reservation_t* reservation);
+
+/**
+ * @brief Reserve, copy and commit one record.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] data Bytes to send.
+ * @param[in] length Number of bytes to send.
+ * @return true if queued, false if the queue has no room.
+ */
+bool sciTxQueueWrite(volatile tms570_reg* sci_lin_reg, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Get the number of reservations refused because the queue was full.
+ *
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[out] dropped Pointer to store the count.
+ * @return true if the count was read, false otherwise.
+ */
+bool sciTxQueueGetDropped(volatile tms570_reg* sci_lin_reg, uint32_t* dropped);
+
+#endif // SCI_TXQ_H
@@ -0,0 +1,291 @@
+#include <string.h>
+#include "sci_ymodem.h"
+#include "sci_lin_regs.h"
+#include "sci_lin_utils.h"
+#include "sci_crc.h"
+#include "sci_cycle.h"
+#include "sci_stats.h"
+
+/* Control bytes go out on an idle line; the bound only guards against a stuck transmitter. */
+#define SCI_YMODEM_TX_TIMEOUT_US    (1000U)
+
+/* ACK followed by a request for the next file header or the first data block. */
+static const uint8_t s_sciYmodemAckRequest[2] = { SCI_YMODEM_ACK, SCI_YMODEM_CRC_REQUEST };
+
+static void sci_ymodem_reply(sci_ymodem_t* ymodem, const uint8_t* bytes, uint32_t length){
+    uint32_t sent;
+    (void)sciSendDeadline(ymodem->sci_lin_reg, length, bytes, sciCycleDeadline(SCI_YMODEM_TX_TIMEOUT_US), &sent);
+    ymodem->deadline = sciCycleDeadline(SCI_YMODEM_TIMEOUT_US);
+}
+
+static void sci_ymodem_reply_byte(sci_ymodem_t* ymodem, uint8_t byte){
+    sci_ymodem_reply(ymodem, &byte, 1U);
+}
+
+static void sci_ymodem_cancel(sci_ymodem_t* ymodem, sci_ymodem_status_t status){
+    static const uint8_t s_sciYmodemCancel[2] = { SCI_YMODEM_CAN, SCI_YMODEM_CAN };
+
+    if (status == SCI_YMODEM_STATUS_FAILED){
+        sci_ymodem_reply(ymodem, s_sciYmodemCancel, sizeof(s_sciYmodemCancel));
+    }
+    ymodem->status = status;
+}
+
+/* NAK (or 'C' while no file is open) and count the retry. */
+static void sci_ymodem_retry(sci_ymodem_t* ymodem){
+    ymodem->need = 0U;
+    ymodem->errors++;
+    if (ymodem->errors > SCI_YMODEM_MAX_ERRORS){
+        sci_ymodem_cancel(ymodem, SCI_YMODEM_STATUS_FAILED);
+    } else if (ymodem->phase == SCI_YMODEM_PHASE_DATA){
+        sci_ymodem_reply_byte(ymodem, SCI_YMODEM_NAK);
+    } else {
+        sci_ymodem_reply_byte(ymodem, SCI_YMODEM_CRC_REQUEST);
+    }
+}
+
+/* Block 0: NUL terminated file name, then the decimal size. */
+static void sci_ymodem_header(sci_ymodem_t* ymodem, const uint8_t* data, uint32_t length){
+    const char* name = (const char*)data;
+    uint32_t    name_length = 0U;
+    uint32_t    size = 0U;
+
+    if (data[0] == 0U){
+        // Null header: end of the batch
+        sci_ymodem_reply_byte(ymodem, SCI_YMODEM_ACK);
+        ymodem->phase = SCI_YMODEM_PHASE_FINISHED;
+        return;
+    }
+    if (ymodem->phase == SCI_YMODEM_PHASE_END){
+        // A second file in the batch: only one image per transfer
+        sci_ymodem_cancel(ymodem, SCI_YMODEM_STATUS_FAILED);
+        return;
+    }
+
+    while ((name_length < length) && (data[name_length] != 0U)){
+        name_length++;
+    }
+    for (uint32_t i = name_length + 1U; (i < length) && (data[i] >= (uint8_t)'0') && (data[i] <= (uint8_t)'9'); i++){
+        size = (size * 10U) + (uint32_t)(data[i] - (uint8_t)'0');
+    }
+    if ((name_length == length) ||
+        ((ymodem->flash->begin != NULL) && !ymodem->flash->begin(ymodem->flash->context, name, size))){
+        sci_ymodem_cancel(ymodem, SCI_YMODEM_STATUS_FAILED);
+        return;
+    }
+
+    ymodem->size = size;
+    ymodem->offset = 0U;
+    ymodem->expected = 1U;
+    ymodem->phase = SCI_YMODEM_PHASE_DATA;
+    sci_ymodem_reply(ymodem, s_sciYmodemAckRequest, sizeof(s_sciYmodemAckRequest));
+}
+
+/* A complete block is in the receive buffer: check it and decide what to do with it. */
+static void sci_ymodem_check(sci_ymodem_t* ymodem){
+    const uint8_t* block = ymodem->block[ymodem->receiving];
+    uint32_t       length = ymodem->need - 4U;
+
+    ymodem->need = 0U;
+
+    // With the CRC appended high byte first, a good block leaves a zero residue
+    if (((block[0] ^ block[1]) != 0xFFU) || (sciCrc16Update(SCI_CRC16_XMODEM_INIT, &block[2], length + 2U) != 0U)){
+        sci_ymodem_retry(ymodem);
+        return;
+    }
+
+    if (ymodem->phase != SCI_YMODEM_PHASE_DATA){
+        if (block[0] != 0U){
+            sci_ymodem_retry(ymodem);
+            return;
+        }
+        ymodem->errors = 0U;
+        sci_ymodem_header(ymodem, &block[2], length);
+    } else if (block[0] == ymodem->expected){
+        // Acknowledged once the other buffer is free, see sci_ymodem_accept()
+        ymodem->pending = length;
+    } else if (block[0] == (uint8_t)(ymodem->expected - 1U)){
+        // Our ACK was lost and the sender repeated the block
+        ymodem->errors = 0U;
+        sci_ymodem_reply_byte(ymodem, SCI_YMODEM_ACK);
+    } else {
+        sci_ymodem_cancel(ymodem, SCI_YMODEM_STATUS_FAILED);
+    }
+}
+
+/* ACK first, then program: the sender transmits the next block into the other buffer meanwhile. */
+static void sci_ymodem_accept(sci_ymodem_t* ymodem){
+    const uint8_t* data = &ymodem->block[ymodem->receiving][2];
+    uint32_t       length = ymodem->pending;
+
+    // The last block is padded up to the block size
+    if (ymodem->size != 0U){
+        uint32_t remaining = (ymodem->offset < ymodem->size) ? (ymodem->size - ymodem->offset) : 0U;
+        length = (remaining < length) ? remaining : length;
+    }
+
+    ymodem->pending = 0U;
+    ymodem->errors = 0U;
+    ymodem->expected++;
+    ymodem->receiving ^= 1U;
+    sci_ymodem_reply_byte(ymodem, SCI_YMODEM_ACK);
+    sciStatsAdd(ymodem->sci_lin_reg, SCI_STATS_RX_FRAMES, 1U);
+
+    if (length == 0U){
+        return;
+    }
+    if (!ymodem->flash->program(ymodem->flash->context, ymodem->offset, data, length)){
+        sci_ymodem_cancel(ymodem, SCI_YMODEM_STATUS_FAILED);
+        return;
+    }
+    ymodem->offset += length;
+    ymodem->programming = (ymodem->flash->poll != NULL);
+}
+
+static void sci_ymodem_start_byte(sci_ymodem_t* ymodem, uint8_t byte){
+    bool can = false;
+
+    switch (byte){
+    case SCI_YMODEM_SOH:
+        ymodem->need = 2U + SCI_YMODEM_BLOCK_128 + 2U;
+        ymodem->fill = 0U;
+        break;
+
+    case SCI_YMODEM_STX:
+        ymodem->need = 2U + SCI_YMODEM_BLOCK_1K + 2U;
+        ymodem->fill = 0U;
+        break;
+
+    case SCI_YMODEM_EOT:
+        if (ymodem->phase == SCI_YMODEM_PHASE_END){
+            // Our ACK of the EOT was lost
+            sci_ymodem_reply(ymodem, s_sciYmodemAckRequest, sizeof(s_sciYmodemAckRequest));
+            break;
+        }
+        if (ymodem->phase != SCI_YMODEM_PHASE_DATA){
+            break;
+        }
+        // NAK the first EOT so a corrupted one cannot end the file
+        if (!ymodem->eot){
+            ymodem->eot = true;
+            sci_ymodem_reply_byte(ymodem, SCI_YMODEM_NAK);
+        } else {
+            ymodem->eot = false;
+            ymodem->phase = SCI_YMODEM_PHASE_END;
+            sci_ymodem_reply(ymodem, s_sciYmodemAckRequest, sizeof(s_sciYmodemAckRequest));
+        }
+        break;
+
+    case SCI_YMODEM_CAN:
+        if (ymodem->can){
+            sci_ymodem_cancel(ymodem, SCI_YMODEM_STATUS_CANCELLED);
+        }
+        can = true;
+        break;
+
+    default:
+        // Line noise between blocks
+        break;
+    }
+    ymodem->can = can;
+}
+
+/* Consumes bytes up to the end of the current block; returns the number consumed. */
+static uint32_t sci_ymodem_feed(sci_ymodem_t* ymodem, const uint8_t* data, uint32_t length){
+    if (ymodem->need == 0U){
+        sci_ymodem_start_byte(ymodem, data[0]);
+        return (1U);
+    }
+
+    uint32_t chunk = ymodem->need - ymodem->fill;
+    chunk = (length < chunk) ? length : chunk;
+    memcpy(&ymodem->block[ymodem->receiving][ymodem->fill], data, chunk);
+    ymodem->fill += chunk;
+    ymodem->deadline = sciCycleDeadline(SCI_YMODEM_TIMEOUT_US);
+
+    if (ymodem->fill == ymodem->need){
+        sci_ymodem_check(ymodem);
+    }
+    return (chunk);
+}
+
+bool sciYmodemInit(sci_ymodem_t* ymodem, volatile tms570_reg* sci_lin_reg, const sci_ymodem_flash_t* flash){
+    if ((ymodem == NULL) || (flash == NULL) || (flash->program == NULL)){
+        return (false);
+    }
+
+    ymodem->rx = sciRxRingGet(sci_lin_reg);
+    if ((ymodem->rx == NULL) || (ymodem->rx->size <= SCI_YMODEM_BUFFER_LEN)){
+        return (false);
+    }
+
+    sciCycleInit();
+
+    ymodem->sci_lin_reg = sci_lin_reg;
+    ymodem->flash = flash;
+    ymodem->receiving = 0U;
+    ymodem->fill = 0U;
+    ymodem->need = 0U;
+    ymodem->pending = 0U;
+    ymodem->programming = false;
+    ymodem->eot = false;
+    ymodem->can = false;
+    ymodem->phase = SCI_YMODEM_PHASE_HEADER;
+    ymodem->status = SCI_YMODEM_STATUS_RUNNING;
+    ymodem->expected = 0U;
+    ymodem->errors = 0U;
+    ymodem->size = 0U;
+    ymodem->offset = 0U;
+
+    // Stale bytes would be taken for a block
+    (void)sciRxRingConsume(sci_lin_reg, sciRingUsed(ymodem->rx));
+    sci_ymodem_reply_byte(ymodem, SCI_YMODEM_CRC_REQUEST);
+    return (true);
+}
+
+sci_ymodem_status_t sciYmodemProcess(sci_ymodem_t* ymodem){
+    const uint8_t* data;
+    uint32_t       length;
+
+    if (ymodem == NULL){
+        return (SCI_YMODEM_STATUS_FAILED);
+    }
+
+    if (ymodem->programming){
+        sci_ymodem_flash_status_t flash = ymodem->flash->poll(ymodem->flash->context);
+        if (flash == SCI_YMODEM_FLASH_ERROR){
+            ymodem->programming = false;
+            sci_ymodem_cancel(ymodem, SCI_YMODEM_STATUS_FAILED);
+        } else if (flash == SCI_YMODEM_FLASH_DONE){
+            ymodem->programming = false;
+        }
+    }
+    if (ymodem->status != SCI_YMODEM_STATUS_RUNNING){
+        return (ymodem->status);
+    }
+
+    // A verified block needs the buffer that is still being programmed for its successor
+    if (ymodem->pending != 0U){
+        if (ymodem->programming){
+            return (ymodem->status);
+        }
+        sci_ymodem_accept(ymodem);
+    }
+
+    while ((ymodem->status == SCI_YMODEM_STATUS_RUNNING) && (ymodem->pending == 0U) &&
+           (ymodem->phase != SCI_YMODEM_PHASE_FINISHED) && sciRingPeek(ymodem->rx, &data, &length)){
+        (void)sciRxRingConsume(ymodem->sci_lin_reg, sci_ymodem_feed(ymodem, data, length));
+    }
+
+    if (ymodem->status != SCI_YMODEM_STATUS_RUNNING){
+        return (ymodem->status);
+    }
+    if (ymodem->phase == SCI_YMODEM_PHASE_FINISHED){
+        if (!ymodem->programming){
+            ymodem->status = SCI_YMODEM_STATUS_DONE;
+        }
+    } else if ((ymodem->pending == 0U) && sciCycleExpired(ymodem->deadline)){
+        sci_ymodem_retry(ymodem);
+    }
+    return (ymodem->status);
+}
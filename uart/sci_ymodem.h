@@ -0,0 +1,134 @@
+#ifndef SCI_YMODEM_H
+#define SCI_YMODEM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sci_lin_regs.h"
+#include "sci_ring.h"
+
+/** @brief YMODEM control bytes. */
+#define SCI_YMODEM_SOH              (0x01U)
+#define SCI_YMODEM_STX              (0x02U)
+#define SCI_YMODEM_EOT              (0x04U)
+#define SCI_YMODEM_ACK              (0x06U)
+#define SCI_YMODEM_NAK              (0x15U)
+#define SCI_YMODEM_CAN              (0x18U)
+#define SCI_YMODEM_CRC_REQUEST      (0x43U)
+
+/** @brief Payload of SOH and STX blocks. */
+#define SCI_YMODEM_BLOCK_128        (128U)
+#define SCI_YMODEM_BLOCK_1K         (1024U)
+
+/** @brief Block buffer: sequence number, its complement, 1 KB payload and CRC-16. */
+#define SCI_YMODEM_BUFFER_LEN       (2U + SCI_YMODEM_BLOCK_1K + 2U)
+
+/** @brief Time without a byte before the receiver retries. */
+#define SCI_YMODEM_TIMEOUT_US       (1000000U)
+
+/** @brief Consecutive retries before the transfer is cancelled. */
+#define SCI_YMODEM_MAX_ERRORS       (10U)
+
+/**
+ * @enum sci_ymodem_status_e
+ * @brief Transfer status reported by sciYmodemProcess().
+ */
+typedef enum sci_ymodem_status_e {
+    SCI_YMODEM_STATUS_RUNNING = 0,  /** Transfer in progress */
+    SCI_YMODEM_STATUS_DONE,         /** File received and programmed */
+    SCI_YMODEM_STATUS_CANCELLED,    /** Sender cancelled */
+    SCI_YMODEM_STATUS_FAILED,       /** Retries exhausted, protocol or flash error; CAN sent */
+    NUM_OF_SCI_YMODEM_STATUS        /** Number of statuses */
+} sci_ymodem_status_t;
+
+/**
+ * @enum sci_ymodem_phase_e
+ * @brief Protocol phases of the receiver.
+ */
+typedef enum sci_ymodem_phase_e {
+    SCI_YMODEM_PHASE_HEADER = 0,    /** Requesting block 0 with the file name and size */
+    SCI_YMODEM_PHASE_DATA,          /** Receiving data blocks */
+    SCI_YMODEM_PHASE_END,           /** EOT acknowledged, requesting the closing null header */
+    SCI_YMODEM_PHASE_FINISHED,      /** Null header received, waiting for the last programming */
+    NUM_OF_SCI_YMODEM_PHASE         /** Number of phases */
+} sci_ymodem_phase_t;
+
+/**
+ * @enum sci_ymodem_flash_status_e
+ * @brief Programming status reported by the flash backend.
+ */
+typedef enum sci_ymodem_flash_status_e {
+    SCI_YMODEM_FLASH_DONE = 0,      /** Last program operation finished */
+    SCI_YMODEM_FLASH_BUSY,          /** Program operation in progress */
+    SCI_YMODEM_FLASH_ERROR,         /** Last program operation failed */
+    NUM_OF_SCI_YMODEM_FLASH         /** Number of flash statuses */
+} sci_ymodem_flash_status_t;
+
+/**
+ * @struct sci_ymodem_flash_s
+ * @brief Pluggable flash backend.
+ *
+ * program() may finish synchronously (poll == NULL) or just start the
+ * operation; the data stays valid until poll() no longer reports busy.
+ * Either way the block is acknowledged before it is programmed, so the
+ * sender transmits the next block while the current one is written.
+ */
+typedef struct sci_ymodem_flash_s {
+    bool (*begin)(void* context, const char* name, uint32_t size);                          /** File announced, size 0 if unknown; may be NULL */
+    bool (*program)(void* context, uint32_t offset, const uint8_t* data, uint32_t length);  /** Program length bytes at image offset */
+    sci_ymodem_flash_status_t (*poll)(void* context);                                       /** Status of the last program(); NULL if program() is synchronous */
+    void* context;                                                                          /** Passed back to every call */
+} sci_ymodem_flash_t;
+
+/**
+ * @struct sci_ymodem_s
+ * @brief YMODEM-1K receiver state.
+ *
+ * Two block buffers alternate: one is programmed while the next block is
+ * received into the other.
+ */
+typedef struct sci_ymodem_s {
+    volatile tms570_reg*      sci_lin_reg;                          /** Instance the transfer runs on */
+    sci_ring_t*               rx;                                   /** RX ring of the instance */
+    const sci_ymodem_flash_t* flash;                                /** Flash backend */
+    uint8_t                   block[2][SCI_YMODEM_BUFFER_LEN];      /** Double buffer */
+    uint8_t                   receiving;                            /** Buffer the next block is received into */
+    uint32_t                  fill;                                 /** Bytes of the current block received */
+    uint32_t                  need;                                 /** Bytes of the current block after the start byte, 0 between blocks */
+    uint32_t                  pending;                              /** Payload of a verified block waiting for the other buffer, 0 if none */
+    bool                      programming;                          /** The other buffer is being programmed */
+    bool                      eot;                                  /** First EOT received and NAKed */
+    bool                      can;                                  /** Previous start byte was CAN */
+    sci_ymodem_phase_t        phase;                                /** Protocol phase */
+    sci_ymodem_status_t       status;                               /** Transfer status */
+    uint8_t                   expected;                             /** Next data block number */
+    uint8_t                   errors;                               /** Consecutive retries */
+    uint32_t                  deadline;                             /** Cycle count of the next retry */
+    uint32_t                  size;                                 /** File size from block 0, 0 if unknown */
+    uint32_t                  offset;                               /** Image bytes handed to the backend */
+} sci_ymodem_t;
+
+/**
+ * @brief Start a YMODEM-1K receive on an instance.
+ *
+ * The instance must have an RX ring (sciRxRingInit()) large enough for one
+ * block, SCI_YMODEM_BUFFER_LEN + 1 bytes, so that reception continues while
+ * a block is programmed.
+ *
+ * @param[out] ymodem Receiver state.
+ * @param[in] sci_lin_reg Pointer to the SCI/LIN register base.
+ * @param[in] flash Flash backend. @see sci_ymodem_flash_t
+ * @return true if started, false otherwise.
+ */
+bool sciYmodemInit(sci_ymodem_t* ymodem, volatile tms570_reg* sci_lin_reg, const sci_ymodem_flash_t* flash);
+
+/**
+ * @brief Advance the transfer, non-blocking.
+ *
+ * Call from the task loop until the status is no longer running.
+ *
+ * @param[in] ymodem Receiver state.
+ * @return Transfer status. @see sci_ymodem_status_t
+ */
+sci_ymodem_status_t sciYmodemProcess(sci_ymodem_t* ymodem);
+
+#endif // SCI_YMODEM_H
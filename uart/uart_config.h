@@ -3,6 +3,8 @@
 
 #define UART_BAUDRATE 115200U
 #define VCLK_FREQ 80000000U
+// CPU clock, counted by the PMU cycle counter
+#define GCLK_FREQ 160000000U
 
 // Baud Rate Register Value (SCIBRS)
 #define BRS_VAL (((VCLK_FREQ / (16U * UART_BAUDRATE)) - 1U) & 0x00FFFFFFU)